@@ -82,7 +82,7 @@ method print_c_header_files() {
     self.emit_c_op_func_header($fh);
     $fh.close();
 
-    if self.ops_file<core> {
+    if self.ops_file<core> && self.trans.emits_op_lib {
         $fh := pir::new__Ps('FileHandle');
         $fh.open(self<enum_header>, 'w')
             || die("Can't open "~ self<enum_header>);
@@ -168,11 +168,14 @@ method emit_c_source_file($fh) {
 
     self._emit_source_preamble($fh);
     self.trans.emit_source_part(self, $fh);
-    self._emit_op_lib_descriptor($fh);
-    self.trans.emit_op_lookup(self, $fh);
 
-    self._emit_init_func($fh);
-    self._emit_dymanic_lib_load($fh);
+    if self.trans.emits_op_lib {
+        self._emit_op_lib_descriptor($fh);
+        self.trans.emit_op_lookup(self, $fh);
+
+        self._emit_init_func($fh);
+        self._emit_dymanic_lib_load($fh);
+    }
     self._emit_coda($fh);
 }
 
@@ -205,11 +208,15 @@ method _emit_source_preamble($fh) {
 #include "pmc/pmc_callcontext.h"
 
 {self.trans.defines(self)}
+|);
 
+    if self.trans.emits_op_lib {
+        $fh.print(qq|
 /* XXX should be static, but C++ doesn't want to play ball */
 extern op_lib_t {self.bs}op_lib;
 
 |);
+    }
 
     $fh.print(self.ops_file.preamble);
 }
@@ -344,15 +351,19 @@ method _emit_coda($fh) {
 
 method _emit_includes($fh) {
 
-    $fh.print(qq|
+    $fh.print(q|
 #include "parrot/parrot.h"
 #include "parrot/oplib.h"
 #include "parrot/runcore_api.h"
 
-| ~ (self.flags<core> ?? 'PARROT_EXPORT' !! '') ~ qq|
+|);
+
+    if self.trans.emits_op_lib {
+        $fh.print((self.flags<core> ?? 'PARROT_EXPORT' !! '') ~ qq|
 op_lib_t *{self.init_func}(PARROT_INTERP, long init);
 
 |);
+    }
 }
 
 method _emit_preamble($fh) {
@@ -16,6 +16,10 @@ method suffix() { die("...") }
 
 method core_type() { die("...") }
 
+# Whether this transformation emits its own op_lib (info and function
+# tables, op lookup and init function).
+method emits_op_lib() { 1 }
+
 # Prepare internal structures from Ops::File.ops.
 method prepare_ops($emitter, $ops_file) { die('...') }
 
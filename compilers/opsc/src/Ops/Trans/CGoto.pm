@@ -0,0 +1,246 @@
+#! nqp
+# Copyright (C) 2015, Parrot Foundation.
+
+class Ops::Trans::CGoto is Ops::Trans::C;
+
+=begin
+
+Direct-threaded computed goto runcore.
+
+All ops are emitted as labels inside a single dispatch function. Each
+bytecode segment gets a parallel array of label addresses which is filled
+lazily the first time an op at a given offset is executed, so dispatching
+the next op is a single indirect jump.
+
+Only ops which touch nothing but registers and constants are inlined. Ops
+which call out of the op body (and therefore might throw, invoke or trigger
+GC) store the current pc into the context and call the op function of the
+function core, which keeps their locals out of the frame of the dispatch
+function.
+
+=end
+
+method new() {
+    self<op_labels> := list();
+    self<op_bodies> := list();
+
+    self<names>     := hash();
+
+    self<num_entries> := 0;
+
+    self<arg_maps> := hash(
+        :op("cur_opcode[NUM]"),
+
+        :i("IREG(NUM)"),
+        :n("NREG(NUM)"),
+        :p("PREG(NUM)"),
+        :s("SREG(NUM)"),
+        :k("PREG(NUM)"),
+        :ki("IREG(NUM)"),
+
+        :ic("ICONST(NUM)"),
+        :nc("NCONST(NUM)"),
+        :pc("PCONST(NUM)"),
+        :sc("SCONST(NUM)"),
+        :kc("PCONST(NUM)"),
+        :kic("ICONST(NUM)")
+    );
+
+    self;
+}
+
+method suffix() { '_cg' };
+
+# The computed goto core reuses the op info and function tables of the
+# function core, so no op_lib is emitted for it.
+method emits_op_lib() { 0 }
+
+method prepare_ops($emitter, $ops_file) {
+
+    my $index := 0;
+    my @op_labels;
+    my @op_bodies;
+
+    for $ops_file.ops -> $op {
+        my $src := $op.source( self );
+
+        if self.needs_pc_sync($src) {
+            $src := "    CG_SYNC_PC();\n    CG_JUMP(" ~ $op.func_name( self )
+                  ~ "(cur_opcode, interp));\n";
+        }
+
+        @op_labels.push(sprintf( "        %-30s /* %6ld */\n", "&&PC_$index,", $index ));
+        @op_bodies.push(join('', "  PC_$index: /* ", $op.full_name, " */\n", $src, "\n"));
+        $index++;
+    }
+
+    self<op_labels>   := @op_labels;
+    self<op_bodies>   := @op_bodies;
+    self<num_entries> := +@op_bodies;
+}
+
+# An op which only touches registers and constants can neither throw nor
+# invoke nor allocate, so the pc stored in the context may stay stale for it.
+# Everything calling out to any other function or macro syncs the pc first and
+# runs as a call to its function core op.
+method needs_pc_sync($src) {
+    my $calls := subst($src,
+        /<< [ IREG | NREG | PREG | SREG | ICONST | NCONST | SCONST | PCONST
+            | CG_NEXT | CG_JUMP | UNUSED | CURRENT_CONTEXT
+            | if | while | for | switch | sizeof | return ] \s* '('/,
+        '', :global);
+    $calls ~~ /<[a..zA..Z0..9_]> \s* '('/ ?? 1 !! 0;
+}
+
+method emit_c_op_funcs_header_part($fh) {
+    $fh.print(q|#include "parrot/oplib/core_ops.h"
+
+#if PARROT_HAS_CGOTO
+opcode_t * core_cg_runops(PARROT_INTERP, ARGIN(opcode_t *cur_opcode));
+#endif
+|);
+}
+
+method restart_address($addr) {
+    "interp->resume_offset = $addr; interp->resume_flag = 1;";
+}
+
+method restart_offset($offset) {
+    "interp->resume_offset = REL_PC + $offset; interp->resume_flag = 1;";
+}
+
+method goto_address($addr) { "CG_JUMP((opcode_t *)$addr)"; }
+
+method goto_offset($offset) { "CG_NEXT(cur_opcode + $offset)"; }
+
+method defines($emitter) {
+    return q|
+/* defines - Ops::Trans::CGoto */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
+
+#define CG_SYNC_PC()   Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode)
+#define CG_DISPATCH()  goto *cg_code[cur_opcode - cg_base]
+#define CG_NEXT(dest)  do { cur_opcode = (dest); CG_DISPATCH(); } while (0)
+#define CG_JUMP(dest)  do { cur_opcode = (dest); goto CG_BRANCH; } while (0)
+|;
+}
+
+method emit_source_part($emitter, $fh) {
+    my $bs := $emitter.bs;
+
+    $fh.print(qq|
+#if PARROT_HAS_CGOTO
+
+static void ** {$bs}load_segment(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs),
+        ARGIN(void *translate));
+
+/*
+** Threaded code for a segment: one label address per opcode_t, initially
+** all pointing at the translation label.
+*/
+
+static void **
+{$bs}load_segment(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs), ARGIN(void *translate))
+| ~ q|{
+    if (cs->cgoto_size != cs->base.size) {
+        size_t i;
+
+        if (cs->cgoto_code)
+            mem_gc_free(interp, cs->cgoto_code);
+
+        cs->cgoto_code      = mem_gc_allocate_n_typed(interp, cs->base.size, void *);
+        cs->cgoto_size      = cs->base.size;
+        cs->cgoto_translate = translate;
+
+        for (i = 0; i < cs->cgoto_size; ++i)
+            cs->cgoto_code[i] = translate;
+    }
+
+    return cs->cgoto_code;
+}
+
+/*
+** Computed goto runcore:
+*/
+
+opcode_t *
+| ~ $bs ~ q|runops(PARROT_INTERP, ARGIN(opcode_t *cur_opcode))
+{
+    static void * const ops_addr[] = {
+|);
+
+    for self<op_labels> {
+        $fh.print($_);
+    }
+
+    $fh.print(q|        NULL
+    };
+
+    op_lib_t * const   core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+    PackFile_ByteCode *cg_seg   = interp->code;
+    opcode_t          *cg_base  = cg_seg->base.data;
+    void             **cg_code  = | ~ $bs ~ q|load_segment(interp, cg_seg, &&CG_TRANSLATE);
+
+    CG_DISPATCH();
+
+  CG_BRANCH:
+    /* Absolute jump; the target may live in another segment or be the end. */
+    if (!cur_opcode)
+        return NULL;
+
+    if (cg_seg != interp->code) {
+        cg_seg  = interp->code;
+        cg_base = cg_seg->base.data;
+        cg_code = | ~ $bs ~ q|load_segment(interp, cg_seg, &&CG_TRANSLATE);
+    }
+
+    CG_DISPATCH();
+
+  CG_TRANSLATE:
+    /* While event checking, ops run through the swapped function table. */
+    if (cg_seg->save_func_table)
+        goto CG_FUNCTION;
+
+    /* First execution of the op at this offset: bind its label. */
+    {
+        const op_info_t * const info  = cg_seg->op_info_table[*cur_opcode];
+        void            * const label = info->lib == core_lib
+                                      ? ops_addr[info - core_lib->op_info_table]
+                                      : &&CG_FUNCTION;
+
+        cg_code[cur_opcode - cg_base] = label;
+        goto *label;
+    }
+
+  CG_FUNCTION:
+    /* Ops from dynamic oplibs, and every op while event checking, are
+     * dispatched through the function table. */
+    CG_SYNC_PC();
+    CG_JUMP((cg_seg->op_func_table[*cur_opcode])(cur_opcode, interp));
+
+|);
+
+    for self<op_bodies> {
+        $fh.print($_);
+    }
+
+    $fh.print(q|
+    return NULL;
+}
+
+#endif /* PARROT_HAS_CGOTO */
+
+|);
+}
+
+# vim: expandtab shiftwidth=4 ft=perl6:
@@ -0,0 +1,81 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+config/auto/cgoto.pm - Computed goto
+
+=head1 DESCRIPTION
+
+Determines whether the compiler supports computed goto (labels as values),
+which the C<cgoto> runcore requires.  Use C<--without-cgoto> to build
+without it.
+
+=cut
+
+package auto::cgoto;
+
+use strict;
+use warnings;
+
+use base qw(Parrot::Configure::Step);
+
+use Parrot::Configure::Utils ':auto';
+
+sub _init {
+    my $self = shift;
+    my %data;
+    $data{description} = q{Does your compiler support computed goto};
+    $data{result}      = q{};
+    return \%data;
+}
+
+sub runstep {
+    my ( $self, $conf ) = @_;
+
+    if ($conf->options->get( qw| without-cgoto | )) {
+        $conf->data->set( HAS_CGOTO => 0 );
+        $self->set_result('skipped');
+        return 1;
+    }
+
+    $self->_evaluate_cgoto($conf, _test($conf));
+    return 1;
+}
+
+#################### INTERNAL SUBROUTINES ####################
+
+sub _evaluate_cgoto {
+    my ($self, $conf, $has_cgoto) = @_;
+
+    if ($has_cgoto) {
+        $conf->data->set( HAS_CGOTO => 1 );
+        $conf->debug("DEBUG: computed goto detected\n");
+        $self->set_result('yes');
+    }
+    else {
+        $conf->data->set( HAS_CGOTO => 0 );
+        $conf->debug("DEBUG: computed goto not detected\n");
+        $self->set_result('no');
+    }
+    return $has_cgoto ? 1 : 0;
+}
+
+sub _test {
+    my ($conf) = @_;
+
+    $conf->cc_gen('config/auto/cgoto/test_c.in');
+    eval { $conf->cc_build() };
+    my $ret = $@ ? 0 : eval $conf->cc_run();
+    $conf->cc_clean();
+
+    return $ret;
+}
+
+1;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
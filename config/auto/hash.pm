@@ -0,0 +1,71 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+config/auto/hash.pm - String hash function
+
+=head1 DESCRIPTION
+
+Selects the function used to hash STRING and C string keys.
+
+The C<--hash-function> command-line option enables the configurer to choose
+among the available hash functions.  Current available options are:
+
+=over 4
+
+=item siphash13 (default)
+
+Seeded SipHash-1-3, consuming the key a 64 bit word at a time
+
+=item bernstein
+
+Seeded Bernstein "times 33" hash, consuming the key a byte at a time
+
+=back
+
+The choice is stored as C<hash_type> in C<%PConfig>, and available
+(uppercased) as PARROT_HASH_FUNCTION in F<parrot/config.h>
+
+=cut
+
+package auto::hash;
+
+use strict;
+use warnings;
+
+use base qw(Parrot::Configure::Step);
+
+sub _init {
+    my $self = shift;
+    my %data;
+    $data{description} = q{Determine string hash function to use};
+    $data{result}      = q{};
+    return \%data;
+}
+
+sub runstep {
+    my ( $self, $conf ) = @_;
+
+    my $hash = $conf->options->get('hash-function') || 'siphash13';
+    $conf->debug(" ($hash) ");
+
+    my @known_hashes = qw<siphash13 bernstein>;
+
+    if (!grep { $_ eq $hash } @known_hashes) {
+        die "unknown hash function '$hash': valid hash functions are "
+            . join(', ', @known_hashes);
+    }
+    $conf->data->set(hash_type => uc($hash));
+    $self->set_result($hash);
+
+    return 1;
+}
+
+1;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,143 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/concat.pir - build strings by repeated concatenation
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/concat.pir [pieces]
+
+=head1 DESCRIPTION
+
+Builds strings of C<pieces> (default 200000) short pieces with the C<concat>
+op, the way generated code and templates do: appending to a register,
+appending to a String PMC with C<.=>, prepending, and wrapping a string in
+markup at both ends.  Each result is checked against the expected length.
+Prints the time taken by each.  All of them should grow linearly with the
+number of pieces.
+
+=cut
+
+.const int DEFAULT_PIECES = 200000
+
+.sub 'main' :main
+    .param pmc argv
+    .local int pieces
+
+    pieces = DEFAULT_PIECES
+    $I0    = elements argv
+    if $I0 < 2 goto have_pieces
+    $S0    = argv[1]
+    pieces = $S0
+  have_pieces:
+
+    bench_append(pieces)
+    bench_append_pmc(pieces)
+    bench_prepend(pieces)
+    bench_wrap(pieces)
+.end
+
+.sub 'bench_append'
+    .param int pieces
+    .local string s
+    .local num start
+    .local int i
+
+    start = time
+    s = ''
+    i = 0
+  loop:
+    s = concat s, 'abcdefgh'
+    inc i
+    if i < pieces goto loop
+
+    $I0 = pieces * 8
+    report('append', s, $I0, start)
+.end
+
+.sub 'bench_append_pmc'
+    .param int pieces
+    .local pmc s
+    .local num start
+    .local int i
+
+    start = time
+    s = new ['String']
+    i = 0
+  loop:
+    s .= 'abcdefgh'
+    inc i
+    if i < pieces goto loop
+
+    $S0 = s
+    $I0 = pieces * 8
+    report('append .=', $S0, $I0, start)
+.end
+
+.sub 'bench_prepend'
+    .param int pieces
+    .local string s
+    .local num start
+    .local int i
+
+    start = time
+    s = ''
+    i = 0
+  loop:
+    s = concat 'abcdefgh', s
+    inc i
+    if i < pieces goto loop
+
+    $I0 = pieces * 8
+    report('prepend', s, $I0, start)
+.end
+
+.sub 'bench_wrap'
+    .param int pieces
+    .local string s
+    .local num start
+    .local int i
+
+    start = time
+    s = 'text'
+    i = 0
+  loop:
+    s = concat '<b>', s
+    s = concat s, '</b>'
+    inc i
+    if i < pieces goto loop
+
+    $I0 = pieces * 7
+    $I0 += 4
+    report('wrap', s, $I0, start)
+.end
+
+.sub 'report'
+    .param string name
+    .param string s
+    .param int expected
+    .param num start
+
+    $N0 = time
+    $N0 -= start
+    $I0 = length s
+    if $I0 == expected goto ok
+    print name
+    say ': wrong length'
+    .return ()
+  ok:
+    $P0 = new ['FixedPMCArray']
+    $P0 = 3
+    $P0[0] = name
+    $P0[1] = $I0
+    $P0[2] = $N0
+    $S0 = sprintf "%-10s %8d chars  %.4fs", $P0
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,215 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/echo_server.pir - loopback echo server with many connections
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/echo_server.pir [connections] [rounds]
+
+=head1 DESCRIPTION
+
+Runs an echo server and C<connections> (default 10000) clients in one
+interpreter, talking over loopback TCP sockets.  The server never blocks on
+a socket: every connection is served by a task parked with
+C<schedule_io> until the socket is readable, so one thread serves all of
+them.  The clients connect, then send a message on every connection and
+wait for all the echoes, C<rounds> (default 10) times.  Prints the time
+taken to connect and the round trips per second.
+
+Every connection takes two file descriptors, so 10000 connections need a
+limit of more than 20000 open files (C<ulimit -n>).
+
+=cut
+
+.include 'socket.pasm'
+
+.const int DEFAULT_CONNECTIONS = 10000
+.const int DEFAULT_ROUNDS      = 10
+.const int FIRST_PORT          = 12321
+.const int BATCH               = 64
+
+.sub 'main' :main
+    .param pmc argv
+    .local int connections, rounds, port, i
+    .local pmc listener, address, clients, accepted, client
+    .local num start
+
+    connections = DEFAULT_CONNECTIONS
+    rounds      = DEFAULT_ROUNDS
+    $I0 = elements argv
+    if $I0 < 2 goto have_args
+    $S0 = argv[1]
+    connections = $S0
+    if $I0 < 3 goto have_args
+    $S0 = argv[2]
+    rounds = $S0
+  have_args:
+
+    listener = new ['Socket']
+    listener.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = FIRST_PORT
+    push_eh next_port
+  bind:
+    address = listener.'sockaddr'('localhost', port)
+    listener.'bind'(address)
+    pop_eh
+    listener.'listen'(1024)
+
+    accepted = new ['Integer']
+    set_global 'accepted', accepted
+    park(listener, 'accept')
+
+    # Connect in batches, letting the server accept each batch, so the
+    # listen queue never overflows
+    clients = new ['ResizablePMCArray']
+    start = time
+    i = 0
+  connect:
+    client = new ['Socket']
+    client.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    client.'connect'(address)
+    push clients, client
+    inc i
+    $I0 = i % BATCH
+    if $I0 goto next_connect
+    wait_for_accepts(i)
+  next_connect:
+    if i < connections goto connect
+    wait_for_accepts(connections)
+    report_connect(connections, start)
+
+    .local int round
+    start = time
+    round = 0
+  next_round:
+    i = 0
+  send:
+    client = clients[i]
+    client.'send'('ping')
+    inc i
+    if i < connections goto send
+
+    .local pmc interp, ready
+    interp = getinterp
+    i = 0
+  receive:
+    client = clients[i]
+    ready = interp.'schedule_io'(client, 1)
+    wait ready
+    $S0 = client.'recv'()
+    if $S0 != 'ping' goto bad
+    inc i
+    if i < connections goto receive
+
+    inc round
+    if round < rounds goto next_round
+    report_round_trips(connections, rounds, start)
+
+    i = 0
+  close:
+    client = clients[i]
+    client.'close'()
+    inc i
+    if i < connections goto close
+    listener.'close'()
+    .return ()
+
+  next_port:
+    inc port
+    $I0 = FIRST_PORT + 10
+    if port < $I0 goto bind
+    pop_eh
+    say "couldn't bind to a free port"
+    .return ()
+  bad:
+    say 'wrong echo'
+.end
+
+# Parks a task running the named sub on the handle until it is readable.
+.sub 'park'
+    .param pmc handle
+    .param string name
+    .local pmc task, interp
+    task = new ['Task']
+    $P0  = get_global name
+    setattribute task, 'code', $P0
+    setattribute task, 'data', handle
+    interp = getinterp
+    interp.'schedule_io'(handle, 1, task)
+.end
+
+.sub 'accept'
+    .param pmc listener
+    $I0 = listener.'is_closed'()
+    if $I0 goto closed
+    $P0 = listener.'accept'()
+    park($P0, 'echo')
+    park(listener, 'accept')
+    $P0 = get_global 'accepted'
+    inc $P0
+  closed:
+.end
+
+.sub 'echo'
+    .param pmc conn
+    $S0 = conn.'recv'()
+    if $S0 == '' goto closed
+    conn.'send'($S0)
+    park(conn, 'echo')
+    .return ()
+  closed:
+    conn.'close'()
+.end
+
+.sub 'wait_for_accepts'
+    .param int count
+    $P0 = get_global 'accepted'
+  loop:
+    $I0 = $P0
+    if $I0 >= count goto done
+    pass
+    goto loop
+  done:
+.end
+
+.sub 'report_connect'
+    .param int connections
+    .param num start
+    $N0 = time
+    $N0 -= start
+    $P0 = new ['FixedPMCArray']
+    $P0 = 2
+    $P0[0] = connections
+    $P0[1] = $N0
+    $S0 = sprintf "%d connections in %.3fs", $P0
+    say $S0
+.end
+
+.sub 'report_round_trips'
+    .param int connections
+    .param int rounds
+    .param num start
+    $N0 = time
+    $N0 -= start
+    if $N0 > 0.0 goto rate
+    $N0 = 0.000001
+  rate:
+    $I0 = connections * rounds
+    $N1 = $I0
+    $N1 /= $N0
+    $P0 = new ['FixedPMCArray']
+    $P0 = 3
+    $P0[0] = $I0
+    $P0[1] = $N0
+    $P0[2] = $N1
+    $S0 = sprintf "%d round trips in %.3fs, %.0f per second", $P0
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,91 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/gc_string_moves.pir - string memory copied by compaction
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/gc_string_moves.pir
+    ./parrot --gc ms2 examples/benchmarks/gc_string_moves.pir
+
+=head1 DESCRIPTION
+
+Works like a parser: keeps a symbol table of 20000 long-lived strings while
+creating lots of short-lived token strings, only some of which are kept
+for a while.  Every compaction of the string pool copies live strings to
+a new block.  Prints the time taken, the number of collect runs and how
+much string memory they copied in all.
+
+=cut
+
+.include 'interpinfo.pasm'
+
+.const int N_SYMBOLS = 20000
+.const int N_TOKENS  = 2000000
+.const int N_KEPT    = 1000
+
+.sub 'main' :main
+    .local pmc symbols, kept
+    .local num start
+    .local int i, j
+
+    start = time
+
+    symbols = new ['ResizableStringArray']
+    i = 0
+  symbol:
+    $S0 = i
+    $S0 = concat 'symbol_', $S0
+    $S0 = repeat $S0, 4
+    push symbols, $S0
+    inc i
+    if i < N_SYMBOLS goto symbol
+
+    # Tokens die young, except the last N_KEPT of them
+    kept = new ['ResizableStringArray']
+    kept = N_KEPT
+    i = 0
+  token:
+    $S0 = i
+    $S0 = concat 'token ', $S0
+    $S0 = concat $S0, ' of the input'
+    j = i % N_KEPT
+    kept[j] = $S0
+    inc i
+    if i < N_TOKENS goto token
+
+    # Check the symbols survived all the moves
+    i = 0
+  check:
+    $S0 = i
+    $S0 = concat 'symbol_', $S0
+    $S0 = repeat $S0, 4
+    $S1 = symbols[i]
+    if $S0 != $S1 goto bad
+    inc i
+    if i < N_SYMBOLS goto check
+
+    $N0 = time
+    $N0 -= start
+    $P0 = new ['FixedPMCArray']
+    $P0 = 3
+    $P0[0] = $N0
+    $I0 = interpinfo .INTERPINFO_GC_COLLECT_RUNS
+    $P0[1] = $I0
+    $I0 = interpinfo .INTERPINFO_TOTAL_COPIED
+    $N1 = $I0
+    $N1 /= 1048576.0
+    $P0[2] = $N1
+    $S0 = sprintf "%.3fs, %d collect runs copied %.1f MB", $P0
+    say $S0
+    .return ()
+  bad:
+    say 'lost a symbol'
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
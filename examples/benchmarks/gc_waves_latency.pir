@@ -0,0 +1,132 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/gc_waves_latency.pir - GC pause time histogram
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/gc_waves_latency.pir
+    ./parrot --gc ms2 --gc-threads=2 examples/benchmarks/gc_waves_latency.pir
+
+=head1 DESCRIPTION
+
+Allocates PMCs in waves like F<gc_waves_headers.pasm>: every wave builds up
+a list of 20000 objects and drops it again, so each collection finds lots
+of dead objects to sweep.  The allocations are timed in steps of 100.  A step
+taking much longer than the others is one which ran a collection, so the
+histogram of step times shows how long the program stalls for the GC.
+
+Prints the total time, the number of GC runs, the histogram and the
+slowest step.
+
+=cut
+
+.include 'interpinfo.pasm'
+
+.const int N_WAVES = 100
+.const int N_ITEMS = 20000
+.const int N_STEP  = 100
+
+.sub 'main' :main
+    .local pmc buckets
+    buckets = new ['FixedIntegerArray']
+    buckets = 7
+
+    .local num start, step_start, now, step, slowest
+    .local int wave, i, bucket
+    slowest = 0.0
+    start   = time
+    wave    = 0
+  next_wave:
+    .local pmc list
+    list = new ['ResizablePMCArray']
+    i = 0
+    step_start = time
+  alloc:
+    $P0 = new ['Integer']
+    $P0 = i
+    $P1 = new ['Hash']
+    $P1['value'] = $P0
+    push list, $P1
+    inc i
+    $I0 = i % N_STEP
+    if $I0 goto alloc
+
+    # Bucket by decade: < 10us, < 100us, ... >= 100ms
+    now    = time
+    step   = now - step_start
+    step_start = now
+    if step <= slowest goto no_slowest
+    slowest = step
+  no_slowest:
+    bucket = 0
+    $N0 = 0.00001
+  find_bucket:
+    if step < $N0 goto have_bucket
+    inc bucket
+    $N0 *= 10.0
+    if bucket < 6 goto find_bucket
+  have_bucket:
+    $I0 = buckets[bucket]
+    inc $I0
+    buckets[bucket] = $I0
+
+    if i < N_ITEMS goto alloc
+    null list
+    inc wave
+    if wave < N_WAVES goto next_wave
+
+    now = time
+    now -= start
+    $P0 = new ['FixedPMCArray']
+    $P0 = 1
+    $P0[0] = now
+    $S0 = sprintf "%.4f seconds.", $P0
+    say $S0
+
+    $I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    print 'A total of '
+    print $I0
+    say ' GC runs were made'
+
+    report(buckets, 0, '     < 10us')
+    report(buckets, 1, '    < 100us')
+    report(buckets, 2, '      < 1ms')
+    report(buckets, 3, '     < 10ms')
+    report(buckets, 4, '    < 100ms')
+    report(buckets, 5, '       < 1s')
+    report(buckets, 6, '      >= 1s')
+
+    $P0[0] = slowest
+    $S0 = sprintf "Slowest step: %.6f seconds", $P0
+    say $S0
+.end
+
+.sub 'report'
+    .param pmc buckets
+    .param int bucket
+    .param string label
+
+    $P0 = new ['FixedPMCArray']
+    $P0 = 2
+    $P0[0] = label
+    $I0 = buckets[bucket]
+    $P0[1] = $I0
+    $S0 = sprintf "%s: %d", $P0
+    say $S0
+.end
+
+=head1 SEE ALSO
+
+F<examples/benchmarks/gc_waves_headers.pasm>,
+F<examples/benchmarks/gc_waves_sizeable_data.pasm>,
+F<examples/benchmarks/gc_waves_sizeable_headers.pasm>.
+
+=cut
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,230 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/hash_access.pir - benchmark Hash stores, lookups and deletes
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/hash_access.pir
+
+=head1 DESCRIPTION
+
+Stores 200000 keys in a Hash, looks them up repeatedly, looks up as many
+missing keys, iterates over the Hash and finally deletes every key.  Runs
+once with STRING keys and once with INTVAL keys.  The STRING keys are
+created (and hashed) up front, so the times show the cost of the table
+itself.  A full GC run precedes every phase, so collections triggered by
+earlier phases do not skew the next one.  Prints the time taken by each
+phase.
+
+=cut
+
+.include 'hash_key_type.pasm'
+
+.const int N_KEYS   = 200000
+.const int N_ROUNDS = 10
+
+.sub 'main' :main
+    .local pmc keys, missing
+    keys    = new ['ResizableStringArray']
+    missing = new ['ResizableStringArray']
+
+    .local int i
+    i = 0
+  make_keys:
+    $S0 = i
+    $S1 = concat 'key', $S0
+    $I0 = prehash($S1)
+    push keys, $S1
+    $S1 = concat 'missing', $S0
+    $I0 = prehash($S1)
+    push missing, $S1
+    inc i
+    if i < N_KEYS goto make_keys
+
+    say 'STRING keys'
+    $P0 = new ['Hash']
+    bench_string_keys($P0, keys, missing)
+
+    say 'INTVAL keys'
+    $P0 = new ['Hash']
+    $P0 = .Hash_key_type_int
+    bench_int_keys($P0)
+.end
+
+# Hashes the string once, so its hash value is cached.
+.sub 'prehash'
+    .param string s
+    $P0 = new ['Hash']
+    $P0['k'] = 1
+    $I0 = exists $P0[s]
+    .return ($I0)
+.end
+
+.sub 'bench_string_keys'
+    .param pmc hash
+    .param pmc keys
+    .param pmc missing
+
+    .local num start
+    .local int i, round, found
+
+    start = start_phase()
+    i = 0
+  store:
+    $S0 = keys[i]
+    hash[$S0] = i
+    inc i
+    if i < N_KEYS goto store
+    report('store', start)
+
+    start = start_phase()
+    found = 0
+    round = 0
+  lookup_round:
+    i = 0
+  lookup:
+    $S0 = keys[i]
+    $I0 = exists hash[$S0]
+    found += $I0
+    inc i
+    if i < N_KEYS goto lookup
+    inc round
+    if round < N_ROUNDS goto lookup_round
+    report('lookup', start)
+
+    start = start_phase()
+    i = 0
+  miss:
+    $S0 = missing[i]
+    $I0 = exists hash[$S0]
+    found += $I0
+    inc i
+    if i < N_KEYS goto miss
+    report('miss', start)
+
+    bench_iterate(hash)
+
+    start = start_phase()
+    i = 0
+  delete:
+    $S0 = keys[i]
+    delete hash[$S0]
+    inc i
+    if i < N_KEYS goto delete
+    report('delete', start)
+
+    check(found, hash)
+.end
+
+.sub 'bench_int_keys'
+    .param pmc hash
+
+    .local num start
+    .local int i, round, found
+
+    start = start_phase()
+    i = 0
+  store:
+    hash[i] = i
+    inc i
+    if i < N_KEYS goto store
+    report('store', start)
+
+    start = start_phase()
+    found = 0
+    round = 0
+  lookup_round:
+    i = 0
+  lookup:
+    $I0 = exists hash[i]
+    found += $I0
+    inc i
+    if i < N_KEYS goto lookup
+    inc round
+    if round < N_ROUNDS goto lookup_round
+    report('lookup', start)
+
+    start = start_phase()
+    i = N_KEYS
+    $I1 = N_KEYS * 2
+  miss:
+    $I0 = exists hash[i]
+    found += $I0
+    inc i
+    if i < $I1 goto miss
+    report('miss', start)
+
+    bench_iterate(hash)
+
+    start = start_phase()
+    i = 0
+  delete:
+    delete hash[i]
+    inc i
+    if i < N_KEYS goto delete
+    report('delete', start)
+
+    check(found, hash)
+.end
+
+.sub 'bench_iterate'
+    .param pmc hash
+
+    .local num start
+    .local int count
+    start = start_phase()
+    count = 0
+    $P0 = iter hash
+  loop:
+    unless $P0 goto done
+    $P1 = shift $P0
+    inc count
+    goto loop
+  done:
+    report('iterate', start)
+
+    if count == N_KEYS goto ok
+    say 'iteration missed keys'
+  ok:
+.end
+
+.sub 'check'
+    .param int found
+    .param pmc hash
+
+    $I0 = N_KEYS * N_ROUNDS
+    if found != $I0 goto bad
+    $I0 = elements hash
+    if $I0 != 0 goto bad
+    .return ()
+  bad:
+    say 'wrong number of keys found'
+.end
+
+.sub 'start_phase'
+    sweep 1
+    $N0 = time
+    .return ($N0)
+.end
+
+.sub 'report'
+    .param string phase
+    .param num start
+
+    $N0 = time
+    $N0 -= start
+    $P0 = new ['FixedPMCArray']
+    $P0 = 2
+    $P0[0] = phase
+    $P0[1] = $N0
+    $S0 = sprintf "  %-8s %.4fs", $P0
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,94 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/hash_keys.pir - benchmark hashing of STRING keys
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/hash_keys.pir
+
+=head1 DESCRIPTION
+
+Looks up STRING keys of 4 bytes up to 4 KB in a Hash.  Every lookup uses a
+fresh substring, so its hash value is not cached and the time is dominated
+by hashing the key.  Prints the lookups per second for each key length.
+
+=cut
+
+.sub 'main' :main
+    .local pmc lengths
+    lengths = new ['ResizableIntegerArray']
+    push lengths, 4
+    push lengths, 16
+    push lengths, 64
+    push lengths, 256
+    push lengths, 1024
+    push lengths, 4096
+
+    .local pmc it
+    it = iter lengths
+  next_length:
+    unless it goto done
+    $I0 = shift it
+    bench_length($I0)
+    goto next_length
+  done:
+.end
+
+.sub 'bench_length'
+    .param int length
+
+    # Keep the number of hashed bytes per key length roughly equal
+    .local int loops
+    loops = 67108864
+    loops /= length
+    if loops <= 200000 goto have_loops
+    loops = 200000
+  have_loops:
+
+    .local string key
+    key = repeat 'k', length
+    key = concat 'x', key
+
+    .local pmc hash
+    hash = new ['Hash']
+    $S0 = substr key, 1
+    hash[$S0] = 1
+
+    .local num start, elapsed
+    .local int i, found
+    found = 0
+    i = 0
+    start = time
+  loop:
+    $S0 = substr key, 1
+    $I0 = exists hash[$S0]
+    found += $I0
+    inc i
+    if i < loops goto loop
+    elapsed = time
+    elapsed -= start
+
+    if found == loops goto report
+    say 'lookup failed'
+  report:
+    $N0 = loops
+    if elapsed > 0.0 goto rate
+    elapsed = 0.000001
+  rate:
+    $N0 /= elapsed
+    $I0 = $N0
+    $P0 = new ['FixedPMCArray']
+    $P0 = 2
+    $P0[0] = length
+    $P0[1] = $I0
+    $S0 = sprintf "%5d bytes: %d lookups/s", $P0
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
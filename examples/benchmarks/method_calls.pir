@@ -0,0 +1,149 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/method_calls.pir - method calls at mono- and polymorphic sites
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/method_calls.pir [calls]
+
+=head1 DESCRIPTION
+
+Calls C<calls> (default 1000000) methods from a call site that always sees
+the same class, from one that sees three classes in turn, and with a method
+name built at runtime.  Then looks up as many methods without calling them.
+Prints the time taken by each.
+
+=cut
+
+.const int DEFAULT_CALLS = 1000000
+
+.sub 'main' :main
+    .param pmc argv
+    .local int calls
+
+    calls = DEFAULT_CALLS
+    $I0   = elements argv
+    if $I0 < 2 goto have_calls
+    $S0   = argv[1]
+    calls = $S0
+  have_calls:
+
+    $P0 = newclass 'A'
+    $P1 = subclass $P0, 'B'
+    $P2 = subclass $P1, 'C'
+
+    bench_monomorphic(calls)
+    bench_polymorphic(calls)
+    bench_dynamic_name(calls)
+    bench_lookup(calls)
+.end
+
+.sub 'bench_monomorphic'
+    .param int calls
+    .local pmc obj
+    .local num start
+    .local int i
+
+    obj   = new ['C']
+    start = time
+    i     = 0
+  loop:
+    obj.'m'()
+    inc i
+    if i < calls goto loop
+
+    report('monomorphic', start)
+.end
+
+.sub 'bench_polymorphic'
+    .param int calls
+    .local pmc objs, obj
+    .local num start
+    .local int i
+
+    objs    = new ['FixedPMCArray']
+    objs    = 3
+    $P0     = new ['A']
+    objs[0] = $P0
+    $P0     = new ['B']
+    objs[1] = $P0
+    $P0     = new ['C']
+    objs[2] = $P0
+    start   = time
+    i       = 0
+  loop:
+    $I0 = i % 3
+    obj = objs[$I0]
+    obj.'m'()
+    inc i
+    if i < calls goto loop
+
+    report('polymorphic', start)
+.end
+
+.sub 'bench_dynamic_name'
+    .param int calls
+    .local pmc obj
+    .local string name
+    .local num start
+    .local int i
+
+    obj   = new ['C']
+    name  = 'm'
+    name .= 'e'
+    start = time
+    i     = 0
+  loop:
+    obj.name()
+    inc i
+    if i < calls goto loop
+
+    report('dynamic name', start)
+.end
+
+.sub 'bench_lookup'
+    .param int calls
+    .local pmc obj, meth
+    .local num start
+    .local int i
+
+    obj   = new ['C']
+    start = time
+    i     = 0
+  loop:
+    meth = find_method obj, 'm'
+    inc i
+    if i < calls goto loop
+
+    report('lookup only', start)
+.end
+
+.sub 'report'
+    .param string name
+    .param num start
+
+    $N0 = time
+    $N0 -= start
+    $P0 = new ['FixedPMCArray']
+    $P0 = 2
+    $P0[0] = name
+    $P0[1] = $N0
+    $S0 = sprintf "%-12s %.4fs", $P0
+    say $S0
+.end
+
+.namespace ['A']
+
+.sub 'm' :method
+.end
+
+.sub 'me' :method
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
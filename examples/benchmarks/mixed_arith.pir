@@ -0,0 +1,95 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/mixed_arith.pir - arithmetic on mixed number types
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/mixed_arith.pir [iterations]
+
+=head1 DESCRIPTION
+
+Adds, subtracts and multiplies Integer and Float PMCs with subclasses of
+them, C<iterations> (default 200000) times.  The core types
+dispatch these through static switches, but as soon as a subclass is
+involved every operation goes through multiple dispatch, looking up the
+chosen candidate in the MMD cache.  Also times the same operations on the
+core types alone for comparison, and prints the time taken by each.
+
+=cut
+
+.const int DEFAULT_ITERATIONS = 200000
+
+.sub 'main' :main
+    .param pmc argv
+    .local int iterations
+
+    iterations = DEFAULT_ITERATIONS
+    $I0 = elements argv
+    if $I0 < 2 goto have_iterations
+    $S0 = argv[1]
+    iterations = $S0
+  have_iterations:
+
+    $P0 = subclass 'Integer', 'MyInt'
+    $P0 = subclass 'Float', 'MyFloat'
+
+    $P0 = new ['MyInt']
+    $P1 = new ['MyFloat']
+    bench('subclasses', iterations, $P0, $P1)
+
+    $P0 = new ['Integer']
+    $P1 = new ['Float']
+    bench('core types', iterations, $P0, $P1)
+.end
+
+.sub 'bench'
+    .param string name
+    .param int iterations
+    .param pmc int_like
+    .param pmc float_like
+    .local pmc i, f, r
+    .local num start
+    .local int n
+
+    i = new ['Integer']
+    i = 3
+    f = new ['Float']
+    f = 0.25
+    int_like   = 2
+    float_like = 1.5
+
+    start = time
+    n = 0
+  loop:
+    r = int_like + float_like
+    r = i * float_like
+    r = int_like - f
+    r = f + int_like
+    inc n
+    if n < iterations goto loop
+
+    $N0 = time
+    $N0 -= start
+    $N1 = r
+    if $N1 == 2.25 goto ok
+    print name
+    say ': wrong result'
+    .return ()
+  ok:
+    $P0 = new ['FixedPMCArray']
+    $P0 = 3
+    $P0[0] = name
+    $I0 = iterations * 4
+    $P0[1] = $I0
+    $P0[2] = $N0
+    $S0 = sprintf "%-10s %8d ops  %.4fs", $P0
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,159 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/mmap_read.pir - read a file with and without a memory mapping
+
+=head1 SYNOPSIS
+
+    ./parrot examples/benchmarks/mmap_read.pir [lines]
+
+=head1 DESCRIPTION
+
+Writes a temporary file of C<lines> (default 200000) lines, then reads it back
+with C<readall> and line by line with C<readline>, once through a normal read
+buffer (mode C<r>) and once through a memory mapping (mode C<rm>).  Reads from
+a mapped file return strings pointing into the mapping instead of copies of
+the data.  Prints the time and throughput of each pass and checks that both
+modes read the same data.
+
+=cut
+
+.const int DEFAULT_LINES = 200000
+.const int N_ROUNDS      = 10
+
+.sub 'main' :main
+    .param pmc argv
+    .local int lines
+    .local string path
+
+    lines = DEFAULT_LINES
+    $I0   = elements argv
+    if $I0 < 2 goto have_lines
+    $S0   = argv[1]
+    lines = $S0
+  have_lines:
+
+    path = 'mmap_read_bench.tmp'
+    write_file(path, lines)
+
+    .local int size_r, size_m, count_r, count_m
+    size_r  = bench_readall(path, 'r')
+    size_m  = bench_readall(path, 'rm')
+    count_r = bench_readline(path, 'r')
+    count_m = bench_readline(path, 'rm')
+
+    $P0 = new ['OS']
+    $P0.'unlink'(path)
+
+    if size_r != size_m goto bad
+    if count_r != count_m goto bad
+    if count_r != lines goto bad
+    .return ()
+  bad:
+    say 'modes read different data'
+.end
+
+.sub 'write_file'
+    .param string path
+    .param int lines
+    .local pmc fh
+    .local int i
+
+    fh = new ['FileHandle']
+    fh.'open'(path, 'w')
+    i = 0
+  loop:
+    $S0 = i
+    $S0 = concat 'line ', $S0
+    $S0 = concat $S0, ' of the mmap read benchmark'
+    fh.'print'($S0)
+    fh.'print'("\n")
+    inc i
+    if i < lines goto loop
+    fh.'close'()
+.end
+
+.sub 'bench_readall'
+    .param string path
+    .param string mode
+    .local pmc fh
+    .local num start
+    .local int round, total, size
+
+    total = 0
+    round = 0
+    start = time
+  loop:
+    fh = new ['FileHandle']
+    fh.'open'(path, mode)
+    $S0  = fh.'readall'()
+    fh.'close'()
+    size = length $S0
+    total += size
+    inc round
+    if round < N_ROUNDS goto loop
+
+    report('readall', mode, total, start)
+    .return (size)
+.end
+
+.sub 'bench_readline'
+    .param string path
+    .param string mode
+    .local pmc fh
+    .local num start
+    .local int round, total, count
+
+    total = 0
+    round = 0
+    start = time
+  next_round:
+    fh = new ['FileHandle']
+    fh.'open'(path, mode)
+    count = 0
+  loop:
+    $S0 = fh.'readline'()
+    if $S0 == '' goto done
+    $I0 = length $S0
+    total += $I0
+    inc count
+    goto loop
+  done:
+    fh.'close'()
+    inc round
+    if round < N_ROUNDS goto next_round
+
+    report('readline', mode, total, start)
+    .return (count)
+.end
+
+.sub 'report'
+    .param string op
+    .param string mode
+    .param int bytes
+    .param num start
+
+    $N0 = time
+    $N0 -= start
+    if $N0 > 0.0 goto rate
+    $N0 = 0.000001
+  rate:
+    $N1 = bytes
+    $N1 /= $N0
+    $N1 /= 1048576.0
+    $P0 = new ['FixedPMCArray']
+    $P0 = 4
+    $P0[0] = op
+    $P0[1] = mode
+    $P0[2] = $N0
+    $P0[3] = $N1
+    $S0 = sprintf "%-8s %-2s %.4fs  %.1f MB/s", $P0
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,126 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/threads/alloc_rate.pir - PMC allocation rate with several tasks
+
+=head1 SYNOPSIS
+
+    ./parrot examples/threads/alloc_rate.pir
+    ./parrot --numthreads=4 examples/threads/alloc_rate.pir
+
+=head1 DESCRIPTION
+
+Allocates 1000000 Integer, String and ResizablePMCArray PMCs, split evenly
+over 1, 4 and 16 tasks.  Every task keeps the last 1000 PMCs it allocated
+alive, so the collector has something to mark.  Prints the number of PMCs
+allocated per second for every type and number of tasks.
+
+Tasks run on as many threads as given with C<--numthreads>.  Every thread
+allocates from the pools of its own interpreter, so the rate should scale
+with the number of threads up to the number of cores.
+
+=cut
+
+.const int N_ALLOCS = 1000000
+.const int N_KEEP   = 1000
+
+.sub 'main' :main
+    .local pmc types, counts, type_it, count_it
+    types = new ['ResizableStringArray']
+    push types, 'Integer'
+    push types, 'String'
+    push types, 'ResizablePMCArray'
+
+    counts = new ['ResizableIntegerArray']
+    push counts, 1
+    push counts, 4
+    push counts, 16
+
+    type_it = iter types
+  next_type:
+    unless type_it goto done
+    $S0 = shift type_it
+    count_it = iter counts
+  next_count:
+    unless count_it goto next_type
+    $I0 = shift count_it
+    bench($S0, $I0)
+    goto next_count
+  done:
+.end
+
+.sub 'bench'
+    .param string type
+    .param int n_tasks
+
+    .local pmc tasks, alloc, task, data
+    .local num start, elapsed
+    tasks = new ['ResizablePMCArray']
+    alloc = get_global 'alloc'
+
+    sweep 1
+    start = time
+    $I0 = 0
+  spawn:
+    data = new ['FixedPMCArray']
+    data = 2
+    data[0] = type
+    $I1 = N_ALLOCS / n_tasks
+    data[1] = $I1
+    task = new ['Task']
+    setattribute task, 'code', alloc
+    setattribute task, 'data', data
+    schedule task
+    push tasks, task
+    inc $I0
+    if $I0 < n_tasks goto spawn
+
+    $I0 = 0
+  join:
+    task = tasks[$I0]
+    wait task
+    inc $I0
+    if $I0 < n_tasks goto join
+
+    elapsed = time
+    elapsed -= start
+    if elapsed > 0.0 goto rate
+    elapsed = 0.000001
+  rate:
+    $N0 = N_ALLOCS
+    $N0 /= elapsed
+    $I0 = $N0
+    $P0 = new ['FixedPMCArray']
+    $P0 = 3
+    $P0[0] = type
+    $P0[1] = n_tasks
+    $P0[2] = $I0
+    $S0 = sprintf "%-17s %2d tasks: %d PMCs/s", $P0
+    say $S0
+.end
+
+.sub 'alloc'
+    .param pmc data
+    .local string type
+    .local int count, i
+    .local pmc keep
+    type  = data[0]
+    count = data[1]
+
+    keep = new ['FixedPMCArray']
+    keep = N_KEEP
+    i = 0
+  loop:
+    $P0 = new type
+    $I0 = i % N_KEEP
+    keep[$I0] = $P0
+    inc i
+    if i < count goto loop
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
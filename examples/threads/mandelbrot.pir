@@ -0,0 +1,194 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/threads/mandelbrot.pir - parallel Mandelbrot set with one task per row
+
+=head1 SYNOPSIS
+
+    ./parrot examples/threads/mandelbrot.pir [size]
+
+    for n in 2 3 5 9 17 32; do
+        ./parrot --numthreads=$n examples/threads/mandelbrot.pir
+    done
+
+=head1 DESCRIPTION
+
+Counts the iterations needed for every point of a C<size> x C<size> (default
+600) grid over the Mandelbrot set, scheduling one task per row.  Rows through
+the middle of the set take many times longer than the ones at the edges, so
+the work can only be spread evenly by threads taking over rows from busy
+ones.  Every row sends its iteration count back to the main task, which
+checks the total and prints the time taken.
+
+The main interpreter takes one of the C<--numthreads> slots, so running with
+C<n> threads computes rows on C<n - 1> cores.  The time should drop with the
+number of threads up to the number of cores.
+
+=cut
+
+.const int MAX_ITER     = 200
+.const int DEFAULT_SIZE = 600
+
+.sub 'main' :main
+    .param pmc argv
+    .local int size, y
+    .local pmc tasks, results, row, task, data
+    .local num start, elapsed
+
+    size = DEFAULT_SIZE
+    $I0  = elements argv
+    if $I0 < 2 goto have_size
+    $S0  = argv[1]
+    size = $S0
+  have_size:
+
+    tasks   = new ['ResizablePMCArray']
+    results = new ['ResizableIntegerArray']
+    row     = get_global 'row'
+
+    start = time
+    y = 0
+  spawn:
+    data = new ['FixedIntegerArray']
+    data = 2
+    data[0] = y
+    data[1] = size
+    task = new ['Task']
+    push task, results
+    setattribute task, 'code', row
+    setattribute task, 'data', data
+    schedule task
+    push tasks, task
+    inc y
+    if y < size goto spawn
+
+    y = 0
+  join:
+    task = tasks[y]
+    wait task
+    inc y
+    if y < size goto join
+
+    # the counts arrive in tasks of their own
+  collect:
+    $I0 = elements results
+    if $I0 >= size goto check
+    pass
+    goto collect
+
+  check:
+    elapsed = time
+    elapsed -= start
+
+    .local int total
+    total = 0
+    $P0 = iter results
+  sum:
+    unless $P0 goto summed
+    $I0 = shift $P0
+    total += $I0
+    goto sum
+  summed:
+    $I0 = serial_total(size)
+    if $I0 == total goto report
+    say 'wrong number of iterations'
+  report:
+    $P0 = new ['FixedPMCArray']
+    $P0 = 4
+    $P0[0] = size
+    $P0[1] = size
+    $P0[2] = total
+    $P0[3] = elapsed
+    $S0 = sprintf "%dx%d: %d iterations in %.3fs", $P0
+    say $S0
+.end
+
+# The expected total, without any tasks.
+.sub 'serial_total'
+    .param int size
+    .local int y, total
+    total = 0
+    y = 0
+  loop:
+    $I0 = row_iterations(y, size)
+    total += $I0
+    inc y
+    if y < size goto loop
+    .return (total)
+.end
+
+.sub 'row'
+    .param pmc data
+    .local pmc interp, task, results, result
+    .local int y, size, count
+
+    interp  = getinterp
+    task    = interp.'current_task'()
+    results = pop task
+
+    y     = data[0]
+    size  = data[1]
+    count = row_iterations(y, size)
+
+    result = new ['Task']
+    $P0 = get_global 'add_result'
+    setattribute result, 'code', $P0
+    setattribute result, 'data', results
+    $P0 = new ['Integer']
+    $P0 = count
+    push result, $P0
+    interp.'schedule_proxied'(result, results)
+.end
+
+.sub 'add_result'
+    .param pmc results
+    .local pmc interp, task
+    interp = getinterp
+    task   = interp.'current_task'()
+    $P0    = pop task
+    $I0    = $P0
+    push results, $I0
+.end
+
+.sub 'row_iterations'
+    .param int y
+    .param int size
+    .local int x, i, count
+    .local num cr, ci, zr, zi, zr2, zi2, scale
+
+    scale = 3.0 / size
+    ci    = y * scale
+    ci   -= 1.5
+    count = 0
+    x     = 0
+  next_point:
+    cr  = x * scale
+    cr -= 2.0
+    zr  = 0.0
+    zi  = 0.0
+    i   = 0
+  iterate:
+    zr2 = zr * zr
+    zi2 = zi * zi
+    $N0 = zr2 + zi2
+    if $N0 > 4.0 goto escaped
+    zi  = zr * zi
+    zi *= 2.0
+    zi += ci
+    zr  = zr2 - zi2
+    zr += cr
+    inc i
+    if i < MAX_ITER goto iterate
+  escaped:
+    count += i
+    inc x
+    if x < size goto next_point
+    .return (count)
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,121 @@
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+examples/threads/task_queue_contention.pir - many threads sending tasks to one
+
+=head1 SYNOPSIS
+
+    ./parrot examples/threads/task_queue_contention.pir [count]
+    ./parrot --numthreads=17 examples/threads/task_queue_contention.pir
+
+=head1 DESCRIPTION
+
+Starts 16 producer tasks, each of which sends C<count> (default 20000) small
+tasks back to the main interpreter, as fast as it can.  All producers push
+onto the same scheduler queue while the main task is taking tasks off it, so
+the rate shows how much the producers get in each other's (and the
+consumer's) way.  Prints the number of tasks delivered per second.
+
+Run with C<--numthreads=17> to give every producer a thread of its own.
+
+=cut
+
+.const int PRODUCERS     = 16
+.const int DEFAULT_COUNT = 20000
+
+.sub 'main' :main
+    .param pmc argv
+    .local int count, expected, i
+    .local pmc counter, tasks, task, data
+    .local num start, elapsed
+
+    count = DEFAULT_COUNT
+    $I0   = elements argv
+    if $I0 < 2 goto have_count
+    $S0   = argv[1]
+    count = $S0
+  have_count:
+    expected = count * PRODUCERS
+
+    counter = new ['Integer']
+    tasks   = new ['ResizablePMCArray']
+    $P0     = get_global 'produce'
+
+    start = time
+    i = 0
+  spawn:
+    task = new ['Task']
+    push task, counter
+    setattribute task, 'code', $P0
+    data = new ['Integer']
+    data = count
+    setattribute task, 'data', data
+    schedule task
+    push tasks, task
+    inc i
+    if i < PRODUCERS goto spawn
+
+    i = 0
+  join:
+    task = tasks[i]
+    wait task
+    inc i
+    if i < PRODUCERS goto join
+
+  drain:
+    $I0 = counter
+    if $I0 >= expected goto done
+    pass
+    goto drain
+
+  done:
+    elapsed = time
+    elapsed -= start
+    if elapsed > 0.0 goto report
+    elapsed = 0.000001
+  report:
+    $N0 = expected
+    $N0 /= elapsed
+    $I0 = $N0
+    $P0 = new ['FixedPMCArray']
+    $P0 = 4
+    $P0[0] = PRODUCERS
+    $P0[1] = expected
+    $P0[2] = elapsed
+    $P0[3] = $I0
+    $S0 = sprintf "%d producers: %d tasks in %.3fs, %d tasks/s", $P0
+    say $S0
+.end
+
+.sub 'produce'
+    .param pmc data
+    .local pmc interp, task, counter, code, message
+    .local int count, i
+
+    interp  = getinterp
+    task    = interp.'current_task'()
+    counter = pop task
+    count   = data
+    code    = get_global 'received'
+
+    i = 0
+  loop:
+    message = new ['Task']
+    setattribute message, 'code', code
+    setattribute message, 'data', counter
+    interp.'schedule_proxied'(message, counter)
+    inc i
+    if i < count goto loop
+.end
+
+.sub 'received'
+    .param pmc counter
+    inc counter
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -549,7 +549,7 @@ help(void)
     "       --hash-seed F00F  specify hex value to use as hash seed\n"
     "    -X --dynext add path to dynamic extension search\n"
     "   <Run core options>\n"
-    "    -R --runcore fast|slow|bounds\n"
+    "    -R --runcore fast|cgoto|slow|bounds\n"
     "    -R --runcore trace|profiling|subprof\n"
     "    -t --trace [flags]\n"
     "   <VM options>\n"
@@ -564,6 +564,8 @@ help(void)
     "       --gc-min-threshold=KB\n"
     "       <GC GMS options>\n"
     "       --gc-nursery-size=percent of sysmem  size of gen0 (default 2)\n"
+    "       --gc-threads=N                       threads marking objects (default 1)\n"
+    "       --gc-max-pause=usec                  mark incrementally in slices\n"
     "       --gc-debug\n"
     "       --leak-test|--destroy-at-end\n"
     "    -. --wait    Read a keystroke before starting\n"
@@ -617,6 +619,8 @@ Parrot_cmd_options(void)
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_THREADS, OPTION_required_FLAG, { "--gc-threads" } },
+        { '\0', OPT_GC_MAX_PAUSE, OPTION_required_FLAG, { "--gc-max-pause" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
@@ -738,6 +742,38 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
             }
             break;
 
+          case OPT_GC_THREADS:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_threads = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_threads < 1 || initargs->gc_threads > 64) {
+                    fprintf(stderr, "error: number of GC threads must be between 1 and 64\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid number of GC threads specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+
+          case OPT_GC_MAX_PAUSE:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_max_pause = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_max_pause < 1 || initargs->gc_max_pause > 1000000) {
+                    fprintf(stderr, "error: GC pause must be between 1 and 1000000 usec\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC pause specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+
           case OPT_HASH_SEED:
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 initargs->hash_seed = strtoul(opt.opt_arg, NULL, 16);
@@ -804,6 +840,8 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_THREADS:
+          case OPT_GC_MAX_PAUSE:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
@@ -442,6 +442,8 @@ Parrot_cmd_options(void)
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_THREADS, OPTION_required_FLAG, { "--gc-threads" } },
+        { '\0', OPT_GC_MAX_PAUSE, OPTION_required_FLAG, { "--gc-max-pause" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { '\0', OPT_NUMTHREADS, OPTION_required_FLAG, { "--numthreads" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
@@ -538,7 +540,7 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
 
           case OPT_NUMTHREADS:
             if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
-                initargs->numthreads = strtoul(opt.opt_arg, NULL, 8);
+                initargs->numthreads = strtoul(opt.opt_arg, NULL, 10);
 
                 if (initargs->numthreads < 2 || initargs->numthreads > 1e8) {
                     fprintf(stderr, "error: minimum number of threads is 2\n");
@@ -552,6 +554,38 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
             }
             break;
 
+          case OPT_GC_THREADS:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_threads = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_threads < 1 || initargs->gc_threads > 64) {
+                    fprintf(stderr, "error: number of GC threads must be between 1 and 64\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid number of GC threads specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+
+          case OPT_GC_MAX_PAUSE:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_max_pause = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_max_pause < 1 || initargs->gc_max_pause > 1000000) {
+                    fprintf(stderr, "error: GC pause must be between 1 and 1000000 usec\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC pause specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+
           case OPT_HASH_SEED:
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 initargs->hash_seed = strtoul(opt.opt_arg, NULL, 16);
@@ -620,6 +654,8 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_THREADS:
+          case OPT_GC_MAX_PAUSE:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
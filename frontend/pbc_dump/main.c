@@ -440,6 +440,9 @@ main(int argc, const char **argv)
     pfpmc = Parrot_pf_get_packfile_pmc(interp, pf, infilename);
     Parrot_pf_set_current_packfile(interp, pfpmc);
 
+    /* the dumpers read the constant tables directly */
+    Parrot_pf_thaw_frozen_constants(interp);
+
     if (convert) {
         const size_t size = Parrot_pf_pack_size(interp,
                             interp->code->base.pf) * sizeof (opcode_t);
@@ -1028,6 +1028,9 @@ main(int argc, const char **argv)
         ++argv;
     }
 
+    /* The merge copies constants straight out of the input tables. */
+    Parrot_pf_thaw_frozen_constants(interp);
+
     /* Merge. */
     merged = pbc_merge_begin(interp, input_files, argc);
 
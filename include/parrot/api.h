@@ -78,6 +78,8 @@ typedef struct _Parrot_Init_Args {
     Parrot_Int gc_min_threshold;
     Parrot_UInt hash_seed;
     Parrot_UInt numthreads;
+    Parrot_UInt gc_threads;
+    Parrot_UInt gc_max_pause;
     Parrot_UInt debug_flags;
 } Parrot_Init_Args;
 
@@ -466,6 +468,16 @@ Parrot_Int Parrot_api_string_import_wchar(
         __attribute__nonnull__(3)
         FUNC_MODIFIES(* out);
 
+PARROT_API
+Parrot_Int Parrot_api_string_intern(
+    ARGIN(Parrot_PMC interp_pmc),
+    ARGIN(Parrot_String str),
+    ARGOUT(Parrot_String * out))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* out);
+
 #define ASSERT_ARGS_Parrot_api_string_byte_length __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(len))
 #define ASSERT_ARGS_Parrot_api_string_export_ascii \
@@ -506,6 +518,10 @@ Parrot_Int Parrot_api_string_import_wchar(
        PARROT_ASSERT_ARG(interp_pmc) \
     , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(out))
+#define ASSERT_ARGS_Parrot_api_string_intern __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp_pmc) \
+    , PARROT_ASSERT_ARG(str) \
+    , PARROT_ASSERT_ARG(out))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/embed/strings.c */
 
@@ -1,5 +1,5 @@
 /* caches.h
- *  Copyright (C) 2001-2004, Parrot Foundation.
+ *  Copyright (C) 2001-2015, Parrot Foundation.
  *  Overview:
  *     Cache and direct freelist handling for various items.
  *  Data Structure and Algorithms:
@@ -20,18 +20,44 @@
  * object method cache entry
  */
 typedef struct _meth_cache_entry {
-    void * strstart;    /* string address */
-    PMC  * pmc;         /* the method sub pmc */
+    STRING * name;      /* the constant or interned method name */
+    PMC    * pmc;       /* the method sub pmc */
+    UINTVAL  epoch;     /* method epoch of the type when pmc was looked up */
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/* Number of invocant types an inline cache remembers */
+#define METH_IC_WAYS 4
+
+/*
+ * one invocant type seen at a method call site
+ */
+typedef struct _meth_ic_way {
+    const VTABLE * vtable;  /* vtable of the invocant */
+    PMC          * _class;  /* class of an Object invocant, else NULL */
+    UINTVAL        epoch;   /* method epoch of the type at the lookup */
+    PMC          * method;
+} Meth_ic_way;
+
+/*
+ * inline cache of a method call site
+ */
+typedef struct _meth_inline_cache {
+    const opcode_t * pc;        /* the call site */
+    STRING         * name;      /* the method name used there */
+    UINTVAL          next_way;  /* way to replace when all are in use */
+    Meth_ic_way      ways[METH_IC_WAYS];
+} Meth_inline_cache;
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
 typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
-    Meth_cache_entry ***idx;    /* bufstart idx */
-    /* PMC **hash */            /* for non-constant keys */
+    Meth_cache_entry ***idx;    /* name hash idx */
+    UINTVAL *epochs;            /* method epoch of each type, mc_size of them */
+    Meth_inline_cache *sites;   /* inline caches, indexed by call site */
+    UINTVAL n_freeable_names;   /* entries keyed on non-constant names */
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
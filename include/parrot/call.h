@@ -36,7 +36,8 @@ typedef struct parrot_runloop_t {
 typedef parrot_runloop_t Parrot_runloop;
 
 typedef enum {
-    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG /* last element */
+    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG,
+    CALLSIGNATURE_is_captured_FLAG       = PObj_private1_FLAG /* last element */
 } callsignature_flags_enum;
 
 #define CALLSIGNATURE_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -52,6 +53,28 @@ typedef enum {
 #define CALLSIGNATURE_is_exception_SET(o)   CALLSIGNATURE_flag_SET(is_exception, (o))
 #define CALLSIGNATURE_is_exception_CLEAR(o) CALLSIGNATURE_flag_CLEAR(is_exception, (o))
 
+/* Mark if a continuation may enter the context again after it returned */
+#define CALLSIGNATURE_is_captured_TEST(o)   CALLSIGNATURE_flag_TEST(is_captured, (o))
+#define CALLSIGNATURE_is_captured_SET(o)    CALLSIGNATURE_flag_SET(is_captured, (o))
+#define CALLSIGNATURE_is_captured_CLEAR(o)  CALLSIGNATURE_flag_CLEAR(is_captured, (o))
+
+/* A C signature string such as "PiP->I", parsed once */
+typedef struct _Pcc_signature {
+    char       *string;                 /* copy of the signature */
+    const char *return_sig;             /* part after "->" in string */
+    PMC        *arg_flags;              /* PARROT_ARG_* of each argument */
+    PMC        *return_flags;           /* PARROT_ARG_* of each return */
+    PMC        *method_flags;           /* arg_flags after an invocant, or NULL */
+} Pcc_signature;
+
+#define PCC_SIGNATURE_CACHE_SIZE 128
+
+/* Signatures recently used from C, keyed on the address of the string */
+typedef struct _Pcc_signature_cache {
+    const char    *keys[PCC_SIGNATURE_CACHE_SIZE];
+    Pcc_signature *entries[PCC_SIGNATURE_CACHE_SIZE];
+} Pcc_signature_cache;
+
 /* HEADERIZER BEGIN: src/call/pcc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -80,6 +103,17 @@ void Parrot_pcc_invoke_method_from_c_args(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*method_name);
 
+PARROT_EXPORT
+void Parrot_pcc_invoke_method_from_signature(PARROT_INTERP,
+    ARGIN(PMC* pmc),
+    ARGIN(STRING *method_name),
+    ARGIN(Pcc_signature *sig),
+    ...)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_EXPORT
 void Parrot_pcc_invoke_sub_from_c_args(PARROT_INTERP,
     ARGIN(PMC *sub_obj),
@@ -89,6 +123,15 @@ void Parrot_pcc_invoke_sub_from_c_args(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+void Parrot_pcc_invoke_sub_from_signature(PARROT_INTERP,
+    ARGIN(PMC *sub_obj),
+    ARGIN(Pcc_signature *sig),
+    ...)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -109,11 +152,22 @@ PMC * Parrot_pcc_new_call_object(PARROT_INTERP)
     , PARROT_ASSERT_ARG(pmc) \
     , PARROT_ASSERT_ARG(method_name) \
     , PARROT_ASSERT_ARG(signature))
+#define ASSERT_ARGS_Parrot_pcc_invoke_method_from_signature \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc) \
+    , PARROT_ASSERT_ARG(method_name) \
+    , PARROT_ASSERT_ARG(sig))
 #define ASSERT_ARGS_Parrot_pcc_invoke_sub_from_c_args \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_obj) \
     , PARROT_ASSERT_ARG(sig))
+#define ASSERT_ARGS_Parrot_pcc_invoke_sub_from_signature \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_obj) \
+    , PARROT_ASSERT_ARG(sig))
 #define ASSERT_ARGS_Parrot_pcc_new_call_object __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -180,6 +234,17 @@ PMC* Parrot_pcc_build_call_from_c_args(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC* Parrot_pcc_build_call_from_signature(PARROT_INTERP,
+    ARGIN(const Pcc_signature *sig),
+    ARGMOD(va_list *args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*args);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
@@ -246,6 +311,17 @@ void Parrot_pcc_fill_params_from_varargs(PARROT_INTERP,
         FUNC_MODIFIES(*call_object)
         FUNC_MODIFIES(*args);
 
+PARROT_EXPORT
+void Parrot_pcc_fill_returns_from_signature(PARROT_INTERP,
+    ARGMOD_NULLOK(PMC *call_object),
+    ARGIN(const Pcc_signature *sig),
+    ARGMOD(va_list *args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*call_object)
+        FUNC_MODIFIES(*args);
+
 PARROT_EXPORT
 void Parrot_pcc_set_call_from_c_args(PARROT_INTERP,
     ARGIN(PMC *signature),
@@ -266,6 +342,19 @@ void Parrot_pcc_set_call_from_varargs(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*args);
 
+PARROT_EXPORT
+void Parrot_pcc_signature_destroy(PARROT_INTERP,
+    ARGFREE(Pcc_signature *sig))
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Pcc_signature * Parrot_pcc_signature_new(PARROT_INTERP,
+    ARGIN(const char *signature))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 void Parrot_pcc_merge_signature_for_tailcall(PARROT_INTERP,
     ARGMOD(PMC *parent),
     ARGMOD(PMC *tailcall))
@@ -287,6 +376,34 @@ void Parrot_pcc_parse_signature_string(PARROT_INTERP,
         FUNC_MODIFIES(*arg_flags)
         FUNC_MODIFIES(*return_flags);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Pcc_signature_cache * Parrot_pcc_signature_cache_create(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_pcc_signature_cache_destroy(PARROT_INTERP,
+    ARGFREE(Pcc_signature_cache *cache))
+        __attribute__nonnull__(1);
+
+void Parrot_pcc_signature_cache_mark(PARROT_INTERP,
+    ARGIN(Pcc_signature_cache *cache))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Pcc_signature * Parrot_pcc_signature_lookup(PARROT_INTERP,
+    ARGIN(const char *signature))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_pcc_signature_method_flags(PARROT_INTERP,
+    ARGMOD(Pcc_signature *sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*sig);
+
 void Parrot_pcc_split_signature_string(
     ARGIN(const char *signature),
     ARGOUT(const char **arg_sig),
@@ -301,6 +418,11 @@ void Parrot_pcc_split_signature_string(
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sig))
+#define ASSERT_ARGS_Parrot_pcc_build_call_from_signature \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sig) \
+    , PARROT_ASSERT_ARG(args))
 #define ASSERT_ARGS_Parrot_pcc_build_call_from_varargs \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -330,6 +452,11 @@ void Parrot_pcc_split_signature_string(
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(args))
+#define ASSERT_ARGS_Parrot_pcc_fill_returns_from_signature \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sig) \
+    , PARROT_ASSERT_ARG(args))
 #define ASSERT_ARGS_Parrot_pcc_set_call_from_c_args \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -341,6 +468,11 @@ void Parrot_pcc_split_signature_string(
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(sig) \
     , PARROT_ASSERT_ARG(args))
+#define ASSERT_ARGS_Parrot_pcc_signature_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_signature_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(signature))
 #define ASSERT_ARGS_Parrot_pcc_merge_signature_for_tailcall \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -352,6 +484,23 @@ void Parrot_pcc_split_signature_string(
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(arg_flags) \
     , PARROT_ASSERT_ARG(return_flags))
+#define ASSERT_ARGS_Parrot_pcc_signature_cache_create \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_signature_cache_destroy \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_signature_cache_mark \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache))
+#define ASSERT_ARGS_Parrot_pcc_signature_lookup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(signature))
+#define ASSERT_ARGS_Parrot_pcc_signature_method_flags \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sig))
 #define ASSERT_ARGS_Parrot_pcc_split_signature_string \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(signature) \
@@ -372,7 +521,7 @@ void Parrot_pcc_split_signature_string(
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_get_results_pc)    \
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_get_params_pc)     \
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_set_returns_pc)) { \
-        PMC * const sig = (seg)->const_table->pmc.constants[(pc)[1]]; \
+        PMC * const sig = PF_CONST_PMC((interp), (seg)->const_table, (pc)[1]); \
         (n) += VTABLE_elements((interp), sig); \
     } \
 } while (0)
@@ -441,6 +590,17 @@ PARROT_CAN_RETURN_NULL
 PMC* Parrot_pcc_get_sub(PARROT_INTERP, ARGIN(const PMC *ctx))
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_pcc_new_return_continuation(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+void Parrot_pcc_release_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 void Parrot_pcc_reuse_continuation(PARROT_INTERP,
     ARGIN(PMC *call_context),
@@ -552,6 +712,12 @@ PMC * Parrot_set_new_context(PARROT_INTERP,
     , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_get_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_pcc_new_return_continuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_release_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_Parrot_pcc_reuse_continuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(call_context))
@@ -160,11 +160,11 @@ opcode_t* Parrot_pcc_get_pc_func(PARROT_INTERP, ARGIN(const PMC *ctx))
         __attribute__nonnull__(2);
 
 PARROT_EXPORT
-PARROT_PURE_FUNCTION
 PARROT_CAN_RETURN_NULL
 PMC* Parrot_pcc_get_pmc_constant_func(PARROT_INTERP,
     ARGIN(const PMC *ctx),
     INTVAL idx)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
 PARROT_EXPORT
@@ -217,7 +217,7 @@ PARROT_EXPORT
 PARROT_CAN_RETURN_NULL
 void Parrot_pcc_set_constants_func(PARROT_INTERP,
     ARGIN(PMC *ctx),
-    ARGIN(const struct PackFile_ConstTable *ct))
+    ARGIN(struct PackFile_ConstTable *ct))
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
@@ -357,7 +357,8 @@ UINTVAL Parrot_pcc_warnings_test_func(PARROT_INTERP,
        PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_get_pmc_constant_func \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(ctx))
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_get_pmc_constants_func \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ctx))
@@ -441,6 +442,7 @@ UINTVAL Parrot_pcc_warnings_test_func(PARROT_INTERP,
     CONTEXT_STRUCT(c)->num_constants = (ct)->num.constants; \
     CONTEXT_STRUCT(c)->str_constants = (ct)->str.constants; \
     CONTEXT_STRUCT(c)->pmc_constants = (ct)->pmc.constants; \
+    CONTEXT_STRUCT(c)->const_table   = (ct); \
 } while (0)
 
 #  define Parrot_pcc_get_continuation(i, c) (CONTEXT_STRUCT(c)->current_cont)
@@ -461,7 +463,9 @@ UINTVAL Parrot_pcc_warnings_test_func(PARROT_INTERP,
 
 #  define Parrot_pcc_get_num_constant(i, c, idx) (CONTEXT_STRUCT(c)->num_constants[(idx)])
 #  define Parrot_pcc_get_string_constant(i, c, idx) (CONTEXT_STRUCT(c)->str_constants[(idx)])
-#  define Parrot_pcc_get_pmc_constant(i, c, idx) (CONTEXT_STRUCT(c)->pmc_constants[(idx)])
+#  define Parrot_pcc_get_pmc_constant(i, c, idx) \
+    (CONTEXT_STRUCT(c)->pmc_constants[(idx)] ? CONTEXT_STRUCT(c)->pmc_constants[(idx)] \
+        : Parrot_pf_ConstTable_thaw_pmc((i), CONTEXT_STRUCT(c)->const_table, (idx)))
 
 #  define Parrot_pcc_get_recursion_depth(i, c) (CONTEXT_STRUCT(c)->recursion_depth)
 #  define Parrot_pcc_set_recursion_depth(i, c, d) (CONTEXT_STRUCT(c)->recursion_depth = (d))
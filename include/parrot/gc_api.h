@@ -41,6 +41,8 @@ typedef struct _Parrot_GC_Init_Args {
     Parrot_Int dynamic_threshold;
     Parrot_Int min_threshold;
     Parrot_UInt numthreads;
+    Parrot_UInt mark_threads;
+    Parrot_UInt max_pause;
     Parrot_UInt debug_flags;
 } Parrot_GC_Init_Args;
 
@@ -125,7 +127,17 @@ typedef enum {
     CPU_TYPE,
 
     /* additional gc constants */
-    MAX_GENERATIONS
+    MAX_GENERATIONS,
+    GC_MARK_THREADS,
+
+    /* wall time of gc phases in microseconds */
+    GC_TRACE_ROOTS_TIME,
+    GC_DIRTY_LIST_TIME,
+    GC_WORK_LIST_TIME,
+    GC_SWEEP_TIME,
+
+    /* number of incremental marking slices */
+    GC_MARK_SLICES
 } Interpinfo_enum;
 
 /* &end_gen */
@@ -225,6 +237,10 @@ PARROT_EXPORT
 size_t Parrot_gc_count_mark_runs(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+size_t Parrot_gc_count_mark_slices(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_destroy_child_interp(
     ARGMOD(Interp *dest_interp),
@@ -307,6 +323,10 @@ void Parrot_gc_mark_STRING_alive_fun(PARROT_INTERP,
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*obj);
 
+PARROT_EXPORT
+size_t Parrot_gc_mark_threads(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 int Parrot_gc_max_generations(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -333,6 +353,10 @@ PARROT_WARN_UNUSED_RESULT
 STRING * Parrot_gc_new_string_header(PARROT_INTERP, UINTVAL flags)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+size_t Parrot_gc_phase_time(PARROT_INTERP, Interpinfo_enum phase)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_pmc_needs_early_collection(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
@@ -428,6 +452,9 @@ PARROT_EXPORT
 void Parrot_unblock_GC_sweep(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+void Parrot_gc_mark_slice(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_Parrot_block_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_block_GC_mark_locked __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -473,6 +500,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_count_mark_runs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_count_mark_slices __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_destroy_child_interp \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(dest_interp) \
@@ -515,6 +544,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
 #define ASSERT_ARGS_Parrot_gc_mark_STRING_alive_fun \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_mark_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_max_generations __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_mem_alloc_since_last_collect \
@@ -527,6 +558,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_new_string_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_phase_time __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_pmc_needs_early_collection \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -575,6 +608,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_unblock_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_mark_slice __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/api.c */
 
@@ -18,11 +18,20 @@ typedef enum {
 
 
 /* A BucketIndex is an index into the pool of available buckets. */
-typedef UINTVAL BucketIndex;
+typedef Parrot_UInt4 BucketIndex;
+
+/* The index is open addressed and probed a group of slots at a time.  Each
+ * slot has a control byte: empty, deleted, or 7 bits of the key's hash. */
+#define HASH_GROUP_SIZE   8
+#define HASH_SLOT_EMPTY   0x80
+#define HASH_SLOT_DELETED 0xfe
+#define HASH_SLOT_IS_FULL(c) (!((c) & 0x80))
 
 #define N_BUCKETS(n) ((n))
+/* At most half of the slots are in use */
+#define N_SLOTS(n) ((n) < HASH_GROUP_SIZE / 2 ? HASH_GROUP_SIZE : (n) << 1)
 #define HASH_ALLOC_SIZE(n) (N_BUCKETS(n) * sizeof (HashBucket) + \
-                                     (n) * sizeof (HashBucket *))
+                                     N_SLOTS(n) * (sizeof (BucketIndex) + 1))
 
 /* &gen_from_enum(hash_key_type.pasm) */
 typedef enum {
@@ -37,6 +46,7 @@ typedef enum {
 /* &end_gen */
 
 typedef struct _hashbucket {
+    /* Next bucket on the free list; a bucket in use links to itself */
     struct _hashbucket *next;
     void *key;
     void *value;
@@ -46,8 +56,11 @@ struct _hash {
     /* Large slab store of buckets */
     HashBucket *buckets;
 
-    /* List of Bucket pointers */
-    HashBucket **index;
+    /* Bucket stored in each slot of the index */
+    BucketIndex *index;
+
+    /* Control byte of each slot of the index */
+    unsigned char *control;
 
     /* Store for empty buckets */
     HashBucket *free_list;
@@ -58,6 +71,9 @@ struct _hash {
     /* alloced - 1 */
     UINTVAL mask;
 
+    /* Number of slots marked deleted in the index */
+    UINTVAL deleted;
+
     /* The type of key object this hash uses */
     Hash_key_type key_type;
 
@@ -69,14 +85,33 @@ struct _hash {
 
 };
 
+/* Running state for hashing a key one codepoint at a time */
+typedef struct _hash_state {
+    /* Hash function internal state */
+    UHUGEINTVAL v0, v1, v2, v3;
+
+    /* Bytes not yet making up a whole word */
+    UHUGEINTVAL tail;
+
+    /* Number of bytes added so far */
+    UINTVAL len;
+
+    /* Whether every codepoint is added as four bytes */
+    INTVAL wide;
+} Parrot_hash_state;
+
 /* Utility macros - use them, do not reinvent the wheel */
 
-#define parrot_hash_iterate_linear(_hash, _code)                            \
+#define HASH_BUCKET_IN_USE(b) ((b)->next == (b))
+
+/* Visits the buckets in use in the order of the bucket store, which is
+ * insertion order unless buckets of deleted entries were reused */
+#define parrot_hash_iterate(_hash, _code)                                   \
 do {                                                                        \
     HashBucket *_bucket = (_hash)->buckets;                                 \
     UINTVAL     _found  = 0;                                                \
     while (_found < (_hash)->entries){                                      \
-        if (_bucket->key){                                                  \
+        if (HASH_BUCKET_IN_USE(_bucket)){                                   \
             _code                                                           \
             _found++;                                                       \
         }                                                                   \
@@ -84,30 +119,6 @@ do {                                                                        \
     }                                                                       \
 } while (0)
 
-#define parrot_hash_iterate_indexed(_hash, _code)                           \
-do {                                                                        \
-    if ((_hash)->entries) {                                                 \
-        UINTVAL _loc;                                                       \
-        for (_loc = 0; _loc <= (_hash)->mask; ++_loc) {                     \
-            HashBucket *_bucket = (_hash)->index[_loc];                     \
-            while (_bucket) {                                               \
-                _code                                                       \
-                _bucket = _bucket->next;                                    \
-            }                                                               \
-        }                                                                   \
-    }                                                                       \
-} while (0)
-
-#define parrot_hash_iterate(_hash, _code)                                   \
-do {                                                                        \
-    if ((_hash)->key_type == Hash_key_type_int                              \
-    ||  (_hash)->key_type == Hash_key_type_cstring                          \
-    ||  (_hash)->key_type == Hash_key_type_ptr)                             \
-        parrot_hash_iterate_indexed((_hash), _code);                        \
-    else                                                                    \
-        parrot_hash_iterate_linear((_hash), _code);                         \
-} while (0)
-
 typedef void (*value_free)(ARGFREE(void *));
 
 /* To avoid creating OrderedHashItem PMC we reuse FixedPMCArray PMC */
@@ -342,6 +353,25 @@ size_t Parrot_hash_pointer(
     ARGIN_NULLOK(const void * const p),
     size_t hashval);
 
+PARROT_HOT
+void Parrot_hash_state_add_codepoint(
+    ARGMOD(Parrot_hash_state *state),
+    UINTVAL c)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
+PARROT_WARN_UNUSED_RESULT
+size_t Parrot_hash_state_finish(ARGMOD(Parrot_hash_state *state))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
+void Parrot_hash_state_init(
+    ARGOUT(Parrot_hash_state *state),
+    size_t seed,
+    INTVAL wide)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 Hash * Parrot_hash_thaw(PARROT_INTERP, ARGMOD(PMC *info))
@@ -492,6 +522,13 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_Parrot_hash_pointer __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_hash_state_add_codepoint \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_Parrot_hash_state_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_Parrot_hash_state_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
 #define ASSERT_ARGS_Parrot_hash_thaw __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(info))
@@ -87,6 +87,7 @@ typedef enum {
     PARROT_SLOW_CORE,                       /* slow bounds/trace core */
     PARROT_FUNCTION_CORE    = PARROT_SLOW_CORE,
     PARROT_FAST_CORE        = 0x01,         /* fast DO_OP core */
+    PARROT_CGOTO_CORE       = 0x02,         /* direct-threaded computed goto core */
     PARROT_EXEC_CORE        = 0x20,         /* TODO Parrot_exec_run variants */
     PARROT_GC_DEBUG_CORE    = 0x40,         /* run GC before each op */
     PARROT_DEBUGGER_CORE    = 0x80,         /* used by parrot debugger */
@@ -225,6 +226,8 @@ struct parrot_interp_t {
     size_t             resume_offset;
 
     PackFile_ByteCode  *code;                 /* The code we are executing */
+    struct PackFile_ConstTable *frozen_const_tables; /* tables with PMC constants
+                                                      * still frozen */
 
     Hash               *op_hash;              /* mapping from op names to op_info_t */
 
@@ -262,11 +265,16 @@ struct parrot_interp_t {
     PMC *cur_task;
 
     MMD_Cache *op_mmd_cache;                  /* MMD cache for builtins. */
+    Hash      *mmd_type_tuples;               /* type tuples of C multi signatures */
+    struct _Pcc_signature_cache *pcc_signatures; /* parsed C call signatures */
+    struct _Lib_lookup_cache *lib_lookups;    /* located runtime files */
 
     struct _Caches * caches;                  /* see caches.h */
 
     STRING     **const_cstring_table;         /* CONST_STRING(x) items */
     Hash        *const_cstring_hash;          /* cache of const_string items */
+    Hash        *interned_strings;            /* weak table of interned STRINGs */
+    struct _Parrot_File_Mapping *mapped_files; /* mappings STRINGs point into */
 
     struct _handler_node_t *exit_handler_list;/* exit.c */
     int sleeping;                             /* used during sleep in events */
@@ -282,7 +290,8 @@ struct parrot_interp_t {
     FLOATVAL             quantum_done;        /* expiration of current quantum */
 
     struct _Thread_data *thread_data;         /* thread specific items */
-    int                  wake_up;
+    Parrot_atomic_integer wake_up;            /* notified since the last wait */
+    Parrot_atomic_integer asleep;             /* waiting on sleep_cond */
     Parrot_cond          sleep_cond;
     Parrot_mutex         sleep_mutex;
 
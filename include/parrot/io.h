@@ -53,6 +53,7 @@
 #define PIO_F_SHARED    00100000        /* Stream shares a file handle  */
 #define PIO_F_ASYNC     01000000        /* Handle is asynchronous       */
 #define PIO_F_BINARY    02000000        /* Open in binary mode          */
+#define PIO_F_MMAP      04000000        /* Read through a file mapping  */
 
 /* IO VTABLE Flags */
 #define PIO_VF_DEFAULT_READ_BUF     0x0001  /* This type uses read buffers by default  */
@@ -119,6 +120,7 @@ typedef struct _io_buffer {
     char *buffer_ptr;               /* ptr to the buffer mem block     */
     char *buffer_start;             /* ptr to the start of the data    */
     char *buffer_end;               /* ptr to the end of the data      */
+    Parrot_File_Mapping *mapping;   /* STRINGs may point into mmap()   */
 } IO_BUFFER;
 
 /* For examples of mmap-like behavior on windows, see:
@@ -1022,6 +1024,14 @@ size_t Parrot_io_buffer_flush(PARROT_INTERP,
 void Parrot_io_buffer_free(PARROT_INTERP, ARGFREE(IO_BUFFER *buffer))
         __attribute__nonnull__(1);
 
+INTVAL Parrot_io_buffer_map(PARROT_INTERP,
+    ARGMOD(PMC *handle),
+    ARGIN(const IO_VTABLE *vtable))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*handle);
+
 void Parrot_io_buffer_mark(PARROT_INTERP, ARGMOD_NULLOK(IO_BUFFER *buffer))
         FUNC_MODIFIES(*buffer);
 
@@ -1137,6 +1147,10 @@ size_t Parrot_io_buffer_write_b(PARROT_INTERP,
     , PARROT_ASSERT_ARG(vtable))
 #define ASSERT_ARGS_Parrot_io_buffer_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_io_buffer_map __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle) \
+    , PARROT_ASSERT_ARG(vtable))
 #define ASSERT_ARGS_Parrot_io_buffer_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_io_buffer_peek __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -35,6 +35,27 @@ typedef enum {
 } enum_lib_paths;
 /* &end_gen */
 
+/* Files located in one search path list, valid for as long as the list holds
+ * the same path STRINGs and the runtime prefix stays the same */
+typedef struct _Lib_lookup_list {
+    Hash    *found;         /* file name => located path, "" if not found
+                             * in the listed directories */
+    Hash    *dirs;          /* search directory => Hash PMC of its entries */
+    Hash    *dir_times;     /* search directory => mtime when it was listed */
+    STRING **paths;         /* search paths the files were located with */
+    INTVAL   n_paths;
+    STRING  *prefix;        /* runtime prefix they were located with */
+} Lib_lookup_list;
+
+/* Results of Parrot_locate_runtime_file_str, one list per search path list */
+typedef struct _Lib_lookup_cache {
+    Lib_lookup_list lists[PARROT_LIB_DYN_EXTS];
+    INTVAL          index_dirs; /* list search directories instead of probing
+                                 * each file in them */
+    UINTVAL         n_stats;    /* files probed so far */
+    UINTVAL         n_readdirs; /* search directories listed so far */
+} Lib_lookup_cache;
+
 /* HEADERIZER BEGIN: src/library.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -119,6 +140,20 @@ STRING * parrot_split_path_ext(PARROT_INTERP,
 void parrot_init_library_paths(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Lib_lookup_cache * Parrot_lib_lookup_cache_create(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_lib_lookup_cache_destroy(PARROT_INTERP,
+    ARGFREE(Lib_lookup_cache *cache))
+        __attribute__nonnull__(1);
+
+void Parrot_lib_lookup_cache_mark(PARROT_INTERP,
+    ARGIN(Lib_lookup_cache *cache))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_Parrot_get_runtime_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_lib_add_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -153,6 +188,15 @@ void parrot_init_library_paths(PARROT_INTERP)
     , PARROT_ASSERT_ARG(ext))
 #define ASSERT_ARGS_parrot_init_library_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_lib_lookup_cache_create \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_lib_lookup_cache_destroy \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_lib_lookup_cache_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/library.c */
 
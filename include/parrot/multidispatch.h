@@ -16,7 +16,6 @@
 #include "parrot/parrot.h"
 
 #define PARROT_MMD_MAX_CLASS_DEPTH 1000
-#define Parrot_mmd_cache_destroy(x, y)
 
 /* function typedefs */
 typedef PMC*    (*mmd_f_p_ppp)(PARROT_INTERP, PMC *, PMC *, PMC *);
@@ -54,7 +53,25 @@ typedef struct _multi_func_list {
     funcptr_t func_ptr;
 } multi_func_list;
 
-#define MMD_Cache PMC
+/* Longest argument list the MMD cache keeps the type ids of */
+#define MMD_CACHE_MAX_ARITY 4
+
+/* Number of sets in the MMD cache (a power of two) and entries per set */
+#define MMD_CACHE_SETS      64
+#define MMD_CACHE_WAYS      4
+
+typedef struct _MMD_Cache_entry {
+    PMC    *chosen;                     /* candidate dispatched to, NULL if free */
+    char   *name;                       /* copy of the multi's name, or NULL */
+    UINTVAL hashval;                    /* hash of name and types */
+    INTVAL  arity;                      /* number of type ids used */
+    INTVAL  types[MMD_CACHE_MAX_ARITY]; /* type ids of the arguments */
+} MMD_Cache_entry;
+
+typedef struct _MMD_Cache {
+    MMD_Cache_entry entries[MMD_CACHE_SETS][MMD_CACHE_WAYS];
+    UINTVAL         next_way;           /* way replaced when a set is full */
+} MMD_Cache;
 
 /* HEADERIZER BEGIN: src/multidispatch.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -101,6 +118,10 @@ PARROT_CANNOT_RETURN_NULL
 MMD_Cache * Parrot_mmd_cache_create(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+void Parrot_mmd_cache_destroy(PARROT_INTERP, ARGFREE(MMD_Cache *cache))
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -222,6 +243,8 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
     , PARROT_ASSERT_ARG(sig_obj))
 #define ASSERT_ARGS_Parrot_mmd_cache_create __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_mmd_cache_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_types \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -1151,6 +1151,8 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_disable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_enable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_terminate(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_intern_s_s(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_intern_s_sc(opcode_t *, PARROT_INTERP);
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
@@ -0,0 +1,36 @@
+
+#ifndef PARROT_OPLIB_CORE_OPS_CG_H_GUARD
+#define PARROT_OPLIB_CORE_OPS_CG_H_GUARD
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/ops/core.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+#include "parrot/oplib/core_ops.h"
+
+#if PARROT_HAS_CGOTO
+opcode_t * core_cg_runops(PARROT_INTERP, ARGIN(opcode_t *cur_opcode));
+#endif
+
+
+#endif /* PARROT_OPLIB_CORE_OPS_CG_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
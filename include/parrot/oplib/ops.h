@@ -1144,7 +1144,9 @@ typedef enum {
     PARROT_OP_pass,                            /* 1127 */
     PARROT_OP_disable_preemption,              /* 1128 */
     PARROT_OP_enable_preemption,               /* 1129 */
-    PARROT_OP_terminate                        /* 1130 */
+    PARROT_OP_terminate,                       /* 1130 */
+    PARROT_OP_intern_s_s,                      /* 1131 */
+    PARROT_OP_intern_s_sc                      /* 1132 */
 
 } parrot_opcode_enums;
 
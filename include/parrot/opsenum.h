@@ -1144,6 +1144,8 @@ enum OPS_ENUM {
     enum_ops_disable_preemption            = 1128,
     enum_ops_enable_preemption             = 1129,
     enum_ops_terminate                     = 1130,
+    enum_ops_intern_s_s                    = 1131,
+    enum_ops_intern_s_sc                   = 1132,
 };
 
 
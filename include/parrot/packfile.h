@@ -175,6 +175,16 @@ typedef struct PackFile_ConstTagPair {
     opcode_t const_idx;
 } PackFile_ConstTagPair;
 
+/* PMC constants of a loaded table whose thawing waits for their first use */
+typedef struct PackFile_FrozenConstants {
+    const opcode_t             **images;  /* frozen image of each constant, NULL once thawed */
+    opcode_t                    *data;    /* private copy of the images, or NULL */
+    opcode_t                     count;   /* number of constants still frozen */
+    int                          loading; /* slots hold thaw lists while unpacking */
+    Parrot_Interp                interp;  /* interpreter owning the thawed PMCs */
+    struct PackFile_ConstTable  *next;    /* next table of interp with frozen constants */
+} PackFile_FrozenConstants;
+
 typedef struct PackFile_ConstTable {
     PackFile_Segment           base;
     struct {
@@ -194,8 +204,15 @@ typedef struct PackFile_ConstTable {
     Hash                  *pmc_hash;    /* Hash for lookup of pmc indices */
     PackFile_ConstTagPair *tag_map;     /* n-m Mapping pmc constants to string tags */
     opcode_t               ntags;       /* Number of tags */
+    PackFile_FrozenConstants *frozen;   /* PMC constants not thawed yet, or NULL */
 } PackFile_ConstTable;
 
+/* PMC constant idx of ct, thawed first if it is still frozen */
+#define PF_CONST_PMC(interp, ct, idx) \
+    ((ct)->pmc.constants[(idx)] \
+        ? (ct)->pmc.constants[(idx)] \
+        : Parrot_pf_ConstTable_thaw_pmc((interp), (ct), (idx)))
+
 typedef struct PackFile_ByteCode_OpMappingEntry {
     op_lib_t *lib;       /* library for this entry */
     opcode_t  n_ops;     /* number of ops used */
@@ -221,6 +238,9 @@ struct PackFile_ByteCode {
     op_info_t                   **op_info_table;
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
+    void                        **cgoto_code;      /* threaded code for the cgoto core */
+    size_t                        cgoto_size;      /* number of entries in cgoto_code */
+    void                         *cgoto_translate; /* cgoto label binding an op on first use */
 };
 
 typedef struct PackFile_DebugFilenameMapping {
@@ -280,7 +300,8 @@ typedef struct PackFile {
     PackFile_Directory  *dirp;        /* for freeing */
     const opcode_t      *src;         /* possible mmap()ed start of the PF */
     size_t               size;        /* size in bytes */
-    INTVAL               is_mmap_ped; /* don't free it, munmap it at destroy */
+    INTVAL               is_mmap_ped; /* don't free it, release mapping */
+    Parrot_File_Mapping *mapping;     /* shared with STRINGs pointing into it */
 
     PackFile_Header     *header;
 
@@ -339,6 +360,15 @@ INTVAL PF_fetch_integer(ARGIN(PackFile *pf), ARGIN(const opcode_t **stream))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING * PF_fetch_mapped_string(PARROT_INTERP,
+    ARGIN(PackFile *pf),
+    ARGIN(const opcode_t **cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 FLOATVAL PF_fetch_number(
     ARGIN_NULLOK(PackFile *pf),
@@ -439,6 +469,10 @@ opcode_t* PF_store_string(ARGOUT(opcode_t *cursor), ARGIN(const STRING *s))
 #define ASSERT_ARGS_PF_fetch_integer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pf) \
     , PARROT_ASSERT_ARG(stream))
+#define ASSERT_ARGS_PF_fetch_mapped_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_PF_fetch_number __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(stream))
 #define ASSERT_ARGS_PF_fetch_opcode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -1303,6 +1337,31 @@ void Parrot_pf_add_segment(PARROT_INTERP,
         FUNC_MODIFIES(*dir)
         FUNC_MODIFIES(*seg);
 
+PARROT_EXPORT
+void Parrot_pf_ConstTable_thaw_all(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_pf_ConstTable_thaw_backref(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct),
+    INTVAL constno,
+    INTVAL idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_pf_ConstTable_thaw_pmc(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct),
+    INTVAL idx)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
 PARROT_EXPORT
 void Parrot_pf_destroy_segment(PARROT_INTERP,
     ARGMOD(PackFile_Segment *self))
@@ -1347,6 +1406,10 @@ PackFile_Segment * Parrot_pf_new_segment(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*dir);
 
+PARROT_EXPORT
+void Parrot_pf_thaw_frozen_constants(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 void default_dump_header(PARROT_INTERP, ARGIN(const PackFile_Segment *self))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -1415,6 +1478,15 @@ const opcode_t * pf_segment_unpack(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(dir) \
     , PARROT_ASSERT_ARG(seg))
+#define ASSERT_ARGS_Parrot_pf_ConstTable_thaw_all __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
+#define ASSERT_ARGS_Parrot_pf_ConstTable_thaw_backref \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
+#define ASSERT_ARGS_Parrot_pf_ConstTable_thaw_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ct))
 #define ASSERT_ARGS_Parrot_pf_destroy_segment __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
@@ -1431,6 +1503,9 @@ const opcode_t * pf_segment_unpack(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(dir) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_pf_thaw_frozen_constants \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_default_dump_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
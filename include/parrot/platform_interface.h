@@ -120,6 +120,19 @@ INTVAL Parrot_io_internal_recv(PARROT_INTERP, PIOHANDLE handle, ARGOUT(char *buf
 INTVAL Parrot_io_internal_poll(PARROT_INTERP, PIOHANDLE handle, int which, int sec, int usec);
 INTVAL Parrot_io_internal_close_socket(PARROT_INTERP, PIOHANDLE handle);
 
+typedef struct Parrot_io_reactor Parrot_io_reactor;
+
+PARROT_CANNOT_RETURN_NULL
+Parrot_io_reactor *Parrot_io_internal_reactor_new(PARROT_INTERP);
+void Parrot_io_internal_reactor_destroy(ARGFREE(Parrot_io_reactor *reactor));
+INTVAL Parrot_io_internal_reactor_add(PARROT_INTERP, ARGMOD(Parrot_io_reactor *reactor),
+        PIOHANDLE handle, INTVAL which);
+void Parrot_io_internal_reactor_remove(PARROT_INTERP, ARGMOD(Parrot_io_reactor *reactor),
+        PIOHANDLE handle);
+INTVAL Parrot_io_internal_reactor_wait(PARROT_INTERP, ARGMOD(Parrot_io_reactor *reactor),
+        ARGOUT(PIOHANDLE *ready), INTVAL max, FLOATVAL timeout);
+void Parrot_io_internal_reactor_wake(ARGMOD(Parrot_io_reactor *reactor));
+
 /*
  * Files and directories
  */
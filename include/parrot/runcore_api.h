@@ -140,6 +140,9 @@ oplib_init_f get_core_op_lib_init(PARROT_INTERP,
     ARGIN(Parrot_runcore_t *runcore))
         __attribute__nonnull__(2);
 
+void Parrot_runcore_cgoto_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 void Parrot_runcore_debugger_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -157,6 +160,8 @@ void Parrot_runcore_slow_init(PARROT_INTERP)
 
 #define ASSERT_ARGS_get_core_op_lib_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_debugger_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_exec_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -45,6 +45,15 @@ void Parrot_cx_schedule_immediate(PARROT_INTERP, ARGIN(PMC *task_or_sub))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_cx_schedule_io(PARROT_INTERP,
+    ARGIN(PMC *handle),
+    INTVAL which,
+    ARGIN_NULLOK(PMC *task_or_sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -72,6 +81,16 @@ PMC* Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+void Parrot_cx_cancel_io(PARROT_INTERP, ARGIN(PMC *handle))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_cx_check_io(PARROT_INTERP,
+    ARGIN(PMC *scheduler),
+    FLOATVAL timeout)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 void Parrot_cx_check_quantum(PARROT_INTERP, ARGIN(PMC *scheduler))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -95,6 +114,10 @@ void Parrot_cx_enable_preemption(PARROT_INTERP)
 void Parrot_cx_init_scheduler(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_cx_io_waiting(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 void Parrot_cx_next_task(PARROT_INTERP, ARGIN(PMC *scheduler))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -135,6 +158,9 @@ void Parrot_cx_set_scheduler_alarm(PARROT_INTERP)
 #define ASSERT_ARGS_Parrot_cx_schedule_immediate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(task_or_sub))
+#define ASSERT_ARGS_Parrot_cx_schedule_io __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle))
 #define ASSERT_ARGS_Parrot_cx_schedule_sleep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_schedule_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -147,6 +173,12 @@ void Parrot_cx_set_scheduler_alarm(PARROT_INTERP)
 #define ASSERT_ARGS_Parrot_cx_stop_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(next))
+#define ASSERT_ARGS_Parrot_cx_cancel_io __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle))
+#define ASSERT_ARGS_Parrot_cx_check_io __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
 #define ASSERT_ARGS_Parrot_cx_check_quantum __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(scheduler))
@@ -161,6 +193,8 @@ void Parrot_cx_set_scheduler_alarm(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_init_scheduler __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_cx_io_waiting __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_next_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(scheduler))
@@ -84,6 +84,15 @@ typedef enum {
 #define TASK_recv_block_SET(o)   TASK_flag_SET(recv_block, o)
 #define TASK_recv_block_CLEAR(o) TASK_flag_CLEAR(recv_block, o)
 
+/*
+ * Tasks added to a scheduler, possibly by other threads, wait in a lock-free
+ * stack of these until the owning interpreter moves them to its task queue.
+ */
+typedef struct Scheduler_incoming {
+    struct Scheduler_incoming *next;
+    PMC                       *task;
+    int                        immediate;   /* unshift instead of push */
+} Scheduler_incoming;
 
 #endif /* PARROT_SCHEDULER_PRIVATE_H_GUARD */
 
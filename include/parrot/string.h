@@ -70,6 +70,18 @@
 #define STRING_iter_set_and_advance(i, str, iter, c) \
     ((str)->encoding)->iter_set_and_advance((i), (str), (iter), (c))
 
+/* Set on the STRINGs in the interpreter's intern table, see Parrot_str_intern */
+#define PObj_interned_FLAG PObj_private0_FLAG
+#define PObj_interned_TEST(o) PObj_flag_TEST(interned, o)
+#define PObj_interned_SET(o) PObj_flag_SET(interned, o)
+#define PObj_interned_CLEAR(o) PObj_flag_CLEAR(interned, o)
+
+/* Set on external STRINGs pointing into a Parrot_File_Mapping, see
+   Parrot_str_new_mapping */
+#define PObj_mapped_FLAG PObj_private1_FLAG
+#define PObj_mapped_TEST(o) PObj_flag_TEST(mapped, o)
+#define PObj_mapped_CLEAR(o) PObj_flag_CLEAR(mapped, o)
+
 /* stringinfo parameters */
 
 /* &gen_from_def(stringinfo.pasm) */
@@ -91,6 +103,14 @@ typedef struct string_iterator_t {
     UINTVAL charpos;
 } String_iter;
 
+/* A file mapping STRINGs point into, unmapped when the last reference goes */
+typedef struct _Parrot_File_Mapping {
+    struct _Parrot_File_Mapping *next;
+    char                        *start;
+    size_t                       size;
+    size_t                       refs;
+} Parrot_File_Mapping;
+
 typedef struct _Parrot_String_Bounds {
     UINTVAL bytes;
     INTVAL  chars;
@@ -25,7 +25,7 @@
 
 #include "parrot/atomic.h"
 
-#define MAX_THREADS 16
+#define MAX_THREADS 32
 
 #ifndef YIELD
 #  define YIELD
@@ -47,6 +47,24 @@ typedef enum {
 } thread_state_enum;
 
 
+/*
+ * Chase-Lev work stealing deque of Tasks.  The owning interpreter pushes and
+ * pops at the bottom, idle threads steal from the top.  Buffers are only ever
+ * replaced by bigger ones; the outgrown ones are kept in the prev list, as a
+ * thief may still be reading from them.
+ */
+typedef struct _Task_deque_buffer {
+    struct _Task_deque_buffer *prev;
+    INTVAL                     mask;    /* size - 1, the size is a power of 2 */
+    PMC                      **items;
+} Task_deque_buffer;
+
+typedef struct _Task_deque {
+    Parrot_atomic_integer top;          /* next index to steal */
+    Parrot_atomic_integer bottom;       /* next index to push */
+    Parrot_atomic_pointer buffer;       /* current Task_deque_buffer */
+} Task_deque;
+
 /*
  * per interpreter thread data structure
  */
@@ -67,6 +85,12 @@ typedef struct _Thread_data {
      * of sleeping
      */
     Parrot_cond  interp_cond;
+
+    /* tasks scheduled by this interpreter, see Parrot_thread_schedule_task */
+    Task_deque   tasks;
+
+    /* set while the thread waits for tasks to steal */
+    Parrot_atomic_integer idle;
 } Thread_data;
 
 #  define LOCK_INTERPRETER(interp) \
@@ -165,6 +189,7 @@ PMC * Parrot_thread_make_local_copy(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+void Parrot_thread_notify_idle_thread(PARROT_INTERP);
 void Parrot_thread_notify_thread(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -177,12 +202,9 @@ int Parrot_thread_run(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*thread_interp_pmc);
 
-void Parrot_thread_schedule_task(PARROT_INTERP,
-    ARGIN(Interp *thread_interp),
-    ARGIN(PMC *task))
+void Parrot_thread_schedule_task(PARROT_INTERP, ARGIN(PMC *task))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
+        __attribute__nonnull__(2);
 
 PARROT_CAN_RETURN_NULL
 PMC * Parrot_thread_transfer_sub(
@@ -229,6 +251,8 @@ void Parrot_thread_wait_for_notification(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(from) \
     , PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_Parrot_thread_notify_idle_thread \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_thread_notify_thread __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_thread_notify_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
@@ -237,7 +261,6 @@ void Parrot_thread_wait_for_notification(PARROT_INTERP)
     , PARROT_ASSERT_ARG(thread_interp_pmc))
 #define ASSERT_ARGS_Parrot_thread_schedule_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(thread_interp) \
     , PARROT_ASSERT_ARG(task))
 #define ASSERT_ARGS_Parrot_thread_transfer_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(destination) \
@@ -79,6 +79,9 @@ Compile Options:
    --no-line-directives Disable creation of C #line directives
    --define=inet_aton   Quick hack to use inet_aton instead of inet_pton
    --gc=(type)          Which implementation of GC to use. One of gms, ms, ms2 or inf.
+   --hash-function=(type)
+                        Which string hash function to use. One of siphash13
+                        or bernstein.
 
 Parrot Options:
 
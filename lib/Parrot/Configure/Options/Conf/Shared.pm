@@ -33,6 +33,7 @@ our @shared_valid_options = qw{
     fatal-step
     floatval
     gc
+    hash-function
     help
     hintsfile
     icu-config
@@ -74,6 +75,7 @@ our @shared_valid_options = qw{
     verbose-step
     version
     with-llvm
+    without-cgoto
     without-crypto
     without-core-nci-thunks
     without-extra-nci-thunks
@@ -37,6 +37,7 @@ my @steps = qw(
     auto::llvm
     auto::inline
     auto::gc
+    auto::hash
     auto::memalign
     auto::signal
     auto::socklen_t
@@ -64,6 +65,7 @@ my @steps = qw(
     auto::platform
     auto::alignof
     auto::expect
+    auto::cgoto
     auto::warnings
     gen::config_h
     gen::core_pmcs
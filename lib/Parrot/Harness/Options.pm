@@ -82,6 +82,7 @@ sub remap_runcore_opts
     my %remap      = (
         'j' => '-runcore=fast',
         'f' => '-runcore=fast',
+        'g' => '-runcore=cgoto',
         'b' => '-runcore=bounds',
         's' => '-runcore=bounds', # =slow
         #'G' => '-runcore=gcdebug',
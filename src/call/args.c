@@ -52,6 +52,11 @@ typedef struct pcc_funcs_ptr {
     pmc_func_t      pmc_constant;
 } pcc_funcs_ptr;
 
+/* Cached on the FixedIntegerArray of a set_args, get_params, set_returns or
+   get_results op by is_positional_signature(). */
+#define PCC_SIG_shape_known_FLAG PObj_private0_FLAG
+#define PCC_SIG_positional_FLAG  PObj_private1_FLAG
+
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -64,6 +69,13 @@ static void assign_default_param_value(PARROT_INTERP,
         __attribute__nonnull__(4)
         __attribute__nonnull__(5);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static Pcc_signature * compile_signature(PARROT_INTERP,
+    ARGIN(const char *signature))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void dissect_aggregate_arg(PARROT_INTERP,
     ARGMOD(PMC *call_object),
     ARGIN(PMC *aggregate))
@@ -97,6 +109,9 @@ static void fill_params(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*call_object);
 
+static void free_signature(PARROT_INTERP, ARGFREE(Pcc_signature *sig))
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 static INTVAL intval_constant_from_op(PARROT_INTERP,
     ARGIN(const opcode_t *raw_params),
@@ -124,6 +139,11 @@ static INTVAL* intval_param_from_op(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL is_positional_signature(PARROT_INTERP, ARGIN(PMC *raw_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_COLD
 PARROT_DOES_NOT_RETURN
 static void named_argument_arity_error(PARROT_INTERP,
@@ -201,12 +221,14 @@ static PMC** pmc_param_from_op(PARROT_INTERP,
 
 static void set_call_from_varargs(PARROT_INTERP,
     ARGIN(PMC *signature),
+    ARGIN(PMC *arg_flags),
     ARGIN(const char *sig),
     ARGMOD(va_list *args))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
         FUNC_MODIFIES(*args);
 
 PARROT_WARN_UNUSED_RESULT
@@ -243,6 +265,9 @@ static STRING** string_param_from_op(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(arg_info) \
     , PARROT_ASSERT_ARG(accessor))
+#define ASSERT_ARGS_compile_signature __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(signature))
 #define ASSERT_ARGS_dissect_aggregate_arg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(call_object) \
@@ -258,6 +283,8 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(raw_sig) \
     , PARROT_ASSERT_ARG(arg_info) \
     , PARROT_ASSERT_ARG(accessor))
+#define ASSERT_ARGS_free_signature __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_intval_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(raw_params))
 #define ASSERT_ARGS_intval_constant_from_varargs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -267,6 +294,9 @@ static STRING** string_param_from_op(PARROT_INTERP,
 #define ASSERT_ARGS_intval_param_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_is_positional_signature __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig))
 #define ASSERT_ARGS_named_argument_arity_error __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(named_arg_list))
@@ -297,6 +327,7 @@ static STRING** string_param_from_op(PARROT_INTERP,
 #define ASSERT_ARGS_set_call_from_varargs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(signature) \
+    , PARROT_ASSERT_ARG(arg_flags) \
     , PARROT_ASSERT_ARG(sig) \
     , PARROT_ASSERT_ARG(args))
 #define ASSERT_ARGS_string_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -312,6 +343,19 @@ static STRING** string_param_from_op(PARROT_INTERP,
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
+/* Accessors for parameters filled from C varargs. */
+static const pcc_funcs_ptr varargs_funcs = {
+    (intval_ptr_func_t)intval_param_from_c_args,
+    (numval_ptr_func_t)numval_param_from_c_args,
+    (string_ptr_func_t)string_param_from_c_args,
+    (pmc_ptr_func_t)pmc_param_from_c_args,
+
+    (intval_func_t)intval_constant_from_varargs,
+    (numval_func_t)numval_constant_from_varargs,
+    (string_func_t)string_constant_from_varargs,
+    (pmc_func_t)pmc_constant_from_varargs,
+};
+
 /*
 
 =item C<PMC* Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, PMC *signature,
@@ -352,6 +396,12 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
     GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
     GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
 
+    if (is_positional_signature(interp, raw_sig)) {
+        Parrot_pcc_push_positionals_from_op(interp, call_object, ctx,
+                int_array, raw_args, arg_count);
+        return call_object;
+    }
+
     for (; arg_index < arg_count; ++arg_index) {
         const INTVAL arg_flags = int_array[arg_index];
         const int constant = 0 != PARROT_ARG_CONSTANT_ISSET(arg_flags);
@@ -569,10 +619,11 @@ Parrot_pcc_build_call_from_c_args(PARROT_INTERP,
 
 /*
 
-=item C<static void set_call_from_varargs(PARROT_INTERP, PMC *signature, const
-char *sig, va_list *args)>
+=item C<static void set_call_from_varargs(PARROT_INTERP, PMC *signature, PMC
+*arg_flags, const char *sig, va_list *args)>
 
 Helper for C<Parrot_pcc_build_call_from_varargs> and C<Parrot_pcc_set_call_from_varargs>.
+C<arg_flags> is the parsed form of C<sig>.
 
 =cut
 
@@ -580,14 +631,12 @@ Helper for C<Parrot_pcc_build_call_from_varargs> and C<Parrot_pcc_set_call_from_
 
 static void
 set_call_from_varargs(PARROT_INTERP,
-        ARGIN(PMC *signature), ARGIN(const char *sig),
+        ARGIN(PMC *signature), ARGIN(PMC *arg_flags), ARGIN(const char *sig),
         ARGMOD(va_list *args))
 {
     ASSERT_ARGS(set_call_from_varargs)
-    PMC         *arg_flags    = PMCNULL;
     INTVAL       i            = 0;
 
-    parse_signature_string(interp, sig, &arg_flags);
     SETATTR_CallContext_arg_flags(interp, signature, arg_flags);
 
     /* Process the varargs list */
@@ -660,7 +709,8 @@ Parrot_pcc_set_call_from_varargs(PARROT_INTERP,
     ASSERT_ARGS(Parrot_pcc_set_call_from_varargs)
     PARROT_ASSERT(PMCNULL != signature);
     Parrot_CallContext_morph(interp, signature, PMCNULL);
-    set_call_from_varargs(interp, signature, sig, args);
+    set_call_from_varargs(interp, signature,
+            Parrot_pcc_signature_lookup(interp, sig)->arg_flags, sig, args);
 }
 
 /*
@@ -694,7 +744,8 @@ Parrot_pcc_build_call_from_varargs(PARROT_INTERP,
         Parrot_CallContext_morph(interp, call_object, PMCNULL);
     }
 
-    set_call_from_varargs(interp, call_object, sig, args);
+    set_call_from_varargs(interp, call_object,
+            Parrot_pcc_signature_lookup(interp, sig)->arg_flags, sig, args);
 
     return call_object;
 }
@@ -720,7 +771,6 @@ Parrot_pcc_build_sig_object_from_varargs(PARROT_INTERP, ARGIN_NULLOK(PMC *obj),
         ARGIN(const char *sig), va_list args)
 {
     ASSERT_ARGS(Parrot_pcc_build_sig_object_from_varargs)
-    PMC         * arg_flags         = PMCNULL;
     PMC         * const call_object = Parrot_pmc_new(interp, enum_class_CallContext);
     INTVAL       in_return_sig      = 0;
     INTVAL       i;
@@ -730,8 +780,8 @@ Parrot_pcc_build_sig_object_from_varargs(PARROT_INTERP, ARGIN_NULLOK(PMC *obj),
     if (*sig == '-' || *sig == '\0')
         return call_object;
 
-    parse_signature_string(interp, sig, &arg_flags);
-    SETATTR_CallContext_arg_flags(interp, call_object, arg_flags);
+    SETATTR_CallContext_arg_flags(interp, call_object,
+            Parrot_pcc_signature_lookup(interp, sig)->arg_flags);
 
     /* Process the varargs list */
     for (i = 0; sig[i] != '\0'; ++i) {
@@ -1327,11 +1377,66 @@ Parrot_pcc_fill_params_from_op(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
         (pmc_func_t)pmc_constant_from_op,
     };
 
+    if (!PMC_IS_NULL(call_object) && is_positional_signature(interp, raw_sig)) {
+        INTVAL *int_array;
+        INTVAL  param_count;
+
+        GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+        GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+
+        if (Parrot_pcc_fill_positionals_from_op(interp, call_object,
+                int_array, raw_params, param_count))
+            return;
+    }
+
     fill_params(interp, call_object, raw_sig, raw_params, &function_pointers, direction);
 }
 
 /*
 
+=item C<static INTVAL is_positional_signature(PARROT_INTERP, PMC *raw_sig)>
+
+Returns true if every entry of the op signature C<raw_sig> is a plain
+positional INTVAL, FLOATVAL, STRING or PMC: no names, flattening, slurpy,
+optional or C<:call_sig> flags.  Such calls can skip the generic argument
+walk.  The answer is cached in flags on C<raw_sig>, which is a constant.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+is_positional_signature(PARROT_INTERP, ARGIN(PMC *raw_sig))
+{
+    ASSERT_ARGS(is_positional_signature)
+
+    if (!(PObj_get_FLAGS(raw_sig) & PCC_SIG_shape_known_FLAG)) {
+        const INTVAL plain = PARROT_ARG_TYPE_MASK
+                           | PARROT_ARG_CONSTANT
+                           | PARROT_ARG_INVOCANT;
+        INTVAL *int_array;
+        INTVAL  count, i;
+
+        GETATTR_FixedIntegerArray_size(interp, raw_sig, count);
+        GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+
+        for (i = 0; i < count; ++i) {
+            const INTVAL flags = int_array[i];
+            if ((flags & ~plain) || PARROT_ARG_TYPE(flags) > PARROT_ARG_FLOATVAL)
+                break;
+        }
+
+        if (i == count)
+            PObj_get_FLAGS(raw_sig) |= PCC_SIG_positional_FLAG;
+        PObj_get_FLAGS(raw_sig) |= PCC_SIG_shape_known_FLAG;
+    }
+
+    return 0 != (PObj_get_FLAGS(raw_sig) & PCC_SIG_positional_FLAG);
+}
+
+/*
+
 =item C<void Parrot_pcc_fill_params_from_c_args(PARROT_INTERP, PMC *call_object,
 const char *signature, ...)>
 
@@ -1388,27 +1493,67 @@ Parrot_pcc_fill_params_from_varargs(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_objec
         ARGIN(const char *signature), ARGMOD(va_list *args), Errors_classes direction)
 {
     ASSERT_ARGS(Parrot_pcc_fill_params_from_varargs)
-    PMC    *raw_sig  = PMCNULL;
-    static const pcc_funcs_ptr function_pointers = {
-        (intval_ptr_func_t)intval_param_from_c_args,
-        (numval_ptr_func_t)numval_param_from_c_args,
-        (string_ptr_func_t)string_param_from_c_args,
-        (pmc_ptr_func_t)pmc_param_from_c_args,
-
-        (intval_func_t)intval_constant_from_varargs,
-        (numval_func_t)numval_constant_from_varargs,
-        (string_func_t)string_constant_from_varargs,
-        (pmc_func_t)pmc_constant_from_varargs,
-    };
 
     /* empty args or empty returns */
     if (*signature == '-' || *signature == '\0')
         return;
 
-    parse_signature_string(interp, signature, &raw_sig);
+    fill_params(interp, call_object,
+            Parrot_pcc_signature_lookup(interp, signature)->arg_flags,
+            args, &varargs_funcs, direction);
+}
+
+/*
+
+=item C<PMC* Parrot_pcc_build_call_from_signature(PARROT_INTERP, const
+Pcc_signature *sig, va_list *args)>
+
+Like C<Parrot_pcc_build_call_from_varargs>, for the arguments of a
+signature made by C<Parrot_pcc_signature_new>.
 
-    fill_params(interp, call_object, raw_sig, args, &function_pointers,
-            direction);
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC*
+Parrot_pcc_build_call_from_signature(PARROT_INTERP, ARGIN(const Pcc_signature *sig),
+        ARGMOD(va_list *args))
+{
+    ASSERT_ARGS(Parrot_pcc_build_call_from_signature)
+    PMC * const call_object = Parrot_pmc_new(interp, enum_class_CallContext);
+
+    set_call_from_varargs(interp, call_object, sig->arg_flags, sig->string, args);
+
+    return call_object;
+}
+
+/*
+
+=item C<void Parrot_pcc_fill_returns_from_signature(PARROT_INTERP, PMC
+*call_object, const Pcc_signature *sig, va_list *args)>
+
+Like C<Parrot_pcc_fill_params_from_varargs>, for the returns of a signature
+made by C<Parrot_pcc_signature_new>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_fill_returns_from_signature(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
+        ARGIN(const Pcc_signature *sig), ARGMOD(va_list *args))
+{
+    ASSERT_ARGS(Parrot_pcc_fill_returns_from_signature)
+
+    if (*sig->return_sig == '\0')
+        return;
+
+    fill_params(interp, call_object, sig->return_flags, args, &varargs_funcs,
+            PARROT_ERRORS_RESULT_COUNT_FLAG);
 }
 
 /*
@@ -1575,6 +1720,258 @@ Parrot_pcc_parse_signature_string(PARROT_INTERP, ARGIN(STRING *signature),
 
 /*
 
+=item C<Pcc_signature * Parrot_pcc_signature_new(PARROT_INTERP, const char
+*signature)>
+
+Parses a C signature string such as C<"PiP-E<gt>I"> once, for use with
+C<Parrot_pcc_invoke_sub_from_signature> and
+C<Parrot_pcc_invoke_method_from_signature> by code that makes the same call
+many times.  The flag arrays are registered with the GC until the result is
+given to C<Parrot_pcc_signature_destroy>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Pcc_signature *
+Parrot_pcc_signature_new(PARROT_INTERP, ARGIN(const char *signature))
+{
+    ASSERT_ARGS(Parrot_pcc_signature_new)
+    Pcc_signature * const sig = compile_signature(interp, signature);
+
+    Parrot_pcc_signature_method_flags(interp, sig);
+    Parrot_pmc_gc_register(interp, sig->arg_flags);
+    Parrot_pmc_gc_register(interp, sig->return_flags);
+    Parrot_pmc_gc_register(interp, sig->method_flags);
+
+    return sig;
+}
+
+/*
+
+=item C<void Parrot_pcc_signature_destroy(PARROT_INTERP, Pcc_signature *sig)>
+
+Frees a signature made by C<Parrot_pcc_signature_new>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_signature_destroy(PARROT_INTERP, ARGFREE(Pcc_signature *sig))
+{
+    ASSERT_ARGS(Parrot_pcc_signature_destroy)
+
+    if (!sig)
+        return;
+
+    Parrot_pmc_gc_unregister(interp, sig->arg_flags);
+    Parrot_pmc_gc_unregister(interp, sig->return_flags);
+    Parrot_pmc_gc_unregister(interp, sig->method_flags);
+    free_signature(interp, sig);
+}
+
+/*
+
+=item C<Pcc_signature * Parrot_pcc_signature_lookup(PARROT_INTERP, const char
+*signature)>
+
+Returns the parsed form of C<signature> from the interpreter's cache,
+parsing it on a miss.  Nearly all signatures passed from C are string
+literals, so the cache is keyed on the address of the string and a hit
+costs one string comparison.  The result belongs to the cache and may be
+replaced by the next lookup, so it must not be kept across calls that can
+run code.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Pcc_signature *
+Parrot_pcc_signature_lookup(PARROT_INTERP, ARGIN(const char *signature))
+{
+    ASSERT_ARGS(Parrot_pcc_signature_lookup)
+    Pcc_signature_cache * const cache = interp->pcc_signatures;
+    const UINTVAL addr = (UINTVAL)signature;
+    const UINTVAL slot = (addr ^ (addr >> 7)) & (PCC_SIGNATURE_CACHE_SIZE - 1);
+    Pcc_signature *sig = cache->entries[slot];
+
+    if (sig && cache->keys[slot] == signature && STREQ(sig->string, signature))
+        return sig;
+
+    sig                  = compile_signature(interp, signature);
+    cache->keys[slot]    = signature;
+    if (cache->entries[slot])
+        free_signature(interp, cache->entries[slot]);
+    cache->entries[slot] = sig;
+
+    return sig;
+}
+
+/*
+
+=item C<PMC * Parrot_pcc_signature_method_flags(PARROT_INTERP, Pcc_signature
+*sig)>
+
+Returns the argument flags of C<sig> with an invocant in front, as used for
+method calls made from C.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_pcc_signature_method_flags(PARROT_INTERP, ARGMOD(Pcc_signature *sig))
+{
+    ASSERT_ARGS(Parrot_pcc_signature_method_flags)
+
+    if (!sig->method_flags) {
+        PMC * const flags = VTABLE_clone(interp, sig->arg_flags);
+        VTABLE_unshift_integer(interp, flags, PARROT_ARG_PMC | PARROT_ARG_INVOCANT);
+        sig->method_flags = flags;
+    }
+
+    return sig->method_flags;
+}
+
+/*
+
+=item C<Pcc_signature_cache * Parrot_pcc_signature_cache_create(PARROT_INTERP)>
+
+Creates the cache of parsed signatures for an interpreter.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Pcc_signature_cache *
+Parrot_pcc_signature_cache_create(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_signature_cache_create)
+    return mem_gc_allocate_zeroed_typed(interp, Pcc_signature_cache);
+}
+
+/*
+
+=item C<void Parrot_pcc_signature_cache_destroy(PARROT_INTERP,
+Pcc_signature_cache *cache)>
+
+Frees a signature cache and the signatures in it.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_signature_cache_destroy(PARROT_INTERP, ARGFREE(Pcc_signature_cache *cache))
+{
+    ASSERT_ARGS(Parrot_pcc_signature_cache_destroy)
+    INTVAL i;
+
+    if (!cache)
+        return;
+
+    for (i = 0; i < PCC_SIGNATURE_CACHE_SIZE; ++i)
+        if (cache->entries[i])
+            free_signature(interp, cache->entries[i]);
+
+    mem_gc_free(interp, cache);
+}
+
+/*
+
+=item C<void Parrot_pcc_signature_cache_mark(PARROT_INTERP, Pcc_signature_cache
+*cache)>
+
+Marks the flag arrays of the cached signatures as alive.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_signature_cache_mark(PARROT_INTERP, ARGIN(Pcc_signature_cache *cache))
+{
+    ASSERT_ARGS(Parrot_pcc_signature_cache_mark)
+    INTVAL i;
+
+    for (i = 0; i < PCC_SIGNATURE_CACHE_SIZE; ++i) {
+        Pcc_signature * const sig = cache->entries[i];
+
+        if (sig) {
+            Parrot_gc_mark_PMC_alive(interp, sig->arg_flags);
+            Parrot_gc_mark_PMC_alive(interp, sig->return_flags);
+            if (sig->method_flags)
+                Parrot_gc_mark_PMC_alive(interp, sig->method_flags);
+        }
+    }
+}
+
+/*
+
+=item C<static Pcc_signature * compile_signature(PARROT_INTERP, const char
+*signature)>
+
+Parses C<signature> into a new C<Pcc_signature>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static Pcc_signature *
+compile_signature(PARROT_INTERP, ARGIN(const char *signature))
+{
+    ASSERT_ARGS(compile_signature)
+    Pcc_signature *sig;
+    const char    *arg_sig, *ret_sig;
+    PMC           *arg_flags    = PMCNULL;
+    PMC           *return_flags = PMCNULL;
+
+    /* Parse first, so that an invalid signature leaks nothing */
+    Parrot_pcc_split_signature_string(signature, &arg_sig, &ret_sig);
+    parse_signature_string(interp, arg_sig, &arg_flags);
+    parse_signature_string(interp, ret_sig, &return_flags);
+
+    sig               = mem_gc_allocate_zeroed_typed(interp, Pcc_signature);
+    sig->string       = mem_sys_strdup(signature);
+    sig->return_sig   = sig->string + (ret_sig - signature);
+    sig->arg_flags    = arg_flags;
+    sig->return_flags = return_flags;
+
+    return sig;
+}
+
+/*
+
+=item C<static void free_signature(PARROT_INTERP, Pcc_signature *sig)>
+
+Frees C<sig>.  Its flag arrays are left to the GC.
+
+=cut
+
+*/
+
+static void
+free_signature(PARROT_INTERP, ARGFREE(Pcc_signature *sig))
+{
+    ASSERT_ARGS(free_signature)
+    mem_sys_free(sig->string);
+    mem_gc_free(interp, sig);
+}
+
+/*
+
 =item C<void Parrot_pcc_merge_signature_for_tailcall(PARROT_INTERP, PMC *parent,
 PMC *tailcall)>
 
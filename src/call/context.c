@@ -259,6 +259,7 @@ init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         ctx->num_constants     = NULL;
         ctx->str_constants     = NULL;
         ctx->pmc_constants     = NULL;
+        ctx->const_table       = NULL;
         ctx->warns             = 0;
         ctx->errors            = 0;
         ctx->trace_flags       = 0;
@@ -272,6 +273,7 @@ init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         ctx->num_constants     = old->num_constants;
         ctx->str_constants     = old->str_constants;
         ctx->pmc_constants     = old->pmc_constants;
+        ctx->const_table       = old->const_table;
         ctx->warns             = old->warns;
         ctx->errors            = old->errors;
         ctx->trace_flags       = old->trace_flags;
@@ -498,7 +500,8 @@ Parrot_pcc_allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx),
 
 =item C<void Parrot_pcc_free_registers(PARROT_INTERP, PMC *pmcctx)>
 
-Free memory allocated for registers in Context.
+Free memory allocated for registers in Context.  The Context is left without
+registers, so the GC doesn't look at the freed memory.
 
 =cut
 
@@ -515,6 +518,46 @@ Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
 
     if (reg_size)
         Parrot_gc_free_fixed_size_storage(interp, reg_size, ctx->registers);
+
+    ctx->registers    = NULL;
+    ctx->bp.regs_i    = NULL;
+    ctx->bp_ps.regs_s = NULL;
+    memset(ctx->n_regs_used, 0, sizeof (ctx->n_regs_used));
+}
+
+
+/*
+
+=item C<void Parrot_pcc_release_registers(PARROT_INTERP, PMC *pmcctx)>
+
+Frees the registers of a Context that just returned, so that the next call can
+reuse them while they are still in the cache.  This happens in last in, first
+out order, like a stack of register frames.
+
+Registers of a Context that can still be entered again are left to the GC:
+those of coroutines, of outer subs, of Contexts with a LexPad and of any a
+continuation captured (see C<CALLSIGNATURE_is_captured_FLAG>).
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_release_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_release_registers)
+    Parrot_CallContext_attributes * const ctx = PARROT_CALLCONTEXT(pmcctx);
+    PMC * const sub = ctx->current_sub;
+
+    if (CALLSIGNATURE_is_captured_TEST(pmcctx)
+    ||  !PMC_IS_NULL(ctx->lex_pad)
+    ||  PMC_IS_NULL(sub)
+    ||  sub->vtable->base_type != enum_class_Sub
+    ||  PObj_get_FLAGS(sub) & SUB_FLAG_IS_OUTER)
+        return;
+
+    Parrot_pcc_free_registers(interp, pmcctx);
 }
 
 
@@ -889,7 +932,7 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
     }
 
     if (!reuse || !PMC_data(cont)) {
-        cont = Parrot_pmc_new(interp, enum_class_Continuation);
+        cont = Parrot_pcc_new_return_continuation(interp);
 #ifndef NDEBUG
         if (Interp_trace_TEST(interp, PARROT_TRACE_CORO_STATE_FLAG))
             Parrot_io_eprintf(interp, "# continuation not reused\n");
@@ -911,6 +954,35 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
 
 /*
 
+=item C<PMC * Parrot_pcc_new_return_continuation(PARROT_INTERP)>
+
+Creates a Continuation to return to the current context from a call it makes.
+Unlike other continuations, it doesn't mark the context as captured: it only
+gets invoked while the context is still running.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_pcc_new_return_continuation(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_new_return_continuation)
+    PMC * const ctx      = CURRENT_CONTEXT(interp);
+    const int   captured = CALLSIGNATURE_is_captured_TEST(ctx) != 0;
+    PMC * const cont     = Parrot_pmc_new(interp, enum_class_Continuation);
+
+    if (!captured)
+        CALLSIGNATURE_is_captured_CLEAR(ctx);
+
+    return cont;
+}
+
+/*
+
 =item C<static void set_context(PARROT_INTERP, PMC *ctx)>
 
 Helper function to set breakpoint to.
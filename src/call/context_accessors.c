@@ -56,7 +56,7 @@ Parrot_pcc_get_context_struct_func(SHIM_INTERP, ARGIN_NULLOK(PMC *ctx))
 
 =item C<PMC ** Parrot_pcc_get_pmc_constants_func(PARROT_INTERP, const PMC *ctx)>
 
-=item C<void Parrot_pcc_set_constants_func(PARROT_INTERP, PMC *ctx, const struct
+=item C<void Parrot_pcc_set_constants_func(PARROT_INTERP, PMC *ctx, struct
 PackFile_ConstTable *ct)>
 
 Get/set constants from context.
@@ -100,7 +100,7 @@ PARROT_EXPORT
 PARROT_CAN_RETURN_NULL
 void
 Parrot_pcc_set_constants_func(SHIM_INTERP, ARGIN(PMC *ctx),
-        ARGIN(const struct PackFile_ConstTable *ct))
+        ARGIN(struct PackFile_ConstTable *ct))
 {
     ASSERT_ARGS(Parrot_pcc_set_constants_func)
     Parrot_Context * const c = CONTEXT_STRUCT(ctx);
@@ -108,6 +108,7 @@ Parrot_pcc_set_constants_func(SHIM_INTERP, ARGIN(PMC *ctx),
     c->num_constants = ct->num.constants;
     c->str_constants = ct->str.constants;
     c->pmc_constants = ct->pmc.constants;
+    c->const_table   = ct;
 }
 
 /*
@@ -724,14 +725,16 @@ Parrot_pcc_get_string_constant_func(SHIM_INTERP, ARGIN(const PMC *ctx), INTVAL i
 }
 
 PARROT_EXPORT
-PARROT_PURE_FUNCTION
 PARROT_CAN_RETURN_NULL
 PMC*
-Parrot_pcc_get_pmc_constant_func(SHIM_INTERP, ARGIN(const PMC *ctx), INTVAL idx)
+Parrot_pcc_get_pmc_constant_func(PARROT_INTERP, ARGIN(const PMC *ctx), INTVAL idx)
 {
     ASSERT_ARGS(Parrot_pcc_get_pmc_constant_func)
+    Parrot_Context * const c = CONTEXT_STRUCT(ctx);
     PARROT_ASSERT(ctx->vtable->base_type == enum_class_CallContext);
-    return CONTEXT_STRUCT(ctx)->pmc_constants[idx];
+    if (c->pmc_constants[idx])
+        return c->pmc_constants[idx];
+    return Parrot_pf_ConstTable_thaw_pmc(interp, c->const_table, idx);
 }
 
 /*
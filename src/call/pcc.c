@@ -170,9 +170,11 @@ Parrot_pcc_invoke_method_from_c_args(PARROT_INTERP, ARGIN(PMC* pmc),
     va_start(args, signature);
     call_obj = Parrot_pcc_build_call_from_varargs(interp, PMCNULL, arg_sig, &args);
 
-    /* inlined version of pcc_add_invocant */
-    arg_flags = PARROT_CALLCONTEXT(call_obj)->arg_flags;
-    VTABLE_unshift_integer(interp, arg_flags, PARROT_ARG_PMC | PARROT_ARG_INVOCANT);
+    /* inlined version of pcc_add_invocant; the parsed flags are shared */
+    arg_flags = Parrot_pcc_signature_method_flags(interp,
+            Parrot_pcc_signature_lookup(interp, arg_sig));
+    PARROT_GC_WRITE_BARRIER(interp, call_obj);
+    SETATTR_CallContext_arg_flags(interp, call_obj, arg_flags);
     Parrot_CallContext_unshift_pmc(interp, call_obj, pmc);
 
     Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_obj);
@@ -194,6 +196,84 @@ Parrot_pcc_invoke_method_from_c_args(PARROT_INTERP, ARGIN(PMC* pmc),
 }
 
 
+/*
+
+=item C<void Parrot_pcc_invoke_sub_from_signature(PARROT_INTERP, PMC *sub_obj,
+Pcc_signature *sig, ...)>
+
+Like C<Parrot_pcc_invoke_sub_from_c_args>, with a signature parsed once by
+C<Parrot_pcc_signature_new>.  Use it for calls made many times from C.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_invoke_sub_from_signature(PARROT_INTERP, ARGIN(PMC *sub_obj),
+        ARGIN(Pcc_signature *sig), ...)
+{
+    ASSERT_ARGS(Parrot_pcc_invoke_sub_from_signature)
+    PMC         *call_obj;
+    va_list      args;
+    PMC         * const old_call_obj =
+        Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    va_start(args, sig);
+    call_obj = Parrot_pcc_build_call_from_signature(interp, sig, &args);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_obj);
+    Parrot_pcc_invoke_from_sig_object(interp, sub_obj, call_obj);
+    call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+    Parrot_pcc_fill_returns_from_signature(interp, call_obj, sig, &args);
+    va_end(args);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), old_call_obj);
+}
+
+/*
+
+=item C<void Parrot_pcc_invoke_method_from_signature(PARROT_INTERP, PMC* pmc,
+STRING *method_name, Pcc_signature *sig, ...)>
+
+Like C<Parrot_pcc_invoke_method_from_c_args>, with a signature parsed once by
+C<Parrot_pcc_signature_new>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_invoke_method_from_signature(PARROT_INTERP, ARGIN(PMC* pmc),
+        ARGIN(STRING *method_name), ARGIN(Pcc_signature *sig), ...)
+{
+    ASSERT_ARGS(Parrot_pcc_invoke_method_from_signature)
+    PMC        *call_obj;
+    PMC        *sub_obj;
+    va_list     args;
+    PMC        * const old_call_obj =
+        Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    va_start(args, sig);
+    call_obj = Parrot_pcc_build_call_from_signature(interp, sig, &args);
+    PARROT_GC_WRITE_BARRIER(interp, call_obj);
+    SETATTR_CallContext_arg_flags(interp, call_obj, sig->method_flags);
+    Parrot_CallContext_unshift_pmc(interp, call_obj, pmc);
+
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_obj);
+
+    sub_obj = VTABLE_find_method(interp, pmc, method_name);
+
+    if (UNLIKELY(PMC_IS_NULL(sub_obj)))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found", method_name);
+
+    Parrot_pcc_invoke_from_sig_object(interp, sub_obj, call_obj);
+    call_obj = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+    Parrot_pcc_fill_returns_from_signature(interp, call_obj, sig, &args);
+    va_end(args);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), old_call_obj);
+}
+
 /*
 
 =item C<static int is_invokable(PARROT_INTERP, PMC *sub_obj)>
@@ -286,7 +366,7 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
     ASSERT_ARGS(Parrot_pcc_invoke_from_sig_object)
 
     opcode_t    *dest;
-    PMC * const  ret_cont = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC * const  ret_cont = Parrot_pcc_new_return_continuation(interp);
     if (UNLIKELY(PMC_IS_NULL(call_object)))
         call_object = Parrot_pmc_new(interp, enum_class_CallContext);
 
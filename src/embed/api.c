@@ -145,6 +145,8 @@ Parrot_api_make_interpreter(Parrot_PMC parent, Parrot_Int flags,
             gc_args.min_threshold     = args->gc_min_threshold;
             gc_args.debug_flags       = args->debug_flags;
             gc_args.numthreads        = args->numthreads;
+            gc_args.mark_threads      = args->gc_threads;
+            gc_args.max_pause         = args->gc_max_pause;
 
             if (args->hash_seed)
                 interp_raw->hash_seed = args->hash_seed;
@@ -190,8 +192,14 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
         else if (STREQ(corename, "trace"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
+#if PARROT_HAS_CGOTO
+        else if (STREQ(corename, "cgoto")
+                 || STREQ(corename, "cgp"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
+#endif
         else if (STREQ(corename, "fast")
                  || STREQ(corename, "function")
+                 || STREQ(corename, "cgoto")
                  || STREQ(corename, "cgp")
                  || STREQ(corename, "switch"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2010, Parrot Foundation.
+Copyright (C) 2010-2015, Parrot Foundation.
 
 =head1 NAME
 
@@ -270,6 +270,31 @@ Parrot_api_string_byte_length(Parrot_PMC interp_pmc, Parrot_String str,
 
 /*
 
+=item C<Parrot_Int Parrot_api_string_intern(Parrot_PMC interp_pmc, Parrot_String
+str, Parrot_String * out)>
+
+Stores the interned string equal to C<str> in C<out>. Interned strings with
+the same value are the same Parrot_String, so embedders can compare them by
+pointer. This function returns a true value if this call is successful and
+false value otherwise.
+
+=cut
+
+*/
+
+PARROT_API
+Parrot_Int
+Parrot_api_string_intern(ARGIN(Parrot_PMC interp_pmc), ARGIN(Parrot_String str),
+        ARGOUT(Parrot_String * out))
+{
+    ASSERT_ARGS(Parrot_api_string_intern)
+    EMBED_API_CALLIN(interp_pmc, interp)
+    *out = Parrot_str_intern(interp, str);
+    EMBED_API_CALLOUT(interp_pmc, interp)
+}
+
+/*
+
 =back
 
 =cut
@@ -718,6 +718,25 @@ Parrot_gc_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
 /*
 
+=item C<void Parrot_gc_mark_slice(PARROT_INTERP)>
+
+Gives an incremental collection in progress a slice of time to go on
+marking.  Does nothing if there is none.
+
+=cut
+
+*/
+
+void
+Parrot_gc_mark_slice(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_mark_slice)
+    if (interp->gc_sys->mark_slice)
+        interp->gc_sys->mark_slice(interp);
+}
+
+/*
+
 =item C<void Parrot_gc_compact_memory_pool(PARROT_INTERP)>
 
 Compact string pool if supported by GC.
@@ -884,6 +903,23 @@ Return the number of memory allocations made since the last collection run.
 
 Returns the number of PMCs that are marked as needing timely destruction.
 
+=item C<size_t Parrot_gc_mark_threads(PARROT_INTERP)>
+
+Returns the number of threads marking objects, or 0 if the GC doesn't mark
+in parallel.
+
+=item C<size_t Parrot_gc_count_mark_slices(PARROT_INTERP)>
+
+Returns the number of slices incremental collections were marked in, or 0
+if the GC doesn't mark incrementally.
+
+=item C<size_t Parrot_gc_phase_time(PARROT_INTERP, Interpinfo_enum phase)>
+
+Returns the wall time in microseconds spent in a phase of all collections so
+far, or 0 if the GC doesn't time that phase.  C<phase> is one of
+C<GC_TRACE_ROOTS_TIME>, C<GC_DIRTY_LIST_TIME>, C<GC_WORK_LIST_TIME> and
+C<GC_SWEEP_TIME>.
+
 =cut
 
 */
@@ -960,6 +996,30 @@ Parrot_gc_impatient_pmcs(PARROT_INTERP)
     return interp->gc_sys->get_gc_info(interp, IMPATIENT_PMCS);
 }
 
+PARROT_EXPORT
+size_t
+Parrot_gc_mark_threads(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_mark_threads)
+    return interp->gc_sys->get_gc_info(interp, GC_MARK_THREADS);
+}
+
+PARROT_EXPORT
+size_t
+Parrot_gc_count_mark_slices(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_count_mark_slices)
+    return interp->gc_sys->get_gc_info(interp, GC_MARK_SLICES);
+}
+
+PARROT_EXPORT
+size_t
+Parrot_gc_phase_time(PARROT_INTERP, Interpinfo_enum phase)
+{
+    ASSERT_ARGS(Parrot_gc_phase_time)
+    return interp->gc_sys->get_gc_info(interp, phase);
+}
+
 /*
 
 =item C<void Parrot_block_GC_mark(PARROT_INTERP)>
@@ -310,6 +310,7 @@ Parrot_gc_pool_new(SHIM_INTERP, size_t object_size)
     newpool->newfree           = NULL;
     newpool->newlast           = NULL;
     newpool->num_arenas        = 0;
+    newpool->total_size        = 0;
     newpool->arena_bounds      = (void **)mem_sys_allocate_zeroed(NEXT_ARENA_BOUNDS_SIZE(0));
 
     return newpool;
@@ -375,7 +376,7 @@ Parrot_gc_pool_allocated_size(SHIM_INTERP, ARGIN(const Pool_Allocator *pool))
 {
     ASSERT_ARGS(Parrot_gc_pool_allocated_size)
 
-    return pool->num_arenas * arena_size(pool);
+    return pool->total_size;
 }
 
 PARROT_CAN_RETURN_NULL
@@ -518,7 +519,10 @@ pool_is_owned(ARGIN(const Pool_Allocator *pool), ARGIN(const void *ptr))
 =item C<static void allocate_new_pool_arena(PARROT_INTERP, Pool_Allocator
 *pool)>
 
-Allocate a new pool arena
+Allocate a new pool arena.  Each new arena holds twice as many objects as
+the previous one until it reaches C<GC_FIXED_SIZE_POOL_MAX_SIZE>, so pools
+of frequently allocated sizes are refilled in bulk while pools of rare sizes
+only take a page.
 
 =cut
 
@@ -543,6 +547,11 @@ allocate_new_pool_arena(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
     new_arena = (Pool_Allocator_Arena *)mem_sys_allocate_zeroed(total_size);
 
     interp->gc_sys->stats.memory_allocated += total_size;
+    pool->total_size                       += total_size;
+
+    /* The pool ran dry, so refill it in a bigger chunk next time */
+    if (total_size * 2 <= GC_FIXED_SIZE_POOL_MAX_SIZE)
+        pool->objects_per_alloc *= 2;
 
     new_arena->next = pool->top_arena;
     pool->top_arena = new_arena;
@@ -18,6 +18,11 @@ src/gc/fixed_allocator.h - implementation of allocator for small-size objects.
 #define GC_ATTRIB_POOLS_HEADROOM 8
 #define GC_FIXED_SIZE_POOL_SIZE 4096
 
+/* Every arena a pool runs dry on is twice as large as the previous one, up
+   to this size.  Busy size classes get refilled in big chunks, rarely used
+   ones stay at GC_FIXED_SIZE_POOL_SIZE. */
+#define GC_FIXED_SIZE_POOL_MAX_SIZE (256 * 1024)
+
 /* Use the lazy allocator. Since it amortizes arena allocation costs, turn
    this on at the same time that you increase the size of allocated arenas.
    increase *_HEADERS_PER_ALLOC and GC_FIXED_SIZE_POOL_SIZE to be large
@@ -53,6 +58,8 @@ typedef struct Pool_Allocator {
     int num_arenas;      /* number of arenas, for keeping track of the
                             size of arena_bounds */
     void **arena_bounds; /* Array of low/high pairs for each arena. */
+
+    size_t total_size;   /* bytes allocated for all arenas */
 } Pool_Allocator;
 
 typedef struct Fixed_Allocator
@@ -200,6 +207,69 @@ Pool_Allocator * Parrot_gc_pool_new(PARROT_INTERP, size_t object_size);
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/fixed_allocator.c */
 
+/*
+
+Inline functions for faster allocation.
+
+=over 4
+
+=item C<static void * Parrot_gc_pool_allocate_fast(PARROT_INTERP, Pool_Allocator
+*pool)>
+
+Allocate from Pool.  Takes an item from the free list or bumps the pointer
+into the unused part of the newest arena; only refilling the pool with a new
+arena calls into C<Parrot_gc_pool_allocate>.
+
+=item C<static void * Parrot_gc_fixed_allocator_allocate_fast(PARROT_INTERP,
+Fixed_Allocator *allocator, size_t size)>
+
+Allocate C<size> bytes from the pool of that size class if it exists already,
+otherwise fall back to C<Parrot_gc_fixed_allocator_allocate>.
+
+=back
+
+=cut
+
+*/
+
+static
+PARROT_INLINE
+PARROT_CANNOT_RETURN_NULL
+void *
+Parrot_gc_pool_allocate_fast(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
+{
+    Pool_Allocator_Free_List * const item = pool->free_list;
+
+    if (item)
+        pool->free_list = item->next;
+    else if (pool->newfree < pool->newlast) {
+        Pool_Allocator_Free_List * const bump = pool->newfree;
+        pool->newfree = (Pool_Allocator_Free_List *)((char *)bump + pool->object_size);
+        --pool->num_free_objects;
+        return bump;
+    }
+    else
+        return Parrot_gc_pool_allocate(interp, pool);
+
+    --pool->num_free_objects;
+    return item;
+}
+
+static
+PARROT_INLINE
+PARROT_CAN_RETURN_NULL
+void *
+Parrot_gc_fixed_allocator_allocate_fast(PARROT_INTERP,
+        ARGIN(Fixed_Allocator *allocator), size_t size)
+{
+    const size_t index = (size - 1) / sizeof (void *);
+
+    if (index < allocator->num_pools && allocator->pools[index])
+        return Parrot_gc_pool_allocate_fast(interp, allocator->pools[index]);
+
+    return Parrot_gc_fixed_allocator_allocate(interp, allocator, size);
+}
+
 
 #endif /* PARROT_GC_FIXED_ALLOCATOR_H_GUARD */
 
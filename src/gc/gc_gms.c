@@ -68,7 +68,10 @@ C<gc_gms_get_youngest_generation> which iterate over direct children only.
 5. Iterate over "dirty_set" calling VTABLE_mark on it. It will move all
 children into "work_list".
 
-6. Iterate over "work_list" calling VTABLE_mark on it.
+6. Iterate over "work_list" calling VTABLE_mark on it. With --gc-threads=N
+the objects are dealt out to N marking threads. Every thread marks from its
+own stack and steals from the others when it runs dry. The live bit is set
+with compare-and-swap, so every object is marked by exactly one thread.
 
 7. Soil nursery root PMCs from C-stack.
 
@@ -83,7 +86,7 @@ methods (e.g. pmc2c vtable overrides).
 
 8. Sweep generations starting from K:
     - Destroy all dead objects
-    - Move live objects into generation max(K+1, N)
+    - Move live objects into generation min(K+1, N-1)
     - Paint them white.
 
 9. ...
@@ -165,6 +168,89 @@ typedef struct string_alloc_struct {
 #define SET_GEN_FLAGS(pmc, gen) PObj_flags_SETTO((pmc), \
         ((pmc)->flags & ~PObj_GC_all_generation_FLAGS) | GEN2FLAGS(gen))
 
+/*
+ * Parallel marking of "work_list" needs a compare-and-swap on PObj flags to
+ * set the live bit.  Without one --gc-threads is accepted, but we mark with
+ * a single thread.
+ */
+#if defined(PARROT_HAS_THREADS) && defined(PARROT_HAS_I386_GCC_CMPXCHG) \
+ && INTVAL_SIZE == PTR_SIZE
+#  define GC_GMS_PARALLEL_MARK 1
+#  define PObj_flags_CAS(o, old, new) \
+    (parrot_i386_cmpxchg((void * volatile *)((char *)(o) + offsetof(PObj, flags)), \
+        (void *)(old), (void *)(new)) == (void *)(old))
+#else
+#  define PObj_flags_CAS(o, old, new) ((o)->flags = (new), 1)
+#endif
+
+/* Upper limit of --gc-threads */
+#define GC_GMS_MAX_MARK_THREADS    64
+
+/* Max number of objects a marking thread hands over to idle ones at once */
+#define GC_GMS_MARK_SHARE_BATCH    256
+
+/* Convert Parrot_hires_get_time() ticks to microseconds */
+#define TICKS2USEC(t) ((size_t)((t) * Parrot_hires_get_tick_duration() / 1000))
+
+/* Convert microseconds to Parrot_hires_get_time() ticks */
+#define USEC2TICKS(u) ((UHUGEINTVAL)(u) * 1000 / Parrot_hires_get_tick_duration())
+
+/* Upper limit of --gc-max-pause, in microseconds */
+#define GC_GMS_MAX_PAUSE           1000000
+
+/* During incremental marking look for a slice every this many allocations */
+#define GC_GMS_SLICE_ALLOCS        256
+
+/* Check the clock every this many objects handled in a slice */
+#define GC_GMS_SLICE_CHECK         64
+
+/* Phases of an incremental collection */
+#define GC_GMS_INC_CLEANUP         1   /* step 3 */
+#define GC_GMS_INC_DIRTY           2   /* step 5 */
+#define GC_GMS_INC_WORK            3   /* step 6 */
+
+/* Take interp_lock for allocating from the pools.  Running out of arena asks
+ * for a GC, which would take interp_lock again, so GC is blocked meanwhile. */
+#define GMS_ALLOC_LOCK(interp, self) \
+    do { \
+        if ((interp)->thread_data) { \
+            LOCK((interp)->thread_data->interp_lock); \
+            ++(self)->gc_mark_block_level_locked; \
+        } \
+    } while (0)
+#define GMS_ALLOC_UNLOCK(interp, self) \
+    do { \
+        if ((interp)->thread_data) { \
+            --(self)->gc_mark_block_level_locked; \
+            UNLOCK((interp)->thread_data->interp_lock); \
+        } \
+    } while (0)
+
+/* Stack of grey PMCs */
+typedef struct GC_Mark_Stack {
+    PMC    **items;
+    size_t   size;
+    size_t   allocated;
+} GC_Mark_Stack;
+
+/* State of a thread marking "work_list" */
+typedef struct GC_Mark_Worker {
+    /* Interpreter being collected */
+    Parrot_Interp    interp;
+
+    /* Index of this worker in MarkSweep_GC.mark_workers */
+    size_t           id;
+
+    /* Grey objects only this worker touches */
+    GC_Mark_Stack    local;
+
+    /* Grey objects offered to idle workers. Guarded by C<lock>. */
+    GC_Mark_Stack    shared;
+    Parrot_mutex     lock;
+
+    Parrot_thread    thread;
+} GC_Mark_Worker;
+
 /* Private information */
 typedef struct MarkSweep_GC {
     /* Allocator for PMC headers */
@@ -209,12 +295,62 @@ typedef struct MarkSweep_GC {
 
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
 
+    /* Number of threads marking "work_list". 1 marks without threads */
+    size_t                  mark_threads;
+
+    /* One per marking thread. Worker 0 is the interpreter's own thread */
+    GC_Mark_Worker         *mark_workers;
+
+    /* Number of workers which ran out of grey objects */
+    Parrot_atomic_integer   mark_idle;
+
+    /* GC_Mark_Worker of the current thread during parallel marking */
+    Parrot_thread_key       mark_worker_key;
+
+    /* Helper threads wait on "mark_start" for the next "mark_epoch" and
+     * count "mark_running" down when done. They are started by the first
+     * parallel collection and live until the GC is finalized. Guarded by
+     * "mark_lock". */
+    Parrot_mutex            mark_lock;
+    Parrot_cond             mark_start;
+    Parrot_cond             mark_done;
+    size_t                  mark_epoch;
+    size_t                  mark_running;
+    int                     mark_shutdown;
+
+    /* Wall time spent in GC phases, in Parrot_hires_get_time() ticks */
+    UHUGEINTVAL             time_trace_roots;
+    UHUGEINTVAL             time_dirty_list;
+    UHUGEINTVAL             time_work_list;
+    UHUGEINTVAL             time_sweep;
+
+    /* Longest marking slice in ticks (--gc-max-pause). 0 marks in one go */
+    UHUGEINTVAL             max_pause;
+
+    /* Phase of the incremental collection in progress, 0 if none.
+     * "work_list" keeps the grey objects between slices */
+    int                     incremental;
+
+    /* Where the last slice stopped in "dirty_list" or "work_list" */
+    size_t                  slice_chunk;
+    size_t                  slice_cell;
 
+    /* End of the last slice or of the initial root scan */
+    UHUGEINTVAL             slice_end;
+
+    /* Allocations since the last look for a slice */
+    size_t                  slice_allocs;
+
+    /* Number of slices run so far */
+    size_t                  mark_slices;
 } MarkSweep_GC;
 
 /* Callback to destroy PMC or free string storage */
 typedef void (*sweep_cb)(PARROT_INTERP, PObj *obj);
 
+/* Callback for objects handled in a slice of incremental collection */
+typedef void (*slice_cb)(PARROT_INTERP, MarkSweep_GC *self, pmc_alloc_struct *item);
+
 static void gc_gms_maybe_mark_and_sweep(PARROT_INTERP, UINTVAL flags);
 
 /* HEADERIZER HFILE: src/gc/gc_private.h */
@@ -272,6 +408,15 @@ static void gc_gms_allocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_gms_blacken_pmc(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(pmc_alloc_struct *item))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*item);
+
 static void gc_gms_block_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -291,6 +436,22 @@ static void gc_gms_cleanup_dirty_list(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void gc_gms_cleanup_dirty_pmc(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(pmc_alloc_struct *item))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*item);
+
+static int gc_gms_cleanup_dirty_slice(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    UHUGEINTVAL deadline)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_compact_memory_pool(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -307,6 +468,21 @@ static size_t gc_gms_count_used_string_memory(PARROT_INTERP,
 static void gc_gms_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_gms_finalize_mark_workers(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_finish_collection(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_gms_finish_incremental(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_free_buffer_header(PARROT_INTERP,
     ARGFREE(Parrot_Buffer *s),
     size_t size)
@@ -378,15 +554,65 @@ static void gc_gms_iterate_live_strings(PARROT_INTERP,
 static void gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         __attribute__nonnull__(1);
 
+static void gc_gms_mark_drain(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGMOD(GC_Mark_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*worker);
+
+static int gc_gms_mark_find_work(
+    ARGIN(MarkSweep_GC *self),
+    ARGMOD(GC_Mark_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*worker);
+
 static void gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+static void gc_gms_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+static void gc_gms_mark_slice(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_gms_mark_stack_move(
+    ARGMOD(GC_Mark_Stack *to),
+    ARGMOD(GC_Mark_Stack *from),
+    size_t count)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*to)
+        FUNC_MODIFIES(*from);
+
+static void gc_gms_mark_stack_push(
+    ARGMOD(GC_Mark_Stack *stack),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*stack);
+
+static int gc_gms_mark_steal(
+    ARGIN(MarkSweep_GC *self),
+    ARGMOD(GC_Mark_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*worker);
+
 static void gc_gms_mark_str_header(PARROT_INTERP, ARGMOD(STRING *str))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+PARROT_CAN_RETURN_NULL
+static void * gc_gms_mark_thread(ARGIN(void *data))
+        __attribute__nonnull__(1);
+
 static void gc_gms_pmc_get_youngest_generation(PARROT_INTERP,
     ARGIN(PMC *pmc))
         __attribute__nonnull__(1)
@@ -413,6 +639,13 @@ static void gc_gms_process_work_list(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void gc_gms_process_work_list_parallel(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array *work_list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_gms_reallocate_buffer_storage(PARROT_INTERP,
     ARGIN(Parrot_Buffer *str),
     size_t size)
@@ -439,12 +672,45 @@ static void gc_gms_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_gms_rescan_dirty_list(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_gms_scan_dirty_pmc(PARROT_INTERP,
+    MarkSweep_GC *self,
+    ARGMOD(pmc_alloc_struct *item))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*item);
+
 static void gc_gms_seal_object(PARROT_INTERP, ARGIN(PMC *pmc))
         __attribute__nonnull__(2);
 
 static size_t gc_gms_select_generation_to_collect(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static int gc_gms_slice_list(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array *list),
+    ARGIN(slice_cb cb),
+    int until_empty,
+    UHUGEINTVAL deadline)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*self);
+
+static void gc_gms_start_collection(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_gms_start_incremental(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 static void gc_gms_str_get_youngest_generation(PARROT_INTERP,
     ARGIN(STRING *str))
         __attribute__nonnull__(1)
@@ -455,6 +721,11 @@ static void gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*self);
 
+static void gc_gms_trace_roots(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_unblock_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -509,6 +780,10 @@ static int gen2flags(int gen);
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_blacken_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(item))
 #define ASSERT_ARGS_gc_gms_block_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_block_GC_mark_locked __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -521,6 +796,13 @@ static int gen2flags(int gen);
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(dirty_list))
+#define ASSERT_ARGS_gc_gms_cleanup_dirty_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(item))
+#define ASSERT_ARGS_gc_gms_cleanup_dirty_slice __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_compact_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_count_used_pmc_memory __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -532,6 +814,14 @@ static int gen2flags(int gen);
     , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_gc_gms_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_finalize_mark_workers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_finish_collection __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_finish_incremental __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_free_fixed_size_storage \
@@ -573,11 +863,35 @@ static int gen2flags(int gen);
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_mark_and_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_mark_drain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_gc_gms_mark_find_work __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(worker))
 #define ASSERT_ARGS_gc_gms_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_pmc_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_slice __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_mark_stack_move __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(to) \
+    , PARROT_ASSERT_ARG(from))
+#define ASSERT_ARGS_gc_gms_mark_stack_push __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stack) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_steal __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(worker))
 #define ASSERT_ARGS_gc_gms_mark_str_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_mark_thread __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(data))
 #define ASSERT_ARGS_gc_gms_pmc_get_youngest_generation \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -595,6 +909,11 @@ static int gen2flags(int gen);
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(work_list))
+#define ASSERT_ARGS_gc_gms_process_work_list_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(work_list))
 #define ASSERT_ARGS_gc_gms_reallocate_buffer_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -608,11 +927,27 @@ static int gen2flags(int gen);
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_rescan_dirty_list __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_scan_dirty_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(item))
 #define ASSERT_ARGS_gc_gms_seal_object __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_gms_select_generation_to_collect \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_slice_list __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(list) \
+    , PARROT_ASSERT_ARG(cb))
+#define ASSERT_ARGS_gc_gms_start_collection __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_start_incremental __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_str_get_youngest_generation \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -620,6 +955,9 @@ static int gen2flags(int gen);
 #define ASSERT_ARGS_gc_gms_sweep_pools __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_trace_roots __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_unblock_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_unblock_GC_mark_locked __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -780,6 +1118,43 @@ Parrot_gc_gms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
          * or --gc-nursery-size=2 [default]
          */
         self->gc_threshold = Parrot_sysmem_amount(interp) * nursery_size / 100;
+
+        /*
+         * Mark "work_list" with this many threads.
+         * --gc-threads=1 [default]
+         */
+        self->mark_threads = 1;
+#ifdef GC_GMS_PARALLEL_MARK
+        if (args->mark_threads > 1) {
+            self->mark_threads = args->mark_threads > GC_GMS_MAX_MARK_THREADS
+                               ? GC_GMS_MAX_MARK_THREADS
+                               : args->mark_threads;
+            self->mark_workers = mem_internal_allocate_n_zeroed_typed(
+                                        self->mark_threads, GC_Mark_Worker);
+            for (i = 0; i < self->mark_threads; ++i) {
+                self->mark_workers[i].interp = interp;
+                self->mark_workers[i].id     = i;
+                MUTEX_INIT(self->mark_workers[i].lock);
+            }
+            PARROT_ATOMIC_INT_INIT(self->mark_idle);
+            THREAD_KEY_CREATE(self->mark_worker_key);
+            MUTEX_INIT(self->mark_lock);
+            COND_INIT(self->mark_start);
+            COND_INIT(self->mark_done);
+
+            /* Stop the marking threads with the interpreter */
+            interp->gc_sys->finalize_gc_system = gc_gms_finalize_mark_workers;
+        }
+#endif
+
+        /*
+         * Mark incrementally, in slices of at most this many microseconds.
+         * --gc-max-pause=0 [default] marks every collection in one go.
+         */
+        if (args->max_pause)
+            self->max_pause = USEC2TICKS(args->max_pause > GC_GMS_MAX_PAUSE
+                                         ? GC_GMS_MAX_PAUSE
+                                         : args->max_pause);
 #ifndef NDEBUG
         if (Interp_debug_TEST(interp, PARROT_MEM_STAT_DEBUG_FLAG)) {
             fprintf(stderr, "GC nursery size: %.3f%%\n", nursery_size);
@@ -799,24 +1174,101 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 {
     ASSERT_ARGS(gc_gms_mark_and_sweep)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-    int gen = -1;
+    UHUGEINTVAL start;
 
     /* GC is blocked */
     if (self->gc_mark_block_level || self->gc_mark_block_level_locked)
-        goto DONE;
+        return;
 
     /* Ignore it. Will cleanup in gc_gms_finalize */
     if (flags & GC_finish_FLAG)
-        goto DONE;
+        return;
 
     /* Ignore calls from String GC. We know better when to trigger GC */
     if (flags & GC_strings_cb_FLAG)
-        goto DONE;
+        return;
 
-    if (interp->thread_data)
+    if (interp->thread_data) {
         LOCK(interp->thread_data->interp_lock);
+
+        /* Another thread blocked GC to hand us objects meanwhile */
+        if (self->gc_mark_block_level_locked)
+            goto DONE;
+    }
+
+    /* Finish the incremental collection in progress. It keeps objects which
+     * died after it marked them, so collect once more. */
+    if (self->incremental)
+        gc_gms_finish_incremental(interp, self);
+
     /* Block further GC calls */
     ++self->gc_mark_block_level;
+
+    gc_gms_start_collection(interp, self);
+
+    /*
+    3. Move all objects from collections younger K from dirty_list
+    back to original lists. Reason for this is "corollary of invariant". We can
+    either collect such objects or they will be marked by referents from
+    "dirty_list".
+    */
+    start = Parrot_hires_get_time();
+    gc_gms_cleanup_dirty_list(interp, self, self->dirty_list);
+    self->time_dirty_list += Parrot_hires_get_time() - start;
+#ifdef MEMORY_DEBUG
+    gc_gms_print_stats(interp, "After cleanup");
+#endif
+
+    gc_gms_trace_roots(interp, self);
+
+    /*
+    5. Iterate over "dirty_set" calling VTABLE_mark on it. It will move all
+    children into "work_list".
+    */
+    start = Parrot_hires_get_time();
+    gc_gms_process_dirty_list(interp, self, self->dirty_list);
+    self->time_dirty_list += Parrot_hires_get_time() - start;
+#ifdef MEMORY_DEBUG
+    gc_gms_print_stats(interp, "After dirty_list");
+    gc_gms_check_sanity(interp);
+#endif
+
+    /*
+    6. Iterate over "work_list" calling VTABLE_mark on it. With --gc-threads
+    the objects are shared out to marking threads.
+    */
+    start = Parrot_hires_get_time();
+    if (self->mark_threads > 1)
+        gc_gms_process_work_list_parallel(interp, self, self->work_list);
+    else
+        gc_gms_process_work_list(interp, self, self->work_list);
+    self->time_work_list += Parrot_hires_get_time() - start;
+#ifdef MEMORY_DEBUG
+    gc_gms_print_stats(interp, "After work_list");
+    gc_gms_check_sanity(interp);
+#endif
+
+    gc_gms_finish_collection(interp, self);
+
+DONE:
+    if (interp->thread_data)
+        UNLOCK(interp->thread_data->interp_lock);
+}
+
+/*
+
+=item C<static void gc_gms_start_collection(PARROT_INTERP, MarkSweep_GC *self)>
+
+Step 2 of the collection: choose the generations to collect.
+
+=cut
+
+*/
+static void
+gc_gms_start_collection(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_start_collection)
+
     self->work_list = Parrot_pa_new(interp);
 
     interp->gc_sys->stats.gc_mark_runs++;
@@ -830,18 +1282,23 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     2. Choose K - how many collections we want to collect. Collections [0..K]
     will be collected. Remember K in C<self->gen_to_collect>.
     */
-    self->gen_to_collect = gen = gc_gms_select_generation_to_collect(interp);
+    self->gen_to_collect = gc_gms_select_generation_to_collect(interp);
+}
 
-    /*
-    3. Move all objects from collections younger K from dirty_list
-    back to original lists. Reason for this is "corollary of invariant". We can
-    either collect such objects or they will be marked by referents from
-    "dirty_list".
-    */
-    gc_gms_cleanup_dirty_list(interp, self, self->dirty_list);
-#ifdef MEMORY_DEBUG
-    gc_gms_print_stats(interp, "After cleanup");
-#endif
+/*
+
+=item C<static void gc_gms_trace_roots(PARROT_INTERP, MarkSweep_GC *self)>
+
+Step 4 of the collection: grey the objects referenced from the root set.
+
+=cut
+
+*/
+static void
+gc_gms_trace_roots(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_trace_roots)
+    const UHUGEINTVAL start = Parrot_hires_get_time();
 
     /*
     4. Trace root objects. According to "0. Pre-requirements" we will ignore all
@@ -853,38 +1310,39 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
     if (interp->pdb && interp->pdb->debugger)
         Parrot_gc_trace_root(interp->pdb->debugger, NULL, GC_TRACE_FULL);
+    self->time_trace_roots += Parrot_hires_get_time() - start;
 
 #ifdef MEMORY_DEBUG
     gc_gms_print_stats(interp, "After trace_roots");
     gc_gms_check_sanity(interp);
 #endif
+}
 
-    /*
-    5. Iterate over "dirty_set" calling VTABLE_mark on it. It will move all
-    children into "work_list".
-    */
-    gc_gms_process_dirty_list(interp, self, self->dirty_list);
-#ifdef MEMORY_DEBUG
-    gc_gms_print_stats(interp, "After dirty_list");
-    gc_gms_check_sanity(interp);
-#endif
+/*
 
-    /*
-    6. Iterate over "work_list" calling VTABLE_mark on it.
-    */
-    gc_gms_process_work_list(interp, self, self->work_list);
-#ifdef MEMORY_DEBUG
-    gc_gms_print_stats(interp, "After work_list");
-    gc_gms_check_sanity(interp);
-#endif
+=item C<static void gc_gms_finish_collection(PARROT_INTERP, MarkSweep_GC *self)>
+
+Step 7 of the collection: sweep the collected generations once marking is
+done.  Drops the block taken when the collection started.
+
+=cut
+
+*/
+static void
+gc_gms_finish_collection(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_finish_collection)
+    UHUGEINTVAL start;
 
     /*
     7. Sweep generations starting from K:
         - Destroy all dead objects
-        - Move live objects into generation max(K+1, N)
+        - Move live objects into generation min(K+1, N-1)
         - Paint them white.
     */
+    start = Parrot_hires_get_time();
     gc_gms_sweep_pools(interp, self);
+    self->time_sweep += Parrot_hires_get_time() - start;
 #ifdef MEMORY_DEBUG
     gc_gms_check_sanity(interp);
 #endif
@@ -899,23 +1357,426 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     self->num_early_gc_PMCs                      = 0;
 
     /* Don't compact after nursery collection */
-    if (gen)
-        gc_gms_compact_memory_pool(interp);
+    if (self->gen_to_collect)
+        Parrot_gc_str_compact_pool(interp, &self->string_gc);
 
 #ifdef MEMORY_DEBUG
     gc_gms_check_sanity(interp);
     gc_gms_print_stats(interp, "After");
 #endif
 
-    if (self->work_list)
-        Parrot_pa_destroy(interp, self->work_list);
-    self->work_list = NULL;
+    if (self->work_list)
+        Parrot_pa_destroy(interp, self->work_list);
+    self->work_list = NULL;
+
+    gc_gms_validate_objects(interp);
+}
+
+/*
+
+=item C<static void gc_gms_start_incremental(PARROT_INTERP)>
+
+Starts an incremental collection (C<--gc-max-pause>).  Steps 3, 5 and 6 run
+in slices from C<gc_gms_mark_slice> between ops, only tracing the root set
+(step 4) stops the program.
+
+While it marks, black objects are sealed.  The write barrier moves a black
+object written to into "dirty_list", or has an object already there scanned
+again.  That way the program can't hide a white object behind a black one.
+New objects are allocated white.  They are either reached from a grey
+object, from "dirty_list" or from the root set, which is traced again in
+the last pause.
+
+=cut
+
+*/
+static void
+gc_gms_start_incremental(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_start_incremental)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (self->gc_mark_block_level || self->gc_mark_block_level_locked)
+        return;
+
+    if (interp->thread_data) {
+        LOCK(interp->thread_data->interp_lock);
+        if (self->gc_mark_block_level_locked) {
+            UNLOCK(interp->thread_data->interp_lock);
+            return;
+        }
+    }
+
+    gc_gms_start_collection(interp, self);
+
+    self->incremental          = GC_GMS_INC_CLEANUP;
+    self->slice_chunk          = 0;
+    self->slice_cell           = 0;
+    self->slice_allocs         = 0;
+    self->slice_end            = 0;
+    interp->gc_sys->mark_slice = gc_gms_mark_slice;
+
+    if (interp->thread_data)
+        UNLOCK(interp->thread_data->interp_lock);
+
+    gc_gms_mark_slice(interp);
+}
+
+/*
+
+=item C<static void gc_gms_mark_slice(PARROT_INTERP)>
+
+Runs the incremental collection for at most C<--gc-max-pause> microseconds.
+Finishes the collection when no grey object is left.  Called between ops and
+from allocation, but gives the program at least as much time between slices
+as a slice may take.
+
+=cut
+
+*/
+static void
+gc_gms_mark_slice(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_mark_slice)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    UHUGEINTVAL          start, deadline;
+    int                  done = 0;
+
+    if (!self->incremental
+    ||  self->gc_mark_block_level || self->gc_mark_block_level_locked)
+        return;
+
+    start = Parrot_hires_get_time();
+    if (start - self->slice_end < self->max_pause)
+        return;
+    deadline = start + self->max_pause;
+
+    if (interp->thread_data) {
+        LOCK(interp->thread_data->interp_lock);
+        if (self->gc_mark_block_level_locked) {
+            UNLOCK(interp->thread_data->interp_lock);
+            return;
+        }
+    }
+
+    ++self->gc_mark_block_level;
+    ++self->mark_slices;
+
+    if (self->incremental == GC_GMS_INC_CLEANUP
+    &&  gc_gms_cleanup_dirty_slice(interp, self, deadline)) {
+        gc_gms_trace_roots(interp, self);
+        self->incremental = GC_GMS_INC_DIRTY;
+    }
+
+    if (self->incremental == GC_GMS_INC_DIRTY
+    &&  Parrot_hires_get_time() < deadline) {
+        const UHUGEINTVAL now = Parrot_hires_get_time();
+
+        if (gc_gms_slice_list(interp, self, self->dirty_list,
+                gc_gms_scan_dirty_pmc, 0, deadline))
+            self->incremental = GC_GMS_INC_WORK;
+        self->time_dirty_list += Parrot_hires_get_time() - now;
+    }
+
+    if (self->incremental == GC_GMS_INC_WORK
+    &&  Parrot_hires_get_time() < deadline) {
+        const UHUGEINTVAL now = Parrot_hires_get_time();
+
+        done = gc_gms_slice_list(interp, self, self->work_list,
+                    gc_gms_blacken_pmc, 1, deadline);
+        self->time_work_list += Parrot_hires_get_time() - now;
+    }
+
+    --self->gc_mark_block_level;
+
+    if (done)
+        gc_gms_finish_incremental(interp, self);
+
+    self->slice_end = Parrot_hires_get_time();
+
+    if (interp->thread_data)
+        UNLOCK(interp->thread_data->interp_lock);
+}
+
+/*
+
+=item C<static void gc_gms_finish_incremental(PARROT_INTERP, MarkSweep_GC
+*self)>
+
+Last pause of the incremental collection.  Does what is left of step 3,
+traces the root set again and marks the objects of "dirty_list" the program
+wrote to.  Then marks everything still grey and sweeps.
+
+=cut
+
+*/
+static void
+gc_gms_finish_incremental(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_finish_incremental)
+    Parrot_Pointer_Array * const work_list = Parrot_pa_new(interp);
+    UHUGEINTVAL                  start;
+
+    ++self->gc_mark_block_level;
+
+    /* Slices left holes in "work_list". Marking in one go only sees objects
+     * added behind the last one, so pack what is still grey. */
+    POINTER_ARRAY_ITER(self->work_list,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        item->ptr = Parrot_pa_insert(work_list, item););
+    Parrot_pa_destroy(interp, self->work_list);
+    self->work_list = work_list;
+
+    if (self->incremental == GC_GMS_INC_CLEANUP)
+        (void)gc_gms_cleanup_dirty_slice(interp, self, (UHUGEINTVAL)-1);
+
+    self->incremental          = 0;
+    interp->gc_sys->mark_slice = NULL;
+
+    gc_gms_trace_roots(interp, self);
+
+    start = Parrot_hires_get_time();
+    gc_gms_rescan_dirty_list(interp, self);
+    self->time_dirty_list += Parrot_hires_get_time() - start;
+
+    start = Parrot_hires_get_time();
+    if (self->mark_threads > 1)
+        gc_gms_process_work_list_parallel(interp, self, self->work_list);
+    else
+        gc_gms_process_work_list(interp, self, self->work_list);
+    self->time_work_list += Parrot_hires_get_time() - start;
+
+    gc_gms_finish_collection(interp, self);
+}
+
+/*
+
+=item C<static int gc_gms_cleanup_dirty_slice(PARROT_INTERP, MarkSweep_GC *self,
+UHUGEINTVAL deadline)>
+
+Step 3 of the incremental collection, until C<deadline>.  Returns 1 when
+all of "dirty_list" is done.
+
+=cut
+
+*/
+static int
+gc_gms_cleanup_dirty_slice(PARROT_INTERP,
+        ARGMOD(MarkSweep_GC *self),
+        UHUGEINTVAL deadline)
+{
+    ASSERT_ARGS(gc_gms_cleanup_dirty_slice)
+    const UHUGEINTVAL start = Parrot_hires_get_time();
+    int               done;
+
+    interp->gc_sys->mark_pmc_header = gc_gms_pmc_get_youngest_generation;
+    interp->gc_sys->mark_str_header = gc_gms_str_get_youngest_generation;
+
+    done = gc_gms_slice_list(interp, self, self->dirty_list,
+                gc_gms_cleanup_dirty_pmc, 0, deadline);
+
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
+    interp->gc_sys->mark_str_header = gc_gms_mark_str_header;
+
+    self->time_dirty_list += Parrot_hires_get_time() - start;
+    return done;
+}
+
+/*
+
+=item C<static int gc_gms_slice_list(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array *list, slice_cb cb, int until_empty, UHUGEINTVAL deadline)>
+
+Calls C<cb> for the objects in C<list> until C<deadline>.  The next call
+goes on where this one stopped.  Returns 1 after one pass over C<list>, or
+with C<until_empty> once a whole pass finds no object left.  C<cb> may
+remove objects from C<list> and add new ones.
+
+=cut
+
+*/
+static int
+gc_gms_slice_list(PARROT_INTERP,
+        ARGMOD(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array *list),
+        ARGIN(slice_cb cb),
+        int until_empty,
+        UHUGEINTVAL deadline)
+{
+    ASSERT_ARGS(gc_gms_slice_list)
+    size_t idle = 0;
+    size_t done = 0;
+
+    for (;;) {
+        Parrot_Pointer_Array_Chunk *chunk;
+        int                         found = 0;
+
+        if (self->slice_chunk >= list->total_chunks) {
+            if (!until_empty || !list->total_chunks)
+                break;
+            self->slice_chunk = 0;
+            self->slice_cell  = 0;
+        }
+
+        /* Everything done after a whole round over the chunks found nothing */
+        if (idle > list->total_chunks)
+            break;
+
+        chunk = list->chunks[self->slice_chunk];
+
+        for (; self->slice_cell < CELL_PER_CHUNK - chunk->num_free; ++self->slice_cell) {
+            void * const ptr = chunk->data[self->slice_cell];
+
+            if ((ptrcast_t)ptr & 1)
+                continue;
+
+            found = 1;
+            (cb)(interp, self, (pmc_alloc_struct *)ptr);
+
+            if (++done % GC_GMS_SLICE_CHECK == 0
+            &&  Parrot_hires_get_time() >= deadline) {
+                ++self->slice_cell;
+                return 0;
+            }
+        }
+
+        ++self->slice_chunk;
+        self->slice_cell = 0;
+        idle             = found ? 0 : idle + 1;
+    }
+
+    self->slice_chunk = 0;
+    self->slice_cell  = 0;
+    return 1;
+}
+
+/*
+
+=item C<static void gc_gms_scan_dirty_pmc(PARROT_INTERP, MarkSweep_GC *self,
+pmc_alloc_struct *item)>
+
+Step 5 of the incremental collection for one object of "dirty_list".  Sets
+the live bit and seals the object, so that the write barrier tells when it
+has to be scanned again.  CallContexts are always scanned again.
+
+=cut
+
+*/
+static void
+gc_gms_scan_dirty_pmc(PARROT_INTERP,
+        SHIM(MarkSweep_GC *self),
+        ARGMOD(pmc_alloc_struct *item))
+{
+    ASSERT_ARGS(gc_gms_scan_dirty_pmc)
+    PMC * const pmc = &(item->pmc);
+
+    PARROT_GC_ASSERT_INTERP(pmc, interp);
+
+    if (PObj_live_TEST(pmc))
+        return;
+
+    if (PObj_custom_mark_TEST(pmc))
+        VTABLE_mark(interp, pmc);
+
+    if (PMC_metadata(pmc))
+        Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+    /* Registers are written without the write barrier. Scan them again. */
+    if (pmc->vtable->base_type == enum_class_CallContext)
+        return;
+
+    PObj_live_SET(pmc);
+    /* inlined gc_gms_seal_object(interp, pmc); */
+    PObj_GC_need_write_barrier_SET(pmc);
+}
+
+/*
+
+=item C<static void gc_gms_rescan_dirty_list(PARROT_INTERP, MarkSweep_GC *self)>
+
+Step 5 in the last pause of the incremental collection.  Scans the objects
+of "dirty_list" which weren't scanned in a slice, or were written to since.
+Clears the live bit and the seal of the others.  Objects of the collected
+generations went to "dirty_list" while marking.  They are moved to the next
+generation like the survivors of the sweep.
+
+=cut
+
+*/
+static void
+gc_gms_rescan_dirty_list(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_rescan_dirty_list)
+
+    POINTER_ARRAY_ITER(self->dirty_list,
+        PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+        const size_t gen = POBJ2GEN(pmc);
+        PARROT_GC_ASSERT_INTERP(pmc, interp);
+
+        /* Survivors age like in sweep, or the objects referring to them
+         * would get older than they are. The oldest generation stays */
+        if (gen <= self->gen_to_collect && gen + 1 < GC_MAX_GENERATIONS)
+            SET_GEN_FLAGS(pmc, gen + 1);
+
+        if (PObj_live_TEST(pmc)) {
+            PObj_live_CLEAR(pmc);
+            /* inlined gc_gms_unseal_object(interp, pmc); */
+            PObj_GC_need_write_barrier_CLEAR(pmc);
+        }
+        else {
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+        });
+}
+
+/*
+
+=item C<static void gc_gms_blacken_pmc(PARROT_INTERP, MarkSweep_GC *self,
+pmc_alloc_struct *item)>
+
+Step 6 of the incremental collection for one object of "work_list".  Marks
+its children and moves it back to its generation sealed, so the write
+barrier catches new references stored in it.  Objects found on the C stack
+and CallContexts, whose registers the ops write directly, may still be filled
+without the write barrier.  They go to "dirty_list" instead and are scanned
+again in the last pause.
+
+=cut
+
+*/
+static void
+gc_gms_blacken_pmc(PARROT_INTERP,
+        ARGMOD(MarkSweep_GC *self),
+        ARGMOD(pmc_alloc_struct *item))
+{
+    ASSERT_ARGS(gc_gms_blacken_pmc)
+    PMC * const pmc = &(item->pmc);
+
+    PARROT_GC_ASSERT_INTERP(pmc, interp);
+
+    if (PObj_custom_mark_TEST(pmc))
+        VTABLE_mark(interp, pmc);
 
-    gc_gms_validate_objects(interp);
+    if (PMC_metadata(pmc))
+        Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
 
-DONE:
-    if (interp->thread_data)
-        UNLOCK(interp->thread_data->interp_lock);
+    Parrot_pa_remove(interp, self->work_list, item->ptr);
+
+    if (PObj_GC_soil_root_TEST(pmc)
+    ||  pmc->vtable->base_type == enum_class_CallContext) {
+        PObj_live_CLEAR(pmc);
+        PObj_GC_soil_root_CLEAR(pmc);
+        PObj_GC_on_dirty_list_SET(pmc);
+        item->ptr = Parrot_pa_insert(self->dirty_list, item);
+    }
+    else {
+        item->ptr = Parrot_pa_insert(self->objects[POBJ2GEN(pmc)], item);
+        /* inlined gc_gms_seal_object(interp, pmc); */
+        PObj_GC_need_write_barrier_SET(pmc);
+    }
 }
 
 /*
@@ -994,49 +1855,69 @@ gc_gms_cleanup_dirty_list(PARROT_INTERP,
     interp->gc_sys->mark_str_header = gc_gms_str_get_youngest_generation;
 
     POINTER_ARRAY_ITER(dirty_list,
-        pmc_alloc_struct *item = (pmc_alloc_struct *)ptr;
-        PMC              *pmc  = &(item->pmc);
-        size_t            gen  = POBJ2GEN(pmc);
+        gc_gms_cleanup_dirty_pmc(interp, self, (pmc_alloc_struct *)ptr););
 
-        self->youngest_child = gen;
-        PARROT_GC_ASSERT_INTERP(pmc, interp);
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
+    interp->gc_sys->mark_str_header = gc_gms_mark_str_header;
+}
 
-        if (PObj_custom_mark_TEST(pmc))
-            VTABLE_mark(interp, pmc);
+/*
 
-        if (PMC_metadata(pmc) && self->youngest_child > POBJ2GEN(PMC_metadata(pmc)))
-            self->youngest_child = POBJ2GEN(PMC_metadata(pmc));
+=item C<static void gc_gms_cleanup_dirty_pmc(PARROT_INTERP, MarkSweep_GC *self,
+pmc_alloc_struct *item)>
 
-        /* All children aren't younger than us - get rid of it */
-        if (self->youngest_child >= gen) {
-            PObj_live_CLEAR(pmc);
-            PObj_GC_on_dirty_list_CLEAR(pmc);
-            Parrot_pa_remove(interp, dirty_list, item->ptr);
-            item->ptr = Parrot_pa_insert(self->objects[gen], item);
-            /* inlined gc_gms_seal_object(interp, pmc); */
-            PObj_GC_need_write_barrier_SET(pmc);
-        }
-        else {
-            /* Survival */
-            /* This check used to be
-             * if ((gen <= self->gen_to_collect) && (gen < GC_MAX_GENERATIONS))
-             * Unfortunately it's wrong.
-             * Consider this:
-             * A1* -> B1* -> C0. (Object in generation notation. Star denotes "dirt
-             * During gen0 collecting will "sink" A object, but not B. This picture
-             * A2 -> B1* -> C1
-             * After collecting gen1 we'll sink all of them:
-             * A3 -> B2 -> C2.
-             * And after collecting of gen2 we'll collect B and C incorrectly.
-             * Because A(3) will be in older generation than B and C.
-             */
-            if (gen < GC_MAX_GENERATIONS) {
-                SET_GEN_FLAGS(pmc, gen + 1);
-            }
-        };);
+Step 3 for one object of "dirty_list".  Expects C<.mark_pmc_header> to be
+overridden with C<gc_gms_pmc_get_youngest_generation>.
 
-    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
-    interp->gc_sys->mark_str_header = gc_gms_mark_str_header;
+=cut
+
+*/
+static void
+gc_gms_cleanup_dirty_pmc(PARROT_INTERP,
+        ARGMOD(MarkSweep_GC *self),
+        ARGMOD(pmc_alloc_struct *item))
+{
+    ASSERT_ARGS(gc_gms_cleanup_dirty_pmc)
+    PMC          * const pmc = &(item->pmc);
+    const size_t         gen = POBJ2GEN(pmc);
+
+    self->youngest_child = gen;
+    PARROT_GC_ASSERT_INTERP(pmc, interp);
+
+    if (PObj_custom_mark_TEST(pmc))
+        VTABLE_mark(interp, pmc);
+
+    if (PMC_metadata(pmc) && self->youngest_child > POBJ2GEN(PMC_metadata(pmc)))
+        self->youngest_child = POBJ2GEN(PMC_metadata(pmc));
+
+    /* All children aren't younger than us - get rid of it */
+    if (self->youngest_child >= gen) {
+        PObj_live_CLEAR(pmc);
+        PObj_GC_on_dirty_list_CLEAR(pmc);
+        Parrot_pa_remove(interp, self->dirty_list, item->ptr);
+        item->ptr = Parrot_pa_insert(self->objects[gen], item);
+        /* inlined gc_gms_seal_object(interp, pmc); */
+        PObj_GC_need_write_barrier_SET(pmc);
+    }
+    else {
+        /* Survival */
+        /* This check used to be
+         * if ((gen <= self->gen_to_collect) && (gen < GC_MAX_GENERATIONS))
+         * Unfortunately it's wrong.
+         * Consider this:
+         * A1* -> B1* -> C0. (Object in generation notation. Star denotes "dirt
+         * During gen0 collecting will "sink" A object, but not B. This picture
+         * A2 -> B1* -> C1
+         * After collecting gen1 we'll sink all of them:
+         * A3 -> B2 -> C2.
+         * And after collecting of gen2 we'll collect B and C incorrectly.
+         * Because A(3) will be in older generation than B and C.
+         * The oldest generation has no objects list beyond it, so it stays.
+         */
+        if (gen + 1 < GC_MAX_GENERATIONS) {
+            SET_GEN_FLAGS(pmc, gen + 1);
+        }
+    }
 }
 
 /*
@@ -1113,11 +1994,338 @@ gc_gms_process_work_list(PARROT_INTERP,
 
 /*
 
+=item C<static void gc_gms_process_work_list_parallel(PARROT_INTERP,
+MarkSweep_GC *self, Parrot_Pointer_Array *work_list)>
+
+Parallel version of C<gc_gms_process_work_list>.  Objects in "work_list" are
+dealt out to C<mark_threads> workers.  Every worker marks from its own stack
+and steals from others when it runs dry.  Objects found during marking stay
+in their generation lists instead of moving through "work_list", so marking
+threads don't touch any shared list.  This thread works as worker 0.
+
+=cut
+
+*/
+static void
+gc_gms_process_work_list_parallel(PARROT_INTERP,
+        ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array *work_list))
+{
+    ASSERT_ARGS(gc_gms_process_work_list_parallel)
+    GC_Mark_Worker * const workers = self->mark_workers;
+    size_t                 next    = 0;
+    size_t                 i;
+
+    POINTER_ARRAY_ITER(work_list,
+        PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+        gc_gms_mark_stack_push(&workers[next].local, pmc);
+        next = (next + 1) % self->mark_threads;);
+
+    PARROT_ATOMIC_INT_SET(self->mark_idle, 0);
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header_parallel;
+
+    /* Wake the helpers, starting them on first use */
+    LOCK(self->mark_lock);
+    if (!self->mark_epoch)
+        for (i = 1; i < self->mark_threads; ++i)
+            THREAD_CREATE_JOINABLE(workers[i].thread, gc_gms_mark_thread, &workers[i]);
+    ++self->mark_epoch;
+    self->mark_running = self->mark_threads - 1;
+    COND_BROADCAST(self->mark_start);
+    UNLOCK(self->mark_lock);
+
+    gc_gms_mark_drain(interp, self, &workers[0]);
+
+    LOCK(self->mark_lock);
+    while (self->mark_running)
+        COND_WAIT(self->mark_done, self->mark_lock);
+    UNLOCK(self->mark_lock);
+
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
+
+    /* Move processed objects back to own generation */
+    POINTER_ARRAY_ITER(work_list,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        PMC              * const pmc  = &(item->pmc);
+        const size_t             gen  = POBJ2GEN(pmc);
+
+        PARROT_ASSERT(!PObj_GC_on_dirty_list_TEST(pmc));
+
+        Parrot_pa_remove(interp, work_list, item->ptr);
+        item->ptr = Parrot_pa_insert(self->objects[gen], item););
+}
+
+/*
+
+=item C<static void * gc_gms_mark_thread(void *data)>
+
+Entry point of marking threads.  C<data> is the GC_Mark_Worker to run.
+Marks once for every new C<mark_epoch> until the GC is finalized.
+
+=cut
+
+*/
+PARROT_CAN_RETURN_NULL
+static void *
+gc_gms_mark_thread(ARGIN(void *data))
+{
+    ASSERT_ARGS(gc_gms_mark_thread)
+    GC_Mark_Worker * const worker = (GC_Mark_Worker *)data;
+    Parrot_Interp    const interp = worker->interp;
+    MarkSweep_GC   * const self   = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    size_t                 epoch  = 0;
+
+    LOCK(self->mark_lock);
+    for (;;) {
+        while (self->mark_epoch == epoch && !self->mark_shutdown)
+            COND_WAIT(self->mark_start, self->mark_lock);
+
+        if (self->mark_shutdown)
+            break;
+
+        epoch = self->mark_epoch;
+        UNLOCK(self->mark_lock);
+
+        gc_gms_mark_drain(interp, self, worker);
+
+        LOCK(self->mark_lock);
+        if (!--self->mark_running)
+            COND_SIGNAL(self->mark_done);
+    }
+    UNLOCK(self->mark_lock);
+
+    return NULL;
+}
+
+/*
+
+=item C<static void gc_gms_finalize_mark_workers(PARROT_INTERP)>
+
+Stop the marking threads and release the parallel marking state.  Only the
+parallel marker sets this as C<finalize_gc_system>; GMS hands all its
+objects to the parent interpreter otherwise.
+
+=cut
+
+*/
+static void
+gc_gms_finalize_mark_workers(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_gms_finalize_mark_workers)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    size_t i;
+
+    LOCK(self->mark_lock);
+    self->mark_shutdown = 1;
+    COND_BROADCAST(self->mark_start);
+    UNLOCK(self->mark_lock);
+
+    for (i = 0; i < self->mark_threads; ++i) {
+        GC_Mark_Worker * const worker = &self->mark_workers[i];
+
+        if (i && self->mark_epoch) {
+            void *ret;
+            JOIN(worker->thread, ret);
+            UNUSED(ret);
+        }
+
+        MUTEX_DESTROY(worker->lock);
+        if (worker->local.items)
+            mem_internal_free(worker->local.items);
+        if (worker->shared.items)
+            mem_internal_free(worker->shared.items);
+    }
+
+    mem_internal_free(self->mark_workers);
+    self->mark_workers = NULL;
+    self->mark_threads = 1;
+
+    COND_DESTROY(self->mark_start);
+    COND_DESTROY(self->mark_done);
+    MUTEX_DESTROY(self->mark_lock);
+    THREAD_KEY_DELETE(self->mark_worker_key);
+}
+
+/*
+
+=item C<static void gc_gms_mark_drain(PARROT_INTERP, MarkSweep_GC *self,
+GC_Mark_Worker *worker)>
+
+Mark objects from the stack of C<worker> until no worker has grey objects
+left.  Hands over part of the stack whenever other workers are idle.
+
+=cut
+
+*/
+static void
+gc_gms_mark_drain(PARROT_INTERP,
+        ARGIN(MarkSweep_GC *self),
+        ARGMOD(GC_Mark_Worker *worker))
+{
+    ASSERT_ARGS(gc_gms_mark_drain)
+
+    THREAD_KEY_SET(self->mark_worker_key, worker);
+
+    do {
+        while (worker->local.size) {
+            PMC * const pmc = worker->local.items[--worker->local.size];
+            INTVAL      idle;
+
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+            /* Feed idle workers. Only we add to our shared stack. */
+            PARROT_ATOMIC_INT_GET(idle, self->mark_idle);
+            if (idle && worker->local.size > 1 && !worker->shared.size) {
+                LOCK(worker->lock);
+                gc_gms_mark_stack_move(&worker->shared, &worker->local,
+                    worker->local.size / 2 > GC_GMS_MARK_SHARE_BATCH
+                        ? GC_GMS_MARK_SHARE_BATCH
+                        : worker->local.size / 2);
+                UNLOCK(worker->lock);
+            }
+        }
+    } while (gc_gms_mark_find_work(self, worker));
+
+    THREAD_KEY_SET(self->mark_worker_key, NULL);
+}
+
+/*
+
+=item C<static int gc_gms_mark_find_work(MarkSweep_GC *self, GC_Mark_Worker
+*worker)>
+
+Refill the empty stack of C<worker> from shared stacks.  Waits as long as
+some worker still marks.  Returns 0 when marking is done.
+
+A worker only counts itself idle with both its stacks empty, and only busy
+workers fill shared stacks.  So once all workers are idle no grey objects
+are left.
+
+=cut
+
+*/
+static int
+gc_gms_mark_find_work(ARGIN(MarkSweep_GC *self), ARGMOD(GC_Mark_Worker *worker))
+{
+    ASSERT_ARGS(gc_gms_mark_find_work)
+    const INTVAL n = (INTVAL)self->mark_threads;
+    INTVAL       idle;
+
+    if (gc_gms_mark_steal(self, worker))
+        return 1;
+
+    PARROT_ATOMIC_INT_INC(idle, self->mark_idle);
+
+    while (idle < n) {
+        size_t i;
+
+        for (i = 0; i < self->mark_threads; ++i)
+            if (self->mark_workers[i].shared.size)
+                break;
+
+        if (i < self->mark_threads) {
+            PARROT_ATOMIC_INT_DEC(idle, self->mark_idle);
+            if (gc_gms_mark_steal(self, worker))
+                return 1;
+            PARROT_ATOMIC_INT_INC(idle, self->mark_idle);
+        }
+        else {
+            YIELD;
+            PARROT_ATOMIC_INT_GET(idle, self->mark_idle);
+        }
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<static int gc_gms_mark_steal(MarkSweep_GC *self, GC_Mark_Worker
+*worker)>
+
+Take grey objects from the shared stacks, starting with the own one.  Takes
+half of the stack of another worker.  Returns 1 if it got any.
+
+=cut
+
+*/
+static int
+gc_gms_mark_steal(ARGIN(MarkSweep_GC *self), ARGMOD(GC_Mark_Worker *worker))
+{
+    ASSERT_ARGS(gc_gms_mark_steal)
+    size_t i;
+
+    for (i = 0; i < self->mark_threads; ++i) {
+        GC_Mark_Worker * const victim =
+                &self->mark_workers[(worker->id + i) % self->mark_threads];
+
+        if (!victim->shared.size)
+            continue;
+
+        LOCK(victim->lock);
+        gc_gms_mark_stack_move(&worker->local, &victim->shared,
+            victim == worker
+                ? victim->shared.size
+                : (victim->shared.size + 1) / 2);
+        UNLOCK(victim->lock);
+
+        if (worker->local.size)
+            return 1;
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<static void gc_gms_mark_stack_push(GC_Mark_Stack *stack, PMC *pmc)>
+
+Push C<pmc> onto C<stack>.
+
+=item C<static void gc_gms_mark_stack_move(GC_Mark_Stack *to, GC_Mark_Stack
+*from, size_t count)>
+
+Move C<count> objects from the top of C<from> to C<to>.
+
+=cut
+
+*/
+static void
+gc_gms_mark_stack_push(ARGMOD(GC_Mark_Stack *stack), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_stack_push)
+
+    if (stack->size == stack->allocated) {
+        stack->allocated = stack->allocated ? stack->allocated * 2 : 1024;
+        mem_internal_realloc_n_typed(stack->items, stack->allocated, PMC *);
+    }
+
+    stack->items[stack->size++] = pmc;
+}
+
+static void
+gc_gms_mark_stack_move(ARGMOD(GC_Mark_Stack *to), ARGMOD(GC_Mark_Stack *from),
+        size_t count)
+{
+    ASSERT_ARGS(gc_gms_mark_stack_move)
+
+    PARROT_ASSERT(count <= from->size);
+
+    while (count--)
+        gc_gms_mark_stack_push(to, from->items[--from->size]);
+}
+
+/*
+
 =item C<static void gc_gms_sweep_pools(PARROT_INTERP, MarkSweep_GC *self)>
 
 Sweep generations starting from K:
     - Destroy all dead objects
-    - Move live objects into generation max(K+1, N)
+    - Move live objects into generation min(K+1, N-1)
     - Paint them white.
 
 =cut
@@ -1132,7 +2340,7 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
     for (i = self->gen_to_collect; i >= 0; i--) {
         /* Don't move to generation beyond last */
-        const int move_to_old = i != GC_MAX_GENERATIONS;
+        const int move_to_old = i + 1 < GC_MAX_GENERATIONS;
 
         POINTER_ARRAY_ITER(self->objects[i],
             pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
@@ -1201,7 +2409,7 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
             else {
                 Parrot_pa_remove(interp, self->strings[i], item->ptr);
-                if (Buffer_bufstart(str) && !PObj_external_TEST(str))
+                if (Buffer_bufstart(str) && (!PObj_external_TEST(str) || PObj_mapped_TEST(str)))
                     Parrot_gc_str_free_buffer_storage(
                         interp, &self->string_gc, (Parrot_Buffer*)str);
 
@@ -1257,6 +2465,10 @@ gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
     /* mark it live. */
     PObj_live_SET(pmc);
 
+    /* Grey objects are marked anyway. Seal them again once they are black */
+    if (self->incremental)
+        PObj_GC_need_write_barrier_CLEAR(pmc);
+
     /* empty work_list. not from last gc_gms_validate_objects in m&s */
     if (!self->work_list)
         self->work_list = Parrot_pa_new(interp);
@@ -1266,6 +2478,48 @@ gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
 
 /*
 
+=item C<static void gc_gms_mark_pmc_header_parallel(PARROT_INTERP, PMC *pmc)>
+
+mark as grey during parallel marking. Marking threads race for the live bit,
+so it's set with compare-and-swap.  The winner pushes the object onto its
+own stack.
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_pmc_header_parallel)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    UINTVAL              flags;
+
+    PARROT_ASSERT(!PObj_on_free_list_TEST(pmc)
+        || !"Resurrecting of dead objects is not supported");
+
+    do {
+        flags = pmc->flags;
+
+        /* Object was already marked as grey. Or live. Or dead. Skip it */
+        if (flags & PObj_live_FLAG)
+            return;
+
+        /* If object too old - skip it */
+        if (POBJ2GEN(pmc) > self->gen_to_collect)
+            return;
+
+        /* Object is on dirty_list. */
+        if (flags & PObj_GC_on_dirty_list_FLAG)
+            return;
+    } while (!PObj_flags_CAS(pmc, flags, flags | PObj_live_FLAG));
+
+    gc_gms_mark_stack_push(
+        &((GC_Mark_Worker *)THREAD_KEY_GET(self->mark_worker_key))->local, pmc);
+}
+
+/*
+
 =item C<static void gc_gms_mark_str_header(PARROT_INTERP, STRING *str)>
 
 Mark String
@@ -1287,7 +2541,9 @@ gc_gms_mark_str_header(SHIM_INTERP, ARGMOD(STRING *str))
 
 =item C<static void gc_gms_compact_memory_pool(PARROT_INTERP)>
 
-Stub for compacting memory pools.
+Compacts the string pool on request.  Skipped while another thread blocks
+the GC with C<Parrot_block_GC_mark_locked()>, as it may be reading our
+strings.
 
 =cut
 
@@ -1298,7 +2554,14 @@ gc_gms_compact_memory_pool(PARROT_INTERP)
     ASSERT_ARGS(gc_gms_compact_memory_pool)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
-    Parrot_gc_str_compact_pool(interp, &self->string_gc);
+    if (interp->thread_data)
+        LOCK(interp->thread_data->interp_lock);
+
+    if (!self->gc_mark_block_level_locked)
+        Parrot_gc_str_compact_pool(interp, &self->string_gc);
+
+    if (interp->thread_data)
+        UNLOCK(interp->thread_data->interp_lock);
 }
 
 /*
@@ -1350,18 +2613,16 @@ gc_gms_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     const size_t  attr_size = pmc->vtable->attr_size;
 
-    if (interp->thread_data)
-        LOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_LOCK(interp, self);
 
-    PMC_data(pmc) = Parrot_gc_fixed_allocator_allocate(interp,
+    PMC_data(pmc) = Parrot_gc_fixed_allocator_allocate_fast(interp,
                         self->fixed_size_allocator, attr_size);
     memset(PMC_data(pmc), 0, attr_size);
 
     interp->gc_sys->stats.memory_used           += attr_size;
     interp->gc_sys->stats.mem_used_last_collect += attr_size;
 
-    if (interp->thread_data)
-        UNLOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_UNLOCK(interp, self);
 
     return PMC_data(pmc);
 }
@@ -1407,16 +2668,14 @@ gc_gms_allocate_fixed_size_storage(PARROT_INTERP, size_t size)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     void *storage;
 
-    if (interp->thread_data)
-        LOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_LOCK(interp, self);
 
     interp->gc_sys->stats.memory_used           += size;
     interp->gc_sys->stats.mem_used_last_collect += size;
 
-    storage = Parrot_gc_fixed_allocator_allocate(interp, self->fixed_size_allocator, size);
+    storage = Parrot_gc_fixed_allocator_allocate_fast(interp, self->fixed_size_allocator, size);
 
-    if (interp->thread_data)
-        UNLOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_UNLOCK(interp, self);
 
     return storage;
 }
@@ -1456,6 +2715,18 @@ gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
         return GC_MAX_GENERATIONS;
       case IMPATIENT_PMCS:
         return self->num_early_gc_PMCs;
+      case GC_MARK_THREADS:
+        return self->mark_threads;
+      case GC_TRACE_ROOTS_TIME:
+        return TICKS2USEC(self->time_trace_roots);
+      case GC_DIRTY_LIST_TIME:
+        return TICKS2USEC(self->time_dirty_list);
+      case GC_WORK_LIST_TIME:
+        return TICKS2USEC(self->time_work_list);
+      case GC_SWEEP_TIME:
+        return TICKS2USEC(self->time_sweep);
+      case GC_MARK_SLICES:
+        return self->mark_slices;
       case TOTAL_PMCS: {
         /* It's higher than actual number of allocated PMCs */
         size_t ret = 0;
@@ -1523,10 +2794,33 @@ static void
 gc_gms_maybe_mark_and_sweep(PARROT_INTERP, UINTVAL flags) {
     MarkSweep_GC * const self = (MarkSweep_GC *)(interp)->gc_sys->gc_private;
 
+    if (self->gc_mark_block_level || self->gc_mark_block_level_locked)
+        return;
+
+    if (self->incremental) {
+        /* Marking doesn't keep up with allocation. Finish it in one go */
+        if (interp->gc_sys->stats.mem_used_last_collect > 2 * self->gc_threshold) {
+            if (interp->thread_data)
+                LOCK(interp->thread_data->interp_lock);
+            if (!self->gc_mark_block_level_locked)
+                gc_gms_finish_incremental(interp, self);
+            if (interp->thread_data)
+                UNLOCK(interp->thread_data->interp_lock);
+        }
+        else if (++self->slice_allocs >= GC_GMS_SLICE_ALLOCS) {
+            self->slice_allocs = 0;
+            gc_gms_mark_slice(interp);
+        }
+        return;
+    }
+
     /* Collect every gc_threshold. */
-    if (!self->gc_mark_block_level
-    && interp->gc_sys->stats.mem_used_last_collect > self->gc_threshold)
-        gc_gms_mark_and_sweep(interp, flags);
+    if (interp->gc_sys->stats.mem_used_last_collect > self->gc_threshold) {
+        if (self->max_pause)
+            gc_gms_start_incremental(interp);
+        else
+            gc_gms_mark_and_sweep(interp, flags);
+    }
 }
 
 PARROT_MALLOC
@@ -1541,8 +2835,7 @@ gc_gms_allocate_pmc_header(PARROT_INTERP, SHIM(UINTVAL flags))
 
     gc_gms_maybe_mark_and_sweep(interp, 0);
 
-    if (interp->thread_data)
-        LOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_LOCK(interp, self);
 
     /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
     ++interp->gc_sys->stats.header_allocs_since_last_collect;
@@ -1550,11 +2843,10 @@ gc_gms_allocate_pmc_header(PARROT_INTERP, SHIM(UINTVAL flags))
     interp->gc_sys->stats.memory_used           += sizeof (PMC);
     interp->gc_sys->stats.mem_used_last_collect += sizeof (PMC);
 
-    item         = (pmc_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
+    item         = (pmc_alloc_struct *)Parrot_gc_pool_allocate_fast(interp, pool);
     item->ptr    = Parrot_pa_insert(self->objects[0], item);
 
-    if (interp->thread_data)
-        UNLOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_UNLOCK(interp, self);
 
     return &(item->pmc);
 }
@@ -1581,7 +2873,12 @@ gc_gms_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
 
         self->locked = 1;
 
-        Parrot_pa_remove(interp, self->objects[gen], PMC2PAC(pmc)->ptr);
+        /* Grey objects of an incremental collection wait on work_list */
+        if (self->incremental && PObj_live_TEST(pmc)
+        && !PObj_GC_need_write_barrier_TEST(pmc))
+            Parrot_pa_remove(interp, self->work_list, PMC2PAC(pmc)->ptr);
+        else
+            Parrot_pa_remove(interp, self->objects[gen], PMC2PAC(pmc)->ptr);
         PObj_on_free_list_SET(pmc);
 
         Parrot_pmc_destroy(interp, pmc);
@@ -1683,8 +2980,7 @@ gc_gms_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
 
     gc_gms_maybe_mark_and_sweep(interp, 0);
 
-    if (interp->thread_data)
-        LOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_LOCK(interp, self);
 
     /* Increase used memory.
      * Not precisely accurate due to Pool_Allocator paging.  */
@@ -1692,11 +2988,10 @@ gc_gms_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
     interp->gc_sys->stats.memory_used           += sizeof (STRING);
     interp->gc_sys->stats.mem_used_last_collect += sizeof (STRING);
 
-    item = (string_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
+    item = (string_alloc_struct *)Parrot_gc_pool_allocate_fast(interp, pool);
     item->ptr = Parrot_pa_insert(self->strings[0], item);
 
-    if (interp->thread_data)
-        UNLOCK(interp->thread_data->interp_lock);
+    GMS_ALLOC_UNLOCK(interp, self);
 
     ret = &(item->str);
     memset(ret, 0, sizeof (STRING));
@@ -1714,7 +3009,7 @@ gc_gms_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 
         Parrot_pa_remove(interp, self->strings[gen], STR2PAC(s)->ptr);
 
-        if (Buffer_bufstart(s) && !PObj_external_TEST(s))
+        if (Buffer_bufstart(s) && (!PObj_external_TEST(s) || PObj_mapped_TEST(s)))
             Parrot_gc_str_free_buffer_storage(interp,
                 &self->string_gc, (Parrot_Buffer *)s);
 
@@ -2129,10 +3424,18 @@ gc_gms_write_barrier(PARROT_INTERP, ARGMOD(PMC *pmc))
         const size_t             gen  = POBJ2GEN(pmc);
         pmc_alloc_struct * const item = PMC2PAC(pmc);
 
-        if (pmc->flags & PObj_GC_on_dirty_list_FLAG)
+        /* Scanned by the incremental collection already. Scan it again in
+         * its last pause */
+        if (pmc->flags & PObj_GC_on_dirty_list_FLAG) {
+            PObj_live_CLEAR(pmc);
+            /* inlined gc_gms_unseal_object(interp, pmc); */
+            PObj_GC_need_write_barrier_CLEAR(pmc);
             goto DONE;
+        }
 
-        if (!gen)
+        /* Only black objects of the nursery are sealed, during incremental
+         * marking */
+        if (!gen && !self->incremental)
             goto DONE;
 
         PARROT_GC_ASSERT_INTERP(pmc, interp);
@@ -2146,6 +3449,8 @@ gc_gms_write_barrier(PARROT_INTERP, ARGMOD(PMC *pmc))
         item->ptr = Parrot_pa_insert(self->dirty_list, item);
 
         PObj_GC_on_dirty_list_SET(pmc);
+        /* Objects on dirty_list are marked through, but never swept */
+        PObj_live_CLEAR(pmc);
         /* We don't need it anymore */
         /* inlined gc_gms_unseal_object(interp, pmc); */
         PObj_GC_need_write_barrier_CLEAR(pmc);
@@ -9,6 +9,13 @@ src/gc/gc_ms2.c - Non-recursive M&S
 
 This program implements a non-recursive M&S garbage collection.
 
+Only marking stops the world.  The PMCs found dead stay in C<unswept_objects>
+and are destroyed a chunk at a time whenever C<gc_ms2_allocate_pmc_header>
+runs out of free headers; what is left is swept before the next mark.  With
+C<--gc-threads> above 1 a sweeper thread frees the dead PMCs without custom
+destroy meanwhile.  STRING headers are swept right after marking, because
+compacting the string pool depends on it.
+
 =cut
 
 */
@@ -45,6 +52,14 @@ typedef struct MarkSweep_GC {
     struct Parrot_Pointer_Array    *objects;
     /* During M&S gather new live objects in this list */
     struct Parrot_Pointer_Array    *new_objects;
+    /* Dead objects of the last M&S, destroyed a chunk at a time on demand */
+    struct Parrot_Pointer_Array    *unswept_objects;
+    /* Next chunk of unswept_objects to sweep */
+    size_t                          unswept_next;
+    /* Chunks from unswept_end on are claimed by the sweeper thread */
+    size_t                          unswept_end;
+    /* Memory used after the last M&S, less what was swept since */
+    size_t                          unswept_live;
 
     /* Allocator for strings */
     struct Pool_Allocator          *string_allocator;
@@ -66,8 +81,37 @@ typedef struct MarkSweep_GC {
     size_t gc_threshold;      /* Number of allocated bytes before GC is triggered */
 
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
+
+    /* Background sweeper, frees dead PMCs without custom destroy */
+    int           sweep_thread;     /* Enabled with --gc-threads > 1 */
+    int           sweeper_wanted;   /* Start it on the next allocation */
+    int           sweeper_running;  /* Owned by the interpreter's thread */
+    int           sweeper_stop;     /* Protected by sweep_lock */
+    int           sweeper_done;     /* Set by the sweeper when it runs out */
+    size_t        sweeper_freed;    /* Bytes freed by the sweeper */
+    Parrot_thread sweeper;
+    /* Protects pmc_allocator and fixed_size_allocator while it runs */
+    Parrot_mutex  sweep_lock;
 } MarkSweep_GC;
 
+/* Don't take sweep_lock unless the sweeper thread shares the allocators.
+ * Allocating a new arena may ask for a GC, which would wait for the sweeper
+ * while holding the lock, so GC is blocked meanwhile. */
+#define SWEEP_LOCK(self) \
+    do { \
+        if ((self)->sweeper_running) { \
+            LOCK((self)->sweep_lock); \
+            ++(self)->gc_mark_block_level; \
+        } \
+    } while (0)
+#define SWEEP_UNLOCK(self) \
+    do { \
+        if ((self)->sweeper_running) { \
+            --(self)->gc_mark_block_level; \
+            UNLOCK((self)->sweep_lock); \
+        } \
+    } while (0)
+
 /* HEADERIZER HFILE: src/gc/gc_private.h */
 
 /* HEADERIZER BEGIN: static */
@@ -147,6 +191,12 @@ static void gc_ms2_destroy_pmc_pool(PARROT_INTERP,
 static void gc_ms2_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_finish_lazy_sweep(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_ms2_free_buffer_header(PARROT_INTERP,
     ARGFREE(Parrot_Buffer *s),
     size_t size)
@@ -260,6 +310,30 @@ static void gc_ms2_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+static void gc_ms2_start_sweeper(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_ms2_stop_sweeper(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_ms2_sweep_lazily(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_ms2_sweep_pmc_chunk(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(Parrot_Pointer_Array_Chunk *chunk))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*chunk);
+
 static void gc_ms2_sweep_pmc_pool(PARROT_INTERP,
     ARGIN(Pool_Allocator *pool),
     ARGIN(Parrot_Pointer_Array *list))
@@ -274,6 +348,10 @@ static void gc_ms2_sweep_string_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CAN_RETURN_NULL
+static void * gc_ms2_sweeper_thread(ARGIN(void *data))
+        __attribute__nonnull__(1);
+
 static void gc_ms2_unblock_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -283,6 +361,12 @@ static void gc_ms2_unblock_GC_move(PARROT_INTERP)
 static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_update_threshold(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_ms2_validate_objects(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -333,6 +417,9 @@ static void gc_ms2_validate_str(PARROT_INTERP, ARGIN(STRING *str))
     , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_gc_ms2_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_finish_lazy_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_free_fixed_size_storage \
@@ -397,6 +484,19 @@ static void gc_ms2_validate_str(PARROT_INTERP, ARGIN(STRING *str))
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_ms2_start_sweeper __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_stop_sweeper __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_sweep_lazily __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_sweep_pmc_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(chunk))
 #define ASSERT_ARGS_gc_ms2_sweep_pmc_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
@@ -405,12 +505,17 @@ static void gc_ms2_validate_str(PARROT_INTERP, ARGIN(STRING *str))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_sweeper_thread __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(data))
 #define ASSERT_ARGS_gc_ms2_unblock_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_unblock_GC_move __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_unblock_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_update_threshold __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_validate_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_validate_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -510,8 +615,10 @@ gc_ms2_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
     MarkSweep_GC * const self = (MarkSweep_GC *)gc_sys->gc_private;
     const size_t  attr_size = pmc->vtable->attr_size;
 
-    PMC_data(pmc)           = Parrot_gc_fixed_allocator_allocate(interp,
+    SWEEP_LOCK(self);
+    PMC_data(pmc)           = Parrot_gc_fixed_allocator_allocate_fast(interp,
                                 self->fixed_size_allocator, attr_size);
+    SWEEP_UNLOCK(self);
 
     memset(PMC_data(pmc), 0, attr_size);
 
@@ -530,8 +637,10 @@ gc_ms2_free_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
     if (PMC_data(pmc)) {
         struct GC_Subsystem * const gc_sys = interp->gc_sys;
         MarkSweep_GC * const self = (MarkSweep_GC *)gc_sys->gc_private;
+        SWEEP_LOCK(self);
         Parrot_gc_fixed_allocator_free(interp, self->fixed_size_allocator,
                 PMC_data(pmc), pmc->vtable->attr_size);
+        SWEEP_UNLOCK(self);
 
         if (!PObj_constant_TEST(pmc))
             gc_sys->stats.memory_used -= pmc->vtable->attr_size;
@@ -546,11 +655,16 @@ gc_ms2_allocate_fixed_size_storage(PARROT_INTERP, size_t size)
     ASSERT_ARGS(gc_ms2_allocate_fixed_size_storage)
     struct GC_Subsystem * const gc_sys = interp->gc_sys;
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    void         *data;
 
     gc_sys->stats.memory_used += size;
 
-    return Parrot_gc_fixed_allocator_allocate(interp,
+    SWEEP_LOCK(self);
+    data = Parrot_gc_fixed_allocator_allocate_fast(interp,
                 self->fixed_size_allocator, size);
+    SWEEP_UNLOCK(self);
+
+    return data;
 }
 
 
@@ -564,8 +678,10 @@ gc_ms2_free_fixed_size_storage(PARROT_INTERP, size_t size, ARGFREE_NOTNULL(void
 
         gc_sys->stats.memory_used -= size;
 
+        SWEEP_LOCK(self);
         Parrot_gc_fixed_allocator_free(interp, self->fixed_size_allocator,
                                          data, size);
+        SWEEP_UNLOCK(self);
     }
 }
 
@@ -712,6 +828,13 @@ Parrot_gc_ms2_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
                                 : GC_DEFAULT_MIN_THRESHOLD;
         self->gc_threshold      = self->min_threshold;
 
+#ifdef PARROT_HAS_THREADS
+        if (args->mark_threads > 1) {
+            self->sweep_thread = 1;
+            MUTEX_INIT(self->sweep_lock);
+        }
+#endif
+
         Parrot_gc_str_initialize(interp, &self->string_gc);
     }
 
@@ -733,10 +856,12 @@ static void
 gc_ms2_finalize(PARROT_INTERP)
 {
     ASSERT_ARGS(gc_ms2_finalize)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    gc_ms2_finish_lazy_sweep(interp, self);
 
     if (!interp->parent_interpreter) {
         struct GC_Subsystem * const gc_sys = interp->gc_sys;
-        MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
         gc_ms2_print_stats(interp, "ms2 finalize");
         Parrot_gc_str_finalize(interp, &self->string_gc);
@@ -747,6 +872,9 @@ gc_ms2_finalize(PARROT_INTERP)
         Parrot_gc_pool_destroy(interp, self->string_allocator);
         Parrot_gc_fixed_allocator_destroy(interp, self->fixed_size_allocator);
 
+        if (self->sweep_thread)
+            MUTEX_DESTROY(self->sweep_lock);
+
         /* now free this GC system */
         mem_sys_free(self);
         gc_sys->gc_private = NULL;
@@ -768,7 +896,14 @@ gc_ms2_allocate_pmc_header(PARROT_INTERP, UINTVAL flags)
     if (!(flags & PObj_constant_FLAG))
         gc_sys->stats.memory_used += sizeof (PMC);
 
-    ptr = (pmc_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
+    /* Out of free headers: sweep some dead objects of the last M&S */
+    if (self->unswept_objects
+    && (!pool->free_list || self->sweeper_wanted || self->sweeper_done))
+        gc_ms2_sweep_lazily(interp, self);
+
+    SWEEP_LOCK(self);
+    ptr = (pmc_alloc_struct *)Parrot_gc_pool_allocate_fast(interp, pool);
+    SWEEP_UNLOCK(self);
     ptr->ptr = Parrot_pa_insert(self->objects, ptr);
 
     return &ptr->pmc;
@@ -783,14 +918,27 @@ gc_ms2_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
     if (pmc) {
+        pmc_alloc_struct * const item = PMC2PAC(pmc);
+
         if (PObj_on_free_list_TEST(pmc))
             return;
-        Parrot_pa_remove(interp, self->objects, PMC2PAC(pmc)->ptr);
+
+        /* Constant PMCs allocated before the last M&S are still listed in
+         * unswept_objects.  The sweeper may be looking at the cell. */
+        if (self->unswept_objects && PObj_constant_TEST(pmc)
+        &&  Parrot_pa_is_owned(self->unswept_objects, item, item->ptr)) {
+            gc_ms2_stop_sweeper(interp, self);
+            Parrot_pa_remove(interp, self->unswept_objects, item->ptr);
+        }
+        else
+            Parrot_pa_remove(interp, self->objects, item->ptr);
         PObj_on_free_list_SET(pmc);
 
         Parrot_pmc_destroy(interp, pmc);
 
-        Parrot_gc_pool_free(interp, self->pmc_allocator, PMC2PAC(pmc));
+        SWEEP_LOCK(self);
+        Parrot_gc_pool_free(interp, self->pmc_allocator, item);
+        SWEEP_UNLOCK(self);
 
         if (!PObj_constant_TEST(pmc))
             gc_sys->stats.memory_used -= sizeof (PMC);
@@ -886,7 +1034,7 @@ gc_ms2_allocate_string_header(PARROT_INTERP, UINTVAL flags)
     if (!(flags & PObj_constant_FLAG))
         gc_sys->stats.memory_used += sizeof (STRING);
 
-    ptr = (string_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
+    ptr = (string_alloc_struct *)Parrot_gc_pool_allocate_fast(interp, pool);
     ptr->ptr = Parrot_pa_insert(self->strings, ptr);
 
     ret = &ptr->str;
@@ -906,7 +1054,7 @@ gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 
         Parrot_pa_remove(interp, self->strings, STR2PAC(s)->ptr);
 
-        if (Buffer_bufstart(s) && !PObj_external_TEST(s))
+        if (Buffer_bufstart(s) && (!PObj_external_TEST(s) || PObj_mapped_TEST(s)))
             Parrot_gc_str_free_buffer_storage(interp,
                 &self->string_gc, (Parrot_Buffer *)s);
 
@@ -1123,7 +1271,6 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     struct GC_Subsystem * const gc_sys = interp->gc_sys;
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     GC_Statistics       *stats;
-    size_t               threshold;
 
     if (interp->thread_data)
         LOCK(interp->thread_data->interp_lock);
@@ -1138,6 +1285,10 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         goto DONE;
 
     ++self->gc_mark_block_level;
+
+    /* Dead objects of the previous run must be gone before marking */
+    gc_ms2_finish_lazy_sweep(interp, self);
+
     gc_ms2_mark_live_objects(interp, self, flags);
 
     /* At this point of time new_objects contains only live PMCs */
@@ -1146,42 +1297,45 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     /* sweep of objects will destroy dead objects leaving only "constant" */
     gc_ms2_print_stats(interp, "Sweep new pmc objects");
     gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->new_objects);
-    gc_ms2_print_stats(interp, "Sweep old pmc objects");
-    gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->objects);
     gc_ms2_sweep_string_pool(interp, self->string_allocator, self->strings);
 
     /* destroy the rest */
     if (flags & GC_finish_FLAG) {
+        gc_ms2_print_stats(interp, "Sweep old pmc objects");
+        gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->objects);
         gc_ms2_print_stats(interp, "Destroy old pmc objects");
         gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->objects);
         gc_ms2_print_stats(interp, "Destroy new pmc objects");
         gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->new_objects);
     }
 
-    /* Replace objects with new_objects. Ignoring "constant" one */
+    /* Replace objects with new_objects. Old objects are swept lazily by
+     * gc_ms2_allocate_pmc_header, so the pause ends with marking */
     do {
         Parrot_Pointer_Array * const tmp = self->objects;
         self->objects = self->new_objects;
-        Parrot_pa_destroy(interp, tmp);
+
+        if (flags & GC_finish_FLAG)
+            Parrot_pa_destroy(interp, tmp);
+        else {
+            self->unswept_objects = tmp;
+            self->unswept_next    = 0;
+            self->unswept_end     = tmp->total_chunks;
+            self->sweeper_wanted  = self->sweep_thread;
+        }
     } while (0);
 
-    /* We swept all dead objects */
+    /* We swept all dead strings */
     gc_ms2_print_stats(interp, "Compact memory pool");
     gc_ms2_compact_memory_pool(interp);
 
     stats = &gc_sys->stats;
-    stats->mem_used_last_collect = stats->memory_used;
     stats->gc_mark_runs++;
 
-    /* The dynamic threshold is a configurable percentage of the amount of
-       memory used after the last GC */
-    threshold = (size_t)(stats->mem_used_last_collect *
-                         (0.01 * self->dynamic_threshold));
-
-    if (threshold < self->min_threshold)
-        threshold = self->min_threshold;
-
-    self->gc_threshold = stats->mem_used_last_collect + threshold;
+    /* Dead PMCs are still accounted for; the threshold is lowered once they
+     * are swept */
+    self->unswept_live = stats->memory_used;
+    gc_ms2_update_threshold(interp, self);
 
     self->gc_mark_block_level--;
     self->num_early_gc_PMCs = 0;
@@ -1292,6 +1446,330 @@ gc_ms2_destroy_pmc_pool(PARROT_INTERP,
         Parrot_gc_pool_free(interp, pool, ptr););
 }
 
+/*
+
+=item C<static void gc_ms2_sweep_pmc_chunk(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array_Chunk *chunk)>
+
+Destroys the dead PMCs in one C<chunk> of C<unswept_objects> and repaints the
+live "constant" ones white.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_pmc_chunk(PARROT_INTERP, ARGMOD(MarkSweep_GC *self),
+        ARGMOD(Parrot_Pointer_Array_Chunk *chunk))
+{
+    ASSERT_ARGS(gc_ms2_sweep_pmc_chunk)
+    struct GC_Subsystem * const gc_sys = interp->gc_sys;
+    size_t i;
+
+    for (i = 0; i < CELL_PER_CHUNK - chunk->num_free; ++i) {
+        void * const ptr = chunk->data[i];
+        PMC         *pmc;
+
+        if ((ptrcast_t)ptr & 1)
+            continue;
+
+        pmc = &((pmc_alloc_struct *)ptr)->pmc;
+
+        if (PObj_live_TEST(pmc))
+            PObj_live_CLEAR(pmc);
+
+        else if (!PObj_constant_TEST(pmc)) {
+            GC_DEBUG_DETAIL_FLAGS("GC destroy pmc ", pmc);
+            Parrot_pa_remove(interp, self->unswept_objects, PMC2PAC(pmc)->ptr);
+
+            if (PObj_custom_destroy_TEST(pmc))
+                VTABLE_destroy(interp, pmc);
+
+            if (pmc->vtable->attr_size && PMC_data(pmc))
+                Parrot_gc_free_pmc_attributes(interp, pmc);
+            PMC_data(pmc) = NULL;
+
+            gc_sys->stats.memory_used -= sizeof (PMC);
+
+            PObj_on_free_list_SET(pmc);
+            PObj_gc_CLEAR(pmc);
+
+            SWEEP_LOCK(self);
+            Parrot_gc_pool_free(interp, self->pmc_allocator, ptr);
+            SWEEP_UNLOCK(self);
+        }
+    }
+}
+
+
+/*
+
+=item C<static void gc_ms2_sweep_lazily(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweeps the next chunk of C<unswept_objects>.  Called when allocating a PMC
+finds the pool without free headers, so dead objects are destroyed as their
+memory is needed instead of all at once at the end of M&S.  The last call
+frees the list and lowers the GC threshold to the memory really in use.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_lazily(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_sweep_lazily)
+    GC_Statistics        * const stats = &interp->gc_sys->stats;
+    Parrot_Pointer_Array * const list  = self->unswept_objects;
+    Parrot_Pointer_Array_Chunk  *chunk = NULL;
+    size_t                       used;
+
+    /* A destroy vtable allocating PMCs doesn't start another sweep */
+    if (!list || self->gc_sweep_block_level)
+        return;
+
+    /* M&S may run inside the allocators, where the sweeper can't start */
+    if (self->sweeper_wanted) {
+        gc_ms2_start_sweeper(interp, self);
+        return;
+    }
+
+    SWEEP_LOCK(self);
+    if (self->unswept_next < self->unswept_end)
+        chunk = list->chunks[self->unswept_next++];
+    SWEEP_UNLOCK(self);
+
+    if (!chunk) {
+        /* The sweeper thread finishes its chunk at most.  Its chunks still
+         * hold the objects with custom destroy. */
+        if (self->sweeper_running) {
+            gc_ms2_stop_sweeper(interp, self);
+            return;
+        }
+
+        Parrot_pa_destroy(interp, list);
+        self->unswept_objects = NULL;
+        gc_ms2_update_threshold(interp, self);
+        return;
+    }
+
+    ++self->gc_mark_block_level;
+    ++self->gc_sweep_block_level;
+    used = stats->memory_used;
+    gc_ms2_sweep_pmc_chunk(interp, self, chunk);
+    if (used > stats->memory_used)
+        self->unswept_live -= used - stats->memory_used;
+    --self->gc_sweep_block_level;
+    --self->gc_mark_block_level;
+}
+
+
+/*
+
+=item C<static void gc_ms2_finish_lazy_sweep(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweeps whatever is left of C<unswept_objects>.
+
+=cut
+
+*/
+
+static void
+gc_ms2_finish_lazy_sweep(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_finish_lazy_sweep)
+    const UINTVAL sweep_block_level = self->gc_sweep_block_level;
+
+    if (!self->unswept_objects)
+        return;
+
+    gc_ms2_print_stats(interp, "Finish lazy sweep");
+    self->sweeper_wanted = 0;
+    gc_ms2_stop_sweeper(interp, self);
+
+    self->gc_sweep_block_level = 0;
+    while (self->unswept_objects)
+        gc_ms2_sweep_lazily(interp, self);
+    self->gc_sweep_block_level = sweep_block_level;
+}
+
+
+/*
+
+=item C<static void gc_ms2_update_threshold(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sets the amount of memory to allocate before the next M&S.  It is based on
+C<unswept_live>, which doesn't count what was allocated since the last M&S.
+
+=cut
+
+*/
+
+static void
+gc_ms2_update_threshold(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_update_threshold)
+    GC_Statistics * const stats = &interp->gc_sys->stats;
+    size_t                threshold;
+
+    stats->mem_used_last_collect = self->unswept_live;
+
+    /* The dynamic threshold is a configurable percentage of the amount of
+       memory used after the last GC */
+    threshold = (size_t)(stats->mem_used_last_collect *
+                         (0.01 * self->dynamic_threshold));
+
+    if (threshold < self->min_threshold)
+        threshold = self->min_threshold;
+
+    self->gc_threshold = stats->mem_used_last_collect + threshold;
+}
+
+
+/*
+
+=item C<static void gc_ms2_start_sweeper(PARROT_INTERP, MarkSweep_GC *self)>
+
+Starts the sweeper thread on the chunks of C<unswept_objects>.  It works
+from the last chunk down while the interpreter sweeps lazily from the first
+one up.  Called on the first PMC allocation after M&S.
+
+=item C<static void gc_ms2_stop_sweeper(PARROT_INTERP, MarkSweep_GC *self)>
+
+Waits for the sweeper thread to finish the chunk at hand and hands the
+chunks it claimed back to the lazy sweep, which destroys the objects left
+there.
+
+=cut
+
+*/
+
+static void
+gc_ms2_start_sweeper(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_start_sweeper)
+
+    self->sweeper_wanted = 0;
+
+    /* Not worth a thread */
+    if (!self->sweep_thread || self->unswept_end < 2)
+        return;
+
+    self->sweeper_stop    = 0;
+    self->sweeper_done    = 0;
+    self->sweeper_freed   = 0;
+    self->sweeper_running = 1;
+    THREAD_CREATE_JOINABLE(self->sweeper, gc_ms2_sweeper_thread, interp);
+}
+
+static void
+gc_ms2_stop_sweeper(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_stop_sweeper)
+    void *ret;
+
+    if (!self->sweeper_running)
+        return;
+
+    LOCK(self->sweep_lock);
+    self->sweeper_stop = 1;
+    UNLOCK(self->sweep_lock);
+
+    JOIN(self->sweeper, ret);
+    UNUSED(ret);
+    self->sweeper_running = 0;
+    self->sweeper_done    = 0;
+
+    interp->gc_sys->stats.memory_used -= self->sweeper_freed;
+    self->unswept_live                -= self->sweeper_freed;
+    self->unswept_end = self->unswept_objects->total_chunks;
+}
+
+
+/*
+
+=item C<static void * gc_ms2_sweeper_thread(void *data)>
+
+Entry point of the sweeper thread.  C<data> is the interpreter.  Claims
+chunks of C<unswept_objects> from the end until it meets the lazy sweep.
+
+Dead PMCs without custom destroy are freed here.  Their cells are cleared,
+so the lazy sweep skips them later; everything else is left to it.  Headers
+and attributes go back to the allocators in one batch per chunk under
+C<sweep_lock>.  Nothing else of the interpreter is touched.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+gc_ms2_sweeper_thread(ARGIN(void *data))
+{
+    ASSERT_ARGS(gc_ms2_sweeper_thread)
+    Parrot_Interp  const interp = (Parrot_Interp)data;
+    MarkSweep_GC * const self   = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    PMC         ** const dead   =
+        (PMC **)mem_internal_allocate(CELL_PER_CHUNK * sizeof (PMC *));
+
+    while (1) {
+        Parrot_Pointer_Array_Chunk *chunk = NULL;
+        size_t i, num_dead = 0, freed = 0;
+
+        LOCK(self->sweep_lock);
+        if (!self->sweeper_stop && self->unswept_end > self->unswept_next)
+            chunk = self->unswept_objects->chunks[--self->unswept_end];
+
+        if (!chunk) {
+            self->sweeper_done = 1;
+            UNLOCK(self->sweep_lock);
+            break;
+        }
+        UNLOCK(self->sweep_lock);
+
+        for (i = 0; i < CELL_PER_CHUNK - chunk->num_free; ++i) {
+            void * const ptr = chunk->data[i];
+            PMC         *pmc;
+
+            if ((ptrcast_t)ptr & 1)
+                continue;
+
+            pmc = &((pmc_alloc_struct *)ptr)->pmc;
+
+            if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)
+            ||  PObj_custom_destroy_TEST(pmc))
+                continue;
+
+            chunk->data[i] = (void *)1;
+            dead[num_dead++] = pmc;
+        }
+
+        LOCK(self->sweep_lock);
+        for (i = 0; i < num_dead; ++i) {
+            PMC * const pmc = dead[i];
+
+            if (pmc->vtable->attr_size && PMC_data(pmc)) {
+                Parrot_gc_fixed_allocator_free(interp, self->fixed_size_allocator,
+                        PMC_data(pmc), pmc->vtable->attr_size);
+                freed += pmc->vtable->attr_size;
+            }
+            PMC_data(pmc) = NULL;
+
+            PObj_on_free_list_SET(pmc);
+            PObj_gc_CLEAR(pmc);
+
+            Parrot_gc_pool_free(interp, self->pmc_allocator, PMC2PAC(pmc));
+        }
+        UNLOCK(self->sweep_lock);
+
+        self->sweeper_freed += freed + num_dead * sizeof (PMC);
+    }
+
+    mem_internal_free(dead);
+    return NULL;
+}
+
+
 /*
 
 =item C<static void gc_ms2_sweep_string_pool(PARROT_INTERP, Pool_Allocator
@@ -1326,7 +1804,7 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
         else if (!PObj_constant_TEST(obj)) {
             GC_DEBUG_DETAIL_STR("GC remove str ", obj);
             Parrot_pa_remove(interp, list, STR2PAC(obj)->ptr);
-            if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
+            if (Buffer_bufstart(obj) && (!PObj_external_TEST(obj) || PObj_mapped_TEST(obj)))
                 Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Parrot_Buffer*)obj);
 
             stats.memory_used -= sizeof (STRING);
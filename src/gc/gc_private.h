@@ -216,6 +216,9 @@ typedef struct GC_Subsystem {
 
     void (*maybe_gc_mark)(PARROT_INTERP, UINTVAL flags);
     void (*do_gc_mark)(PARROT_INTERP, UINTVAL flags);
+
+    /* Continue an incremental collection. Only set while one is running */
+    void (*mark_slice)(PARROT_INTERP);
     void (*compact_string_pool)(PARROT_INTERP);
 
     void (*mark_special)(PARROT_INTERP, ARGMOD(PMC *pmc));
@@ -803,6 +806,7 @@ void Parrot_gc_str_finalize(PARROT_INTERP, ARGMOD(String_GC *gc))
 void Parrot_gc_str_free_buffer_storage(PARROT_INTERP,
     ARGIN(String_GC *gc),
     ARGMOD(Parrot_Buffer *b))
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*b);
@@ -847,7 +851,8 @@ void Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
        PARROT_ASSERT_ARG(gc))
 #define ASSERT_ARGS_Parrot_gc_str_free_buffer_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(gc) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(gc) \
     , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_Parrot_gc_str_initialize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -252,6 +252,18 @@ mark_interp(PARROT_INTERP)
     if (interp->op_mmd_cache)
         Parrot_mmd_cache_mark(interp, interp->op_mmd_cache);
 
+    /* Mark the shared type tuples of C multis. */
+    if (interp->mmd_type_tuples)
+        Parrot_hash_mark(interp, interp->mmd_type_tuples);
+
+    /* Mark the parsed C call signatures. */
+    if (interp->pcc_signatures)
+        Parrot_pcc_signature_cache_mark(interp, interp->pcc_signatures);
+
+    /* Mark the located runtime files. */
+    if (interp->lib_lookups)
+        Parrot_lib_lookup_cache_mark(interp, interp->lib_lookups);
+
     /* Walk the iodata */
     Parrot_io_mark(interp, interp->piodata);
 
@@ -29,7 +29,10 @@ typedef void (*compact_f) (Interp *, GC_Statistics *stats, Variable_Size_Pool *)
 #define RESOURCE_DEBUG_SIZE 10000
 
 #define RECLAMATION_FACTOR 0.20
-#define WE_WANT_EVER_GROWING_ALLOCATIONS 0
+
+/* Buffers that survived this many compactions move to old blocks, which are
+ * only compacted once half of them is garbage */
+#define OLD_BLOCK_AGE 2
 
 /* HEADERIZER HFILE: src/gc/gc_private.h */
 
@@ -64,6 +67,14 @@ static const char * buffer_location(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static int choose_blocks_to_compact(
+    ARGMOD(Variable_Size_Pool *pool),
+    ARGOUT(size_t *sizes))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*sizes);
+
 static void compact_pool(PARROT_INTERP,
     ARGMOD(GC_Statistics *stats),
     ARGMOD(Variable_Size_Pool *pool))
@@ -80,15 +91,11 @@ static void debug_print_buf(PARROT_INTERP, ARGIN(const Parrot_Buffer *b))
 static void free_memory_pool(ARGFREE(Variable_Size_Pool *pool));
 static void free_old_mem_blocks(
      ARGMOD(GC_Statistics *stats),
-    ARGMOD(Variable_Size_Pool *pool),
-    ARGMOD(Memory_Block *new_block),
-    UINTVAL total_size)
+    ARGMOD(Variable_Size_Pool *pool))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         FUNC_MODIFIES(*stats)
-        FUNC_MODIFIES(*pool)
-        FUNC_MODIFIES(*new_block);
+        FUNC_MODIFIES(*pool);
 
 static int is_block_almost_full(ARGIN(const Memory_Block *block))
         __attribute__nonnull__(1);
@@ -127,11 +134,6 @@ static Variable_Size_Pool * new_memory_pool(
     size_t min_block,
     NULLOK(compact_f compact));
 
-static UINTVAL pad_pool_size(PARROT_INTERP,
-    ARGIN(const Variable_Size_Pool *pool))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
-
 #define ASSERT_ARGS_aligned_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(buffer_unused) \
     , PARROT_ASSERT_ARG(mem))
@@ -143,6 +145,9 @@ static UINTVAL pad_pool_size(PARROT_INTERP,
 #define ASSERT_ARGS_buffer_location __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_choose_blocks_to_compact __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(sizes))
 #define ASSERT_ARGS_compact_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
@@ -153,8 +158,7 @@ static UINTVAL pad_pool_size(PARROT_INTERP,
 #define ASSERT_ARGS_free_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_free_old_mem_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(stats) \
-    , PARROT_ASSERT_ARG(pool) \
-    , PARROT_ASSERT_ARG(new_block))
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_is_block_almost_full __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(block))
 #define ASSERT_ARGS_mem_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -170,9 +174,6 @@ static UINTVAL pad_pool_size(PARROT_INTERP,
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(old_buf))
 #define ASSERT_ARGS_new_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_pad_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(pool))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -458,20 +459,32 @@ Parrot_gc_str_compact_pool(PARROT_INTERP, ARGIN(String_GC *gc))
 Parrot_Buffer *b)>
 
 Frees a buffer, returning it to the memory pool for Parrot to possibly
-reuse later.
+reuse later.  Dead interned STRINGs are removed from the intern table and the
+method cache.
 
 =cut
 
 */
 
 void
-Parrot_gc_str_free_buffer_storage(SHIM_INTERP,
+Parrot_gc_str_free_buffer_storage(PARROT_INTERP,
         ARGIN(String_GC *gc),
         ARGMOD(Parrot_Buffer *b))
 {
     ASSERT_ARGS(Parrot_gc_str_free_buffer_storage)
     Variable_Size_Pool * const mem_pool = gc->memory_pool;
 
+    /* Neither the intern table nor the method cache keep their STRINGs
+       alive */
+    if (PObj_is_string_TEST(b) && PObj_interned_TEST(b)) {
+        Parrot_str_unintern(interp, (STRING *)b);
+        Parrot_forget_method_name(interp, (STRING *)b);
+    }
+
+    /* Nor do STRINGs pointing into a file mapping need it any longer */
+    if (PObj_is_string_TEST(b) && PObj_mapped_TEST(b))
+        Parrot_str_detach_mapping(interp, (STRING *)b);
+
     /* If there is no allocated buffer - bail out */
     if (!Buffer_buflen(b))
         return;
@@ -534,9 +547,8 @@ new_memory_pool(size_t min_block, NULLOK(compact_f compact))
 =item C<static void alloc_new_block(PARROT_INTERP, GC_Statistics *stats, size_t
 size, Variable_Size_Pool *pool, const char *why)>
 
-Allocate a new memory block. We allocate either the requested size or the
-default size, whichever is larger. Add the new block to the given memory
-pool. The given C<char *why> text is used for debugging.
+Allocate a new memory block of C<size> bytes and make it the top block of the
+given memory pool. The given C<char *why> text is used for debugging.
 
 =cut
 
@@ -550,33 +562,30 @@ alloc_new_block(PARROT_INTERP, ARGMOD(GC_Statistics *stats),
     ASSERT_ARGS(alloc_new_block)
     Memory_Block *new_block;
 
-    const size_t alloc_size = (size > pool->minimum_block_size)
-            ? size : pool->minimum_block_size;
 #ifndef NDEBUG
-    MEMORY_DEBUG_DETAIL_3("new_block (%s) size %u -> %u\n",
-                          why, size, alloc_size);
+    MEMORY_DEBUG_DETAIL_2("new_block (%s) size %u\n", why, size);
 #else
     UNUSED(why)
 #endif
 
     /* Allocate a new block. Header info's on the front */
     new_block = (Memory_Block *)mem_internal_allocate_zeroed(
-        sizeof (Memory_Block) + alloc_size);
+        sizeof (Memory_Block) + size);
 
     if (!new_block) {
-        fprintf(stderr, "out of mem allocsize = %d\n", (int)alloc_size);
+        fprintf(stderr, "out of mem allocsize = %d\n", (int)size);
         PANIC(interp, "out of memory");
     }
 
-    new_block->free  = alloc_size;
-    new_block->size  = alloc_size;
+    new_block->free  = size;
+    new_block->size  = size;
 
     new_block->next  = NULL;
     new_block->start = (char *)new_block + sizeof (Memory_Block);
     new_block->top   = new_block->start;
 
     /* Note that we've allocated it */
-    stats->memory_allocated += alloc_size;
+    stats->memory_allocated += size;
 
     /* If this is for a public pool, add it to the list */
     new_block->prev = pool->top_block;
@@ -586,7 +595,7 @@ alloc_new_block(PARROT_INTERP, ARGMOD(GC_Statistics *stats),
         pool->top_block->next = new_block;
 
     pool->top_block        = new_block;
-    pool->total_allocated += alloc_size;
+    pool->total_allocated += size;
 }
 
 /*
@@ -643,7 +652,9 @@ mem_allocate(PARROT_INTERP,
              * Mark the block as big block (it has just one item)
              * And don't set big blocks as the top_block.
              */
-            alloc_new_block(interp, stats, size, pool, "compact failed");
+            alloc_new_block(interp, stats,
+                    size > pool->minimum_block_size ? size : pool->minimum_block_size,
+                    pool, "compact failed");
 
             if (pool->top_block->free < size) {
                 PANIC(interp, "out of mem\n");
@@ -755,6 +766,12 @@ Variable_Size_Pool *pool)>
 Compact the string buffer pool. Does not perform a GC scan, or mark items
 as being alive in any way.
 
+Live buffers are moved by age: buffers from new blocks go to a block of
+survivors, survivors of C<OLD_BLOCK_AGE> compactions go to an old block. Each
+of those is allocated with the exact size of what it receives. New strings
+stay in the top block, so long-lived strings don't keep getting copied along
+with short-lived ones.
+
 =cut
 
 */
@@ -765,44 +782,67 @@ compact_pool(PARROT_INTERP,
         ARGMOD(Variable_Size_Pool *pool))
 {
     ASSERT_ARGS(compact_pool)
-    UINTVAL       total_size, new_size;
-    Memory_Block *new_block;
+    size_t        sizes[OLD_BLOCK_AGE + 1];
+    Memory_Block *targets[OLD_BLOCK_AGE + 1];
+    Memory_Block *nursery = pool->top_block;
+    UINTVAL       age;
 
     /* Bail if we're blocked */
     if (Parrot_is_blocked_GC_sweep(interp) || Parrot_is_blocked_GC_move(interp))
         return;
 
-    Parrot_block_GC_move(interp);
-
     /* We're collecting */
     ++stats->gc_collect_runs;
 
-    /* Snag a block big enough for everything */
-    total_size = pad_pool_size(interp, pool);
-
-    if (total_size == 0) {
-        free_old_mem_blocks(stats, pool, pool->top_block, total_size);
-        Parrot_unblock_GC_move(interp);
+    /* Bail if moving the live buffers would reclaim too little */
+    if (!choose_blocks_to_compact(pool, sizes))
         return;
-    }
 
-    alloc_new_block(interp, stats, total_size, pool, "inside compact");
-    new_block = pool->top_block;
+    Parrot_block_GC_move(interp);
+
+    /* Snag a block for the buffers of each age */
+    for (age = 1; age <= OLD_BLOCK_AGE; ++age) {
+        targets[age] = NULL;
+
+        if (sizes[age]) {
+            alloc_new_block(interp, stats, sizes[age], pool, "inside compact");
+            targets[age]      = pool->top_block;
+            targets[age]->age = age;
+        }
+    }
 
     /* Run through all the Parrot_Buffer header pools and copy */
-    interp->gc_sys->iterate_live_strings(interp, move_buffer_callback, new_block);
+    interp->gc_sys->iterate_live_strings(interp, move_buffer_callback, targets);
 
-    new_size = new_block->top - new_block->start;
+    for (age = 1; age <= OLD_BLOCK_AGE; ++age) {
+        Memory_Block * const block = targets[age];
 
-    PARROT_ASSERT(new_block->size >= new_size);
+        if (block) {
+            const size_t new_size = block->top - block->start;
 
-    /* How much is free. That's the total size minus the amount we used */
-    new_block->free          = new_block->size - new_size;
+            PARROT_ASSERT(block->size >= new_size);
 
-    stats->memory_collected += new_size;
-    stats->memory_used      += new_size;
+            /* How much is free. That's the total size minus the amount we used */
+            block->free              = block->size - new_size;
 
-    free_old_mem_blocks(stats, pool, new_block, total_size);
+            stats->memory_collected += new_size;
+            stats->memory_used      += new_size;
+        }
+    }
+
+    /* Put the block new strings go to back on top */
+    if (nursery != pool->top_block) {
+        nursery->next->prev = nursery->prev;
+        if (nursery->prev)
+            nursery->prev->next = nursery->next;
+
+        nursery->prev          = pool->top_block;
+        nursery->next          = NULL;
+        pool->top_block->next  = nursery;
+        pool->top_block        = nursery;
+    }
+
+    free_old_mem_blocks(stats, pool);
     Parrot_unblock_GC_move(interp);
 }
 
@@ -811,7 +851,8 @@ compact_pool(PARROT_INTERP,
 =item C<static void move_buffer_callback(PARROT_INTERP, Parrot_Buffer *b, void
 *data)>
 
-Callback for live STRING/Buffer for compacting.
+Callback for live STRING/Buffer for compacting. C<data> holds the blocks to
+move buffers to, indexed by the age they reach.
 
 =cut
 
@@ -820,12 +861,16 @@ static void
 move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
 {
     ASSERT_ARGS(move_buffer_callback)
-    Memory_Block * const new_block = (Memory_Block *)data;
+    Memory_Block ** const targets = (Memory_Block **)data;
 
     if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b)) {
         Memory_Block * const old_block = Buffer_pool(b);
 
-        if (!is_block_almost_full(old_block)) {
+        if (old_block->evacuate) {
+            Memory_Block * const new_block = targets[old_block->age < OLD_BLOCK_AGE
+                                                     ? old_block->age + 1
+                                                     : OLD_BLOCK_AGE];
+
             MEMORY_DEBUG_DETAIL_3("Move buffer %2u %p => %p\n",
                                   (unsigned)Buffer_buflen(b), old_block, new_block);
             move_one_buffer(interp, new_block, b);
@@ -836,72 +881,57 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
 
 /*
 
-=item C<static UINTVAL pad_pool_size(PARROT_INTERP, const Variable_Size_Pool
-*pool)>
-
-Calculate the size of the new pool. The currently used size equals the total
-size minus the reclaimable size. Add a minimum block to the current amount, so
-we can avoid having to allocate it in the future.
+=item C<static int choose_blocks_to_compact(Variable_Size_Pool *pool, size_t
+*sizes)>
 
-Returns 0 if all blocks below the top block are almost full. In this case
-compacting is not needed.
+Sets the C<evacuate> flag on the blocks of C<pool> the next compaction moves
+the buffers out of, and fills C<sizes> with how much live memory moves to
+the block of each age. The top block, where new strings are allocated, is
+left alone. Other blocks younger than C<OLD_BLOCK_AGE> are moved unless they
+are almost full, old blocks once half of them is garbage.
 
-TODO - Big blocks
-
-Currently all available blocks are compacted into one new
-block with total_size. This is suboptimal, if the block has
-just one live item from a big allocation.
-
-But currently it's unknown if the buffer memory is alive
-as the live bits are in Buffer headers. We have to run the
-compaction loop to check liveness. OTOH if this compaction
-is running through all the buffer headers, there is no
-relation to the block.
-
-Moving the live bit into the buffer thus also solves this
-problem easily.
+Returns false if the chosen blocks hold less garbage than the pool's
+C<reclaim_factor> of its memory. Compacting would then copy a lot to reclaim
+little, so it is better left until more strings have died. The flags are only
+meaningful when true is returned.
 
 =cut
 
 */
 
-static UINTVAL
-pad_pool_size(PARROT_INTERP, ARGIN(const Variable_Size_Pool *pool))
+static int
+choose_blocks_to_compact(ARGMOD(Variable_Size_Pool *pool), ARGOUT(size_t *sizes))
 {
-    ASSERT_ARGS(pad_pool_size)
-    Memory_Block *cur_block = pool->top_block->prev;
-
-    UINTVAL total_size   = 0;
-#ifndef NDEBUG
-    size_t  total_blocks = 1;
-#endif
-
-    while (cur_block) {
-        if (!is_block_almost_full(cur_block))
-            total_size += cur_block->size - cur_block->freed - cur_block->free;
-        cur_block   = cur_block->prev;
-#ifndef NDEBUG
-        ++total_blocks;
-#endif
+    ASSERT_ARGS(choose_blocks_to_compact)
+    Memory_Block *cur_block;
+    size_t        total_size = 0;
+    size_t        garbage    = 0;
+    UINTVAL       age;
+
+    for (age = 0; age <= OLD_BLOCK_AGE; ++age)
+        sizes[age] = 0;
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev) {
+        const size_t unused = cur_block->free + cur_block->freed;
+
+        total_size += cur_block->size;
+
+        if (cur_block == pool->top_block)
+            /* Give the newest strings time to die */
+            cur_block->evacuate = 0;
+        else if (cur_block->age < OLD_BLOCK_AGE)
+            cur_block->evacuate = !is_block_almost_full(cur_block);
+        else
+            cur_block->evacuate = 2 * unused > cur_block->size;
+
+        if (cur_block->evacuate) {
+            sizes[cur_block->age < OLD_BLOCK_AGE ? cur_block->age + 1 : OLD_BLOCK_AGE]
+                += cur_block->size - unused;
+            garbage += unused;
+        }
     }
 
-    if (total_size == 0)
-        return 0;
-
-    cur_block = pool->top_block;
-    if (!is_block_almost_full(cur_block))
-        total_size += cur_block->size - cur_block->freed - cur_block->free;
-
-    /* this makes for ever increasing allocations but fewer collect runs */
-#if WE_WANT_EVER_GROWING_ALLOCATIONS
-    total_size += pool->minimum_block_size;
-#endif
-
-#ifndef NDEBUG
-    MEMORY_DEBUG_DETAIL_2("Total blocks: %lu, size %lu\n", total_blocks, total_size);
-#endif
-
-    return total_size;
+    return garbage && garbage >= total_size * pool->reclaim_factor;
 }
 
 /*
@@ -998,15 +1028,11 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 /*
 
 =item C<static void free_old_mem_blocks( GC_Statistics *stats,
-Variable_Size_Pool *pool, Memory_Block *new_block, UINTVAL total_size)>
+Variable_Size_Pool *pool)>
 
-The compact_pool operation collects disjointed blocks of memory allocated on a
-given pool's free list into one large block of memory, setting it as the new
-top block for the pool. Once that is done, and all items have been moved into
-the new block of memory, this function iterates through the old blocks and
-frees each one. It also performs the necessary housekeeping to record the
-freed memory blocks. At the end of this function, the pool will have only one
-block of memory on its free list.
+Once compact_pool has moved all live buffers out of the blocks it chose, this
+function iterates through those blocks and frees each one. It also performs
+the necessary housekeeping to record the freed memory blocks.
 
 =cut
 
@@ -1015,23 +1041,23 @@ block of memory on its free list.
 static void
 free_old_mem_blocks(
         ARGMOD(GC_Statistics *stats),
-        ARGMOD(Variable_Size_Pool *pool),
-        ARGMOD(Memory_Block *new_block),
-        UINTVAL total_size)
+        ARGMOD(Variable_Size_Pool *pool))
 {
     ASSERT_ARGS(free_old_mem_blocks)
-    Memory_Block *prev_block = new_block;
-    Memory_Block *cur_block  = new_block->prev;
+    Memory_Block *prev_block = pool->top_block;
+    Memory_Block *cur_block  = prev_block->prev;
+    size_t        total_size = prev_block->size;
 
-    PARROT_ASSERT(new_block == pool->top_block);
+    PARROT_ASSERT(!prev_block->evacuate);
 
     while (cur_block) {
         Memory_Block * const next_block = cur_block->prev;
 
-        if (is_block_almost_full(cur_block)) {
+        if (!cur_block->evacuate) {
             /* Skip block */
-            prev_block = cur_block;
-            cur_block  = next_block;
+            total_size += cur_block->size;
+            prev_block  = cur_block;
+            cur_block   = next_block;
         }
         else {
             /* Note that we don't have it any more */
@@ -1045,17 +1071,11 @@ free_old_mem_blocks(
 
             /* Unlink it from list */
             prev_block->prev = next_block;
+            if (next_block)
+                next_block->next = prev_block;
         }
     }
 
-    /* Terminate list */
-    prev_block->prev = NULL;
-
-
-    /* ANR: I suspect this should be set to new_block->size, instead of passing
-     * in the raw value of total_size, because alloc_new_block pads the size of
-     * the new block under certain conditions. Leaving it unmodified for now,
-     * so this refactor has no functionality changes, only code cleanups.*/
     pool->total_allocated        = total_size;
     pool->guaranteed_reclaimable = 0;
     pool->possibly_reclaimable   = 0;
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2010, Parrot Foundation.
+Copyright (C) 2001-2015, Parrot Foundation.
 
 =head1 NAME
 
@@ -27,6 +27,12 @@ typedef struct Memory_Block {
 
     /* Amount of freed memory. Used in compact_pool */
     size_t freed;
+
+    /* Number of compactions the buffers in the block survived */
+    UINTVAL age;
+
+    /* Set by compact_pool on the blocks whose buffers it moves out */
+    INTVAL evacuate;
 } Memory_Block;
 
 typedef struct Variable_Size_Pool {
@@ -7,13 +7,20 @@ src/hash.c - Hash table
 
 =head1 DESCRIPTION
 
-A hashtable contains an array of bucket indexes. Buckets are nodes in a
-linked list, each containing a C<void *> key and value. During hash
-creation, the types of key and value as well as appropriate compare and
-hashing functions can be set.
+A hashtable contains a store of buckets, each containing a C<void *> key and
+value, and an open addressed index of bucket numbers. During hash creation,
+the types of key and value as well as appropriate compare and hashing
+functions can be set.
+
+Each slot of the index has a control byte which is either empty, deleted, or
+holds 7 bits of the hash value of the key.  A lookup tests a group of eight
+control bytes at once and only compares the keys of matching slots.  Buckets
+never move within the store, so iterating over the store visits the entries
+in insertion order.
 
 This hash implementation uses just one piece of malloced memory. The
-C<< hash->buckets >> bucket store points to this region.
+C<< hash->buckets >> bucket store points to this region, followed by the
+index and the control bytes.
 
 =head2 Functions
 
@@ -32,6 +39,58 @@ C<< hash->buckets >> bucket store points to this region.
  * else we use system allocator */
 #define SPLIT_POINT  16
 
+/* The low bits of the hash value select the first group to probe, so
+ * consecutive integer keys stay in consecutive slots.  Those keys share their
+ * high bits, so the control byte takes 7 bits of the Fibonacci hash of the
+ * hash value instead. */
+#define HASH_START(h, mask) \
+    ((UINTVAL)(h) & (mask) & ~(UINTVAL)(HASH_GROUP_SIZE - 1))
+#define HASH_FRAGMENT(h) ((unsigned char)(((UHUGEINTVAL)(h) * \
+    ((UHUGEINTVAL)0x9e3779b9 << 32 | 0x7f4a7c15)) >> (HUGEINTVAL_SIZE * 8 - 7)))
+
+/* A group of control bytes is tested as one word */
+#if HUGEINTVAL_SIZE < HASH_GROUP_SIZE
+#  error "HUGEINTVAL is too small to hold a group of hash control bytes"
+#endif
+#define GROUP_LSB (~(UHUGEINTVAL)0 / 0xff)
+#define GROUP_MSB (GROUP_LSB << 7)
+
+/* Nonzero if some control byte may equal c; false positives are possible */
+#define GROUP_MATCH(g, c) \
+    ((((g) ^ GROUP_LSB * (c)) - GROUP_LSB) & ~((g) ^ GROUP_LSB * (c)) & GROUP_MSB)
+
+/* Nonzero if some slot is empty */
+#define GROUP_HAS_EMPTY(g) ((g) & ~((g) << 1) & GROUP_MSB)
+
+/* Nonzero if some slot is empty or deleted */
+#define GROUP_HAS_FREE(g) ((g) & GROUP_MSB)
+
+/* Runs _code for every slot _slot whose control byte matches _hashval, in
+ * probe order, until a group with an empty slot is done.  _code must return to
+ * stop early.  Groups are probed triangularly, which visits them all. */
+#define hash_probe(_hash, _hashval, _code)                                  \
+do {                                                                        \
+    const UINTVAL       _mask     = N_SLOTS((_hash)->mask + 1) - 1;         \
+    const unsigned char _fragment = HASH_FRAGMENT((_hashval));              \
+    UINTVAL             _pos      = HASH_START((_hashval), _mask);          \
+    UINTVAL             _step     = 0;                                      \
+    for (;;) {                                                              \
+        const UHUGEINTVAL _group = hash_load_group((_hash)->control + _pos); \
+        if (GROUP_MATCH(_group, _fragment)) {                               \
+            UINTVAL _slot;                                                  \
+            for (_slot = _pos; _slot < _pos + HASH_GROUP_SIZE; ++_slot) {   \
+                if ((_hash)->control[_slot] == _fragment) {                 \
+                    _code                                                   \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+        if (GROUP_HAS_EMPTY(_group))                                        \
+            break;                                                          \
+        _step += HASH_GROUP_SIZE;                                           \
+        _pos   = (_pos + _step) & _mask;                                    \
+    }                                                                       \
+} while (0)
+
 /* HEADERIZER HFILE: include/parrot/hash.h */
 
 /* HEADERIZER BEGIN: static */
@@ -44,11 +103,6 @@ static void allocate_buckets(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*hash);
 
-static void expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        FUNC_MODIFIES(*hash);
-
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 PARROT_INLINE
@@ -84,6 +138,22 @@ static int hash_compare_string_enc(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void hash_index_insert(
+    ARGMOD(Hash *hash),
+    BucketIndex b,
+    size_t hashval)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*hash);
+
+static void hash_index_remove(ARGMOD(Hash *hash), UINTVAL slot)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*hash);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_INLINE
+static UHUGEINTVAL hash_load_group(ARGIN(const unsigned char *control))
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 PARROT_INLINE
@@ -101,6 +171,14 @@ static size_t key_hash_cstring(PARROT_INTERP,
     size_t seed)
         __attribute__nonnull__(2);
 
+PARROT_CAN_RETURN_NULL
+static HashBucket * parrot_hash_get_bucket_generic(PARROT_INTERP,
+    ARGIN(const Hash *hash),
+    ARGIN_NULLOK(void *key),
+    size_t hashval)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CAN_RETURN_NULL
 static HashBucket * parrot_hash_get_bucket_string(PARROT_INTERP,
     ARGIN(const Hash *hash),
@@ -133,12 +211,14 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void resize_hash(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL new_size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*hash);
+
 #define ASSERT_ARGS_allocate_buckets __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
-#define ASSERT_ARGS_expand_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_hash_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -153,11 +233,21 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 #define ASSERT_ARGS_hash_compare_string_enc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(search_key) \
     , PARROT_ASSERT_ARG(bucket_key))
+#define ASSERT_ARGS_hash_index_insert __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_hash_index_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_hash_load_group __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(control))
 #define ASSERT_ARGS_key_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_key_hash_cstring __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(value))
+#define ASSERT_ARGS_parrot_hash_get_bucket_generic \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_parrot_hash_get_bucket_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash) \
@@ -175,15 +265,82 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 #define ASSERT_ARGS_parrot_mark_hash_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_resize_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
 /*
 
+String hashing.  Keys are hashed as the sequence of their codepoints, so equal
+strings in different encodings hash to the same value.  Fixed 8 bit strings
+go through C<Parrot_hash_buffer> directly; other encodings feed their
+codepoints into a C<Parrot_hash_state>.  A string with a codepoint above 255
+cannot equal a fixed 8 bit string, so it is hashed as "wide": four bytes per
+codepoint, with a SipHash key of its own.  Otherwise a wide codepoint would
+hash like the four narrow ones spelling its bytes.
+
+With the default SipHash-1-3 the key is consumed a 64 bit word at a time and
+the per-interpreter hash seed is the SipHash key.  C<--hash-function=bernstein>
+selects the old byte at a time "times 33" hash instead.
+
+*/
+
+#if PARROT_HASH_FUNCTION == PARROT_HASH_SIPHASH13 && HUGEINTVAL_SIZE == 8
+#  define PARROT_HASH_USE_SIPHASH 1
+#else
+#  define PARROT_HASH_USE_SIPHASH 0
+#endif
+
+#if PARROT_HASH_USE_SIPHASH
+
+#  define SIP_CONST(hi, lo) (((UHUGEINTVAL)(hi) << 32) | (UHUGEINTVAL)(lo))
+#  define SIP_ROTL(x, b)    (((x) << (b)) | ((x) >> (64 - (b))))
+
+#  define SIP_ROUND(v0, v1, v2, v3) do {                                    \
+    (v0) += (v1); (v1) = SIP_ROTL((v1), 13); (v1) ^= (v0);                  \
+    (v0)  = SIP_ROTL((v0), 32);                                             \
+    (v2) += (v3); (v3) = SIP_ROTL((v3), 16); (v3) ^= (v2);                  \
+    (v0) += (v3); (v3) = SIP_ROTL((v3), 21); (v3) ^= (v0);                  \
+    (v2) += (v1); (v1) = SIP_ROTL((v1), 17); (v1) ^= (v2);                  \
+    (v2)  = SIP_ROTL((v2), 32);                                             \
+} while (0)
+
+/* The seed is only one word wide; derive the second key word from it. */
+#  define SIP_INIT(v0, v1, v2, v3, seed) do {                               \
+    const UHUGEINTVAL _k0 = (UHUGEINTVAL)(seed);                            \
+    const UHUGEINTVAL _k1 = SIP_ROTL(_k0, 32)                               \
+                          ^ SIP_CONST(0x9e3779b9, 0x7f4a7c15);              \
+    (v0) = _k0 ^ SIP_CONST(0x736f6d65, 0x70736575);                         \
+    (v1) = _k1 ^ SIP_CONST(0x646f7261, 0x6e646f6d);                         \
+    (v2) = _k0 ^ SIP_CONST(0x6c796765, 0x6e657261);                         \
+    (v3) = _k1 ^ SIP_CONST(0x74656462, 0x79746573);                         \
+} while (0)
+
+#  define SIP_COMPRESS(v0, v1, v2, v3, m) do {                              \
+    (v3) ^= (m);                                                            \
+    SIP_ROUND((v0), (v1), (v2), (v3));                                      \
+    (v0) ^= (m);                                                            \
+} while (0)
+
+/* Mixes in the final, length tagged word */
+#  define SIP_FINALIZE(v0, v1, v2, v3, m) do {                              \
+    SIP_COMPRESS((v0), (v1), (v2), (v3), (m));                              \
+    (v2) ^= 0xff;                                                           \
+    SIP_ROUND((v0), (v1), (v2), (v3));                                      \
+    SIP_ROUND((v0), (v1), (v2), (v3));                                      \
+    SIP_ROUND((v0), (v1), (v2), (v3));                                      \
+} while (0)
+
+#endif /* PARROT_HASH_USE_SIPHASH */
+
+/*
+
 =item C<size_t Parrot_hash_buffer(const unsigned char *buf, size_t len, size_t
 hashval)>
 
-Compute the hash of a buffer.
+Compute the hash of a buffer, using C<hashval> as seed.
 
 =cut
 
@@ -196,11 +353,143 @@ size_t
 Parrot_hash_buffer(ARGIN_NULLOK(const unsigned char *buf), size_t len, size_t hashval)
 {
     ASSERT_ARGS(Parrot_hash_buffer)
+#if PARROT_HASH_USE_SIPHASH
+    UHUGEINTVAL v0, v1, v2, v3;
+    UHUGEINTVAL tail = (UHUGEINTVAL)len << 56;
+    size_t      words;
+
+    SIP_INIT(v0, v1, v2, v3, hashval);
+
+    for (words = len >> 3; words; --words, buf += 8) {
+        UHUGEINTVAL m;
+#  if PARROT_BIGENDIAN
+        m = (UHUGEINTVAL)buf[0]         | (UHUGEINTVAL)buf[1] << 8
+          | (UHUGEINTVAL)buf[2] << 16   | (UHUGEINTVAL)buf[3] << 24
+          | (UHUGEINTVAL)buf[4] << 32   | (UHUGEINTVAL)buf[5] << 40
+          | (UHUGEINTVAL)buf[6] << 48   | (UHUGEINTVAL)buf[7] << 56;
+#  else
+        memcpy(&m, buf, sizeof m);
+#  endif
+        SIP_COMPRESS(v0, v1, v2, v3, m);
+    }
+
+    switch (len & 7) {
+      case 7: tail |= (UHUGEINTVAL)buf[6] << 48; /* fall through */
+      case 6: tail |= (UHUGEINTVAL)buf[5] << 40; /* fall through */
+      case 5: tail |= (UHUGEINTVAL)buf[4] << 32; /* fall through */
+      case 4: tail |= (UHUGEINTVAL)buf[3] << 24; /* fall through */
+      case 3: tail |= (UHUGEINTVAL)buf[2] << 16; /* fall through */
+      case 2: tail |= (UHUGEINTVAL)buf[1] << 8;  /* fall through */
+      case 1: tail |= (UHUGEINTVAL)buf[0];       /* fall through */
+      default: break;
+    }
+
+    SIP_FINALIZE(v0, v1, v2, v3, tail);
+
+    return (size_t)(v0 ^ v1 ^ v2 ^ v3);
+#else
     while (len--) {
         hashval += hashval << 5;
         hashval += *buf++;
     }
     return hashval;
+#endif
+}
+
+/*
+
+=item C<void Parrot_hash_state_init(Parrot_hash_state *state, size_t seed,
+INTVAL wide)>
+
+Starts hashing a key one codepoint at a time.  Without C<wide>, all
+codepoints must be below 256, and feeding those of a fixed 8 bit string
+through C<Parrot_hash_state_add_codepoint> yields the same value as
+C<Parrot_hash_buffer> over its bytes.  Keys with any larger codepoint must
+be hashed C<wide>.
+
+=cut
+
+*/
+
+void
+Parrot_hash_state_init(ARGOUT(Parrot_hash_state *state), size_t seed, INTVAL wide)
+{
+    ASSERT_ARGS(Parrot_hash_state_init)
+#if PARROT_HASH_USE_SIPHASH
+    SIP_INIT(state->v0, state->v1, state->v2, state->v3, seed);
+
+    /* keep wide keys apart from narrow ones with the same bytes */
+    if (wide)
+        state->v1 ^= 0xee;
+#else
+    state->v0 = seed;
+    state->v1 = state->v2 = state->v3 = 0;
+#endif
+    state->tail = 0;
+    state->len  = 0;
+    state->wide = wide;
+}
+
+/*
+
+=item C<void Parrot_hash_state_add_codepoint(Parrot_hash_state *state, UINTVAL
+c)>
+
+Adds the next codepoint of the key, as one byte, or as four for wide keys.
+
+=cut
+
+*/
+
+PARROT_HOT
+void
+Parrot_hash_state_add_codepoint(ARGMOD(Parrot_hash_state *state), UINTVAL c)
+{
+    ASSERT_ARGS(Parrot_hash_state_add_codepoint)
+#if PARROT_HASH_USE_SIPHASH
+    unsigned int bytes = state->wide ? 4 : 1;
+
+    PARROT_ASSERT(state->wide || c < 256);
+
+    while (bytes--) {
+        state->tail |= (UHUGEINTVAL)(c & 0xff) << (8 * (state->len & 7));
+        c >>= 8;
+
+        if ((++state->len & 7) == 0) {
+            SIP_COMPRESS(state->v0, state->v1, state->v2, state->v3, state->tail);
+            state->tail = 0;
+        }
+    }
+#else
+    state->v0 += state->v0 << 5;
+    state->v0 += c;
+#endif
+}
+
+/*
+
+=item C<size_t Parrot_hash_state_finish(Parrot_hash_state *state)>
+
+Returns the hash value of all codepoints added to C<state>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_hash_state_finish(ARGMOD(Parrot_hash_state *state))
+{
+    ASSERT_ARGS(Parrot_hash_state_finish)
+#if PARROT_HASH_USE_SIPHASH
+    const UHUGEINTVAL last = state->tail | (UHUGEINTVAL)state->len << 56;
+
+    SIP_FINALIZE(state->v0, state->v1, state->v2, state->v3, last);
+
+    return (size_t)(state->v0 ^ state->v1 ^ state->v2 ^ state->v3);
+#else
+    return (size_t)state->v0;
+#endif
 }
 
 /*
@@ -330,13 +619,8 @@ static size_t
 key_hash_cstring(SHIM_INTERP, ARGIN(const void *value), size_t seed)
 {
     ASSERT_ARGS(key_hash_cstring)
-    const unsigned char *p = (const unsigned char *) value;
-    size_t h = seed;
-    while (*p) {
-        h += h << 5;
-        h += *p++;
-    }
-    return h;
+    const char * const p = (const char *) value;
+    return Parrot_hash_buffer((const unsigned char *) p, strlen(p), seed);
 }
 
 
@@ -794,12 +1078,17 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
     memset(new_buckets, 0, HASH_ALLOC_SIZE(new_size));
 
     hash->mask      = new_size - 1;
+    hash->deleted   = 0;
     hash->buckets   = new_buckets;
-    hash->index     = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    hash->index     = (BucketIndex *)(new_buckets + N_BUCKETS(new_size));
+    hash->control   = (unsigned char *)(hash->index + N_SLOTS(new_size));
+
+    memset(hash->control, HASH_SLOT_EMPTY, N_SLOTS(new_size));
 
     /* add new buckets to free_list
      * lowest bucket is top on free list and will be used first */
 
+    hash->free_list = NULL;
     bucket = hash->buckets + N_BUCKETS(new_size) - 1;
     for (i = 0; i < N_BUCKETS(new_size); ++i, --bucket) {
         bucket->next    = hash->free_list;
@@ -809,151 +1098,88 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
 
 /*
 
-=item C<static void expand_hash(PARROT_INTERP, Hash *hash)>
-
-Expands a hash when necessary.
+=item C<static void resize_hash(PARROT_INTERP, Hash *hash, UINTVAL new_size)>
 
-For a hashtable of size N, we use C<MAXFULL_PERCENT> % of N as the
-number of buckets. This way, as soon as we run out of buckets on the
-free list, we know that it's time to resize the hashtable.
+Moves the buckets of a hash into new storage for C<new_size> buckets and
+rebuilds the index there.  Resizing to the current size drops the deleted
+slots from the index.
 
-Algorithm for expansion: We exactly double the size of the hashtable.
-Keys are assigned to buckets with the formula
+For a hashtable of size N, the index has 2N slots and there are N buckets.
+As soon as we run out of buckets on the free list, we double the size of
+the hashtable.
 
-    bucket_index = hash(key) % Parrot_hash_size
-
-When doubling the size of the hashtable, we know that every key is either
-already in the correct bucket, or belongs in the current bucket plus
-C<Parrot_hash_size> (the old C<Parrot_hash_size>). In fact, because the
-hashtable is always a power of two in size, it depends only on the next bit
-in the hash value, after the ones previously used.
-
-We scan through all the buckets in order, moving the buckets that need to be
-moved. No bucket will be scanned twice, and the cache should be reasonably
-happy because the hashtable accesses will be two parallel sequential scans.
-(Of course, this also mucks with the C<< ->next >> pointers, and they'll be
-all over memory.)
+Buckets keep their position in the bucket store, so iterating over the
+store still visits them in insertion order.
 
 =cut
 
 */
 
 static void
-expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
+resize_hash(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL new_size)
 {
-    ASSERT_ARGS(expand_hash)
-    HashBucket  **new_index,  **index;
-    HashBucket   *new_buckets, *bucket;
-
-    void *        new_mem;
-    void * const  old_mem    = hash->buckets;
-    const UINTVAL old_size   = hash->mask + 1;
-    const UINTVAL new_size   = old_size  << 1; /* Double. Right-shift is 2x */
-    const UINTVAL new_mask   = new_size   - 1;
-    size_t        i;
-    ptrdiff_t     offset;
-
-    /*
-       allocate some less buckets
-       e.g. 3 buckets, 4 pointers:
-
-         +---+---+---+-+-+-+-+
-         | --> buckets |     |
-         +---+---+---+-+-+-+-+
-         ^             ^
-         | old_mem     | hash->index
-    */
+    ASSERT_ARGS(resize_hash)
+    HashBucket   * const old_buckets = hash->buckets;
+    const UINTVAL        old_size    = hash->mask + 1;
+    HashBucket          *new_buckets;
+    HashBucket         **link;
+    size_t               i;
 
-    /* resize mem */
     if (new_size > SPLIT_POINT)
-        new_mem  = Parrot_gc_allocate_memory_chunk(
+        new_buckets = (HashBucket *) Parrot_gc_allocate_memory_chunk(
                         interp, HASH_ALLOC_SIZE(new_size));
     else
-        new_mem  = Parrot_gc_allocate_fixed_size_storage(
+        new_buckets = (HashBucket *) Parrot_gc_allocate_fixed_size_storage(
                         interp, HASH_ALLOC_SIZE(new_size));
 
-    offset = (char *)new_mem - (char *)old_mem;
-
-    new_buckets = (HashBucket *)  new_mem;
-    new_index   = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
-
-    /* copy buckets and index */
-    memcpy(new_buckets, hash->buckets,
-            N_BUCKETS(old_size) * sizeof (HashBucket));
-    memcpy(new_index, hash->index, old_size * sizeof (HashBucket *));
-
-    /* free */
-    if (old_size > SPLIT_POINT)
-        Parrot_gc_free_memory_chunk(interp, old_mem);
-    else
-        Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(old_size), old_mem);
-
-
-    /* clear second half of the buckets, freed by old the index */
+    /* copy buckets, clear the new ones */
+    memcpy(new_buckets, old_buckets, N_BUCKETS(old_size) * sizeof (HashBucket));
     memset(new_buckets + N_BUCKETS(old_size), 0,
-            sizeof (HashBucket) * old_size);
+            (N_BUCKETS(new_size) - N_BUCKETS(old_size)) * sizeof (HashBucket));
 
-    /* clear second half of the index */
-    memset(new_index + (old_size), 0, sizeof (HashBucket *) * old_size);
+    hash->mask      = new_size - 1;
+    hash->deleted   = 0;
+    hash->buckets   = new_buckets;
+    hash->index     = (BucketIndex *)(new_buckets + N_BUCKETS(new_size));
+    hash->control   = (unsigned char *)(hash->index + N_SLOTS(new_size));
 
+    memset(hash->control, HASH_SLOT_EMPTY, N_SLOTS(new_size));
 
+    /* relocate the free list, then append the new buckets to it
+     * lowest bucket will be used first */
+    for (link = &hash->free_list; *link; link = &(*link)->next)
+        *link = new_buckets + (*link - old_buckets);
 
-    /*
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         |  buckets  | old_index |  new_index    |
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         ^                       ^
-         | new_mem               | hash->index
-    */
-
-    /* update hash data */
-    hash->index     = new_index;
-    hash->buckets   = new_buckets;
-    hash->mask      = new_mask;
+    for (i = N_BUCKETS(old_size); i < N_BUCKETS(new_size); ++i) {
+        *link = new_buckets + i;
+        link  = &(*link)->next;
+    }
 
-    /* reloc pointers and recalc bucket indices */
-    for (i = 0; i < old_size; ++i) {
-        index = new_index + i;
+    /* rehash the used buckets into the new index */
+    for (i = 0; i < N_BUCKETS(old_size); ++i) {
+        HashBucket * const bucket = new_buckets + i;
 
-        while (*index != NULL) {
-            size_t new_loc;
+        if (bucket->next == old_buckets + i) {
             size_t hashval;
 
-            bucket = (HashBucket *)((char *)*index + offset);
-
-            /* rehash the bucket */
             if (hash->key_type == Hash_key_type_STRING
             ||  hash->key_type == Hash_key_type_STRING_enc) {
-                STRING *s = (STRING *)bucket->key;
-                hashval   = s->hashval;
+                const STRING * const s = (const STRING *)bucket->key;
+                hashval = s->hashval;
             }
             else {
                 hashval = key_hash(interp, hash, bucket->key);
             }
 
-            new_loc = hashval & new_mask;
-
-            if (i != new_loc) {
-                *index              = bucket->next;
-                bucket->next        = new_index[new_loc];
-                new_index[new_loc]  = bucket;
-            }
-            else {
-                *index = bucket;
-                index  = &bucket->next;
-            }
+            bucket->next = bucket;
+            hash_index_insert(hash, (BucketIndex)i, hashval);
         }
     }
 
-    /* add new buckets to free_list
-     * lowest bucket is top on free list and will be used first */
-    bucket = new_buckets + N_BUCKETS(old_size);
-    for (i = N_BUCKETS(old_size)-1 ; i > 0; --i, ++bucket) {
-        bucket->next = bucket + 1;
-    }
-
-    bucket->next = NULL;
-    hash->free_list = new_buckets + N_BUCKETS(old_size);
+    if (old_size > SPLIT_POINT)
+        Parrot_gc_free_memory_chunk(interp, old_buckets);
+    else
+        Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(old_size), old_buckets);
 }
 
 
@@ -1074,7 +1300,9 @@ Parrot_hash_create(PARROT_INTERP, PARROT_DATA_TYPE val_type, Hash_key_type hkey_
     hash->seed       = interp->hash_seed;
     hash->mask       = 0;
     hash->entries    = 0;
+    hash->deleted    = 0;
     hash->index      = NULL;
+    hash->control    = NULL;
     hash->buckets    = NULL;
     hash->free_list  = NULL;
 
@@ -1240,19 +1468,10 @@ Parrot_hash_get_bucket(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(cons
     }
     else {
         /* The const casts are needed for PMC keys */
-        const size_t hashval = key_hash(interp, hash,
-                                    PARROT_const_cast(void *, key));
-        HashBucket  *bucket  = hash->index[hashval & hash->mask];
-
-        while (bucket) {
-            if (hash_compare(interp, hash,
-                    PARROT_const_cast(void *, key),
-                    bucket->key) == 0)
-                break;
-            bucket = bucket->next;
-        }
+        void * const key_p   = PARROT_const_cast(void *, key);
+        const size_t hashval = key_hash(interp, hash, key_p);
 
-        return bucket;
+        return parrot_hash_get_bucket_generic(interp, hash, key_p, hashval);
     }
 }
 
@@ -1334,28 +1553,149 @@ parrot_hash_get_bucket_string(PARROT_INTERP, ARGIN(const Hash *hash),
         ARGIN(const STRING *s), UINTVAL hashval)
 {
     ASSERT_ARGS(parrot_hash_get_bucket_string)
-    HashBucket *bucket = hash->index[hashval & hash->mask];
 
-    while (bucket) {
-        const STRING *s2 = (const STRING *)bucket->key;
+    hash_probe(hash, hashval,
+        HashBucket   * const bucket = hash->buckets + hash->index[_slot];
+        const STRING * const s2     = (const STRING *)bucket->key;
+
         if (s == s2)
-            break;
+            return bucket;
 
         /* manually inline part of string_equal  */
         if (hashval == s2->hashval) {
             if (s->encoding == s2->encoding) {
                 if ((STRING_byte_length(s) == STRING_byte_length(s2))
                 && (memcmp(s->strstart, s2->strstart, STRING_byte_length(s)) == 0))
-                    break;
+                    return bucket;
             }
             else if (STRING_equal(interp, s, s2)) {
-                break;
+                return bucket;
             }
+        });
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static HashBucket * parrot_hash_get_bucket_generic(PARROT_INTERP, const
+Hash *hash, void *key, size_t hashval)>
+
+Given a hash, a key of any type, and the hashval of the key, returns the
+bucket of the hash holding the key, or NULL.  The hash must have storage.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static HashBucket *
+parrot_hash_get_bucket_generic(PARROT_INTERP, ARGIN(const Hash *hash),
+        ARGIN_NULLOK(void *key), size_t hashval)
+{
+    ASSERT_ARGS(parrot_hash_get_bucket_generic)
+
+    hash_probe(hash, hashval,
+        HashBucket * const bucket = hash->buckets + hash->index[_slot];
+
+        if (hash_compare(interp, hash, key, bucket->key) == 0)
+            return bucket;);
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static UHUGEINTVAL hash_load_group(const unsigned char *control)>
+
+Returns the group of control bytes starting at C<control> as one word.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_INLINE
+static UHUGEINTVAL
+hash_load_group(ARGIN(const unsigned char *control))
+{
+    ASSERT_ARGS(hash_load_group)
+    UHUGEINTVAL group = 0;
+
+    memcpy(&group, control, HASH_GROUP_SIZE);
+
+    return group;
+}
+
+
+/*
+
+=item C<static void hash_index_insert(Hash *hash, BucketIndex b, size_t
+hashval)>
+
+Stores bucket number C<b> in the first free slot of the index along the probe
+sequence of C<hashval>.  The key must not be in the index yet.
+
+=cut
+
+*/
+
+static void
+hash_index_insert(ARGMOD(Hash *hash), BucketIndex b, size_t hashval)
+{
+    ASSERT_ARGS(hash_index_insert)
+    const UINTVAL mask = N_SLOTS(hash->mask + 1) - 1;
+    UINTVAL       pos  = HASH_START(hashval, mask);
+    UINTVAL       step = 0;
+
+    for (;;) {
+        const UHUGEINTVAL group = hash_load_group(hash->control + pos);
+
+        if (GROUP_HAS_FREE(group)) {
+            while (HASH_SLOT_IS_FULL(hash->control[pos]))
+                ++pos;
+
+            if (hash->control[pos] == HASH_SLOT_DELETED)
+                --hash->deleted;
+
+            hash->control[pos] = HASH_FRAGMENT(hashval);
+            hash->index[pos]   = b;
+            return;
         }
-        bucket = bucket->next;
+
+        step += HASH_GROUP_SIZE;
+        pos   = (pos + step) & mask;
     }
+}
 
-    return bucket;
+
+/*
+
+=item C<static void hash_index_remove(Hash *hash, UINTVAL slot)>
+
+Frees C<slot> of the index.  The slot only becomes empty when its group has
+an empty slot already, as then no probe sequence continues past the group.
+Otherwise it is marked deleted.
+
+=cut
+
+*/
+
+static void
+hash_index_remove(ARGMOD(Hash *hash), UINTVAL slot)
+{
+    ASSERT_ARGS(hash_index_remove)
+    const UHUGEINTVAL group = hash_load_group(
+            hash->control + (slot & ~(UINTVAL)(HASH_GROUP_SIZE - 1)));
+
+    if (GROUP_HAS_EMPTY(group))
+        hash->control[slot] = HASH_SLOT_EMPTY;
+    else {
+        hash->control[slot] = HASH_SLOT_DELETED;
+        ++hash->deleted;
+    }
 }
 
 
@@ -1387,19 +1727,22 @@ parrot_hash_store_value_in_bucket(PARROT_INTERP, ARGMOD(Hash *hash),
         bucket->value = value;
     else {
         /* Get a new bucket off the free list. If the free list is empty, we
-           expand the hash so we get more items on the free list */
+           expand the hash so we get more items on the free list. Too many
+           deleted slots make probing slow, so rebuild the index then */
         if (!hash->free_list)
-            expand_hash(interp, hash);
+            resize_hash(interp, hash, (hash->mask + 1) << 1);
+        else if (hash->deleted > N_SLOTS(hash->mask + 1) / 4)
+            resize_hash(interp, hash, hash->mask + 1);
 
         bucket = hash->free_list;
 
         /* Add the value to the new bucket, increasing the count of elements */
         ++hash->entries;
-        hash->free_list                   = bucket->next;
-        bucket->key                       = key;
-        bucket->value                     = value;
-        bucket->next                      = hash->index[hashval & hash->mask];
-        hash->index[hashval & hash->mask] = bucket;
+        hash->free_list = bucket->next;
+        bucket->key     = key;
+        bucket->value   = value;
+        bucket->next    = bucket;
+        hash_index_insert(hash, (BucketIndex)(bucket - hash->buckets), (size_t)hashval);
     }
 }
 
@@ -1438,13 +1781,7 @@ Parrot_hash_put(PARROT_INTERP, ARGMOD(Hash *hash),
         }
         else {
             hashval = key_hash(interp, hash, key);
-            bucket  = hash->index[hashval & hash->mask];
-
-            while (bucket) {
-                if (hash_compare(interp, hash, key, bucket->key) == 0)
-                    break;
-                bucket = bucket->next;
-            }
+            bucket  = parrot_hash_get_bucket_generic(interp, hash, key, hashval);
         }
     }
 
@@ -1470,20 +1807,18 @@ void
 Parrot_hash_delete(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN_NULLOK(void *key))
 {
     ASSERT_ARGS(Parrot_hash_delete)
-    const UINTVAL hashval = key_hash(interp, hash, key) & hash->mask;
+    const size_t hashval = key_hash(interp, hash, key);
     if (hash->buckets){
-        HashBucket   **prev   = &hash->index[hashval];
-        for (; *prev; prev = &(*prev)->next) {
-            HashBucket * const current = *prev;
+        hash_probe(hash, hashval,
+            HashBucket * const current = hash->buckets + hash->index[_slot];
             if (hash_compare(interp, hash, key, current->key) == 0) {
-                *prev = current->next;
+                hash_index_remove(hash, _slot);
                 --hash->entries;
                 current->next    = hash->free_list;
                 current->key     = NULL;
                 hash->free_list = current;
                 return;
-            }
-        }
+            });
     }
 }
 
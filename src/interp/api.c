@@ -21,6 +21,7 @@ Functions related to managing the Parrot interpreter
 #include "parrot/runcore_api.h"
 #include "parrot/oplib/core_ops.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_continuation.h"
 #include "../gc/gc_private.h"
 #include "api.str"
 #include "pmc/pmc_parrotinterpreter.h"
@@ -286,7 +287,12 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
 
     /* Set up MMD; MMD cache for builtins. */
     interp->op_mmd_cache = Parrot_mmd_cache_create(interp);
-    Parrot_pmc_gc_register(interp, interp->op_mmd_cache);
+
+    /* Parsed signatures of calls made from C */
+    interp->pcc_signatures = Parrot_pcc_signature_cache_create(interp);
+
+    /* Files located in the library search paths */
+    interp->lib_lookups = Parrot_lib_lookup_cache_create(interp);
 
     Parrot_gbl_init_world_once(interp);
 
@@ -300,6 +306,10 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
 #endif
     }
 
+    /* list the library search directories instead of probing each file */
+    if (Parrot_interp_is_env_var_set(interp, CONST_STRING(interp, "PARROT_LIBRARY_INDEX")))
+        interp->lib_lookups->index_dirs = 1;
+
     /* Initialize interpreter's flags */
     PARROT_WARNINGS_off(interp, PARROT_WARNINGS_ALL_FLAG);
 
@@ -337,7 +347,10 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
     Parrot_cx_init_scheduler(interp);
 
 #ifdef PARROT_HAS_THREADS
-    interp->wake_up = 0;
+    PARROT_ATOMIC_INT_INIT(interp->wake_up);
+    PARROT_ATOMIC_INT_INIT(interp->asleep);
+    PARROT_ATOMIC_INT_SET(interp->wake_up, 0);
+    PARROT_ATOMIC_INT_SET(interp->asleep, 0);
     COND_INIT(interp->sleep_cond);
     MUTEX_INIT(interp->sleep_mutex);
 #endif
@@ -382,14 +395,20 @@ PMC *
 Parrot_interp_clone(PARROT_INTERP, INTVAL flags)
 {
     ASSERT_ARGS(Parrot_interp_clone)
-    /* have to pass a parent to allocate_interpreter to prevent PMCNULL from being set to NULL */
-    Parrot_Interp d = Parrot_interp_allocate_interpreter(interp, flags);
+    Parrot_Interp d;
     int stacktop;
     Parrot_GC_Init_Args args;
 
     PMC * interp_pmc;
-    PMC * const config_hash = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
-                                                       IGLOBALS_CONFIG_HASH);
+    PMC * config_hash;
+
+    /* the clone shares our constant tables, so they must be complete */
+    Parrot_pf_thaw_frozen_constants(interp);
+
+    /* have to pass a parent to allocate_interpreter to prevent PMCNULL from being set to NULL */
+    d = Parrot_interp_allocate_interpreter(interp, flags);
+    config_hash = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                           IGLOBALS_CONFIG_HASH);
 
     memset(&args, 0, sizeof (args));
     args.stacktop = &stacktop;
@@ -416,6 +435,9 @@ Parrot_interp_clone(PARROT_INTERP, INTVAL flags)
 
     /* create caches structure */
     init_object_cache(d);
+    d->pcc_signatures = Parrot_pcc_signature_cache_create(d);
+    d->lib_lookups    = Parrot_lib_lookup_cache_create(d);
+    d->lib_lookups->index_dirs = interp->lib_lookups->index_dirs;
 
     d->n_vtable_max = interp->n_vtable_max;
     d->vtables      = interp->vtables;
@@ -628,6 +650,20 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
     /* cache structure */
     destroy_object_cache(interp);
 
+    Parrot_mmd_cache_destroy(interp, interp->op_mmd_cache);
+    interp->op_mmd_cache = NULL;
+
+    if (interp->mmd_type_tuples) {
+        Parrot_hash_destroy(interp, interp->mmd_type_tuples);
+        interp->mmd_type_tuples = NULL;
+    }
+
+    Parrot_pcc_signature_cache_destroy(interp, interp->pcc_signatures);
+    interp->pcc_signatures = NULL;
+
+    Parrot_lib_lookup_cache_destroy(interp, interp->lib_lookups);
+    interp->lib_lookups = NULL;
+
     if (interp->evc_func_table) {
         mem_gc_free(interp, interp->evc_func_table);
         interp->evc_func_table      = NULL;
@@ -992,6 +1028,18 @@ Parrot_interp_info(PARROT_INTERP, INTVAL what)
       case IMPATIENT_PMCS:
         ret = Parrot_gc_impatient_pmcs(interp);
         break;
+      case GC_MARK_THREADS:
+        ret = Parrot_gc_mark_threads(interp);
+        break;
+      case GC_MARK_SLICES:
+        ret = Parrot_gc_count_mark_slices(interp);
+        break;
+      case GC_TRACE_ROOTS_TIME:
+      case GC_DIRTY_LIST_TIME:
+      case GC_WORK_LIST_TIME:
+      case GC_SWEEP_TIME:
+        ret = Parrot_gc_phase_time(interp, (Interpinfo_enum)what);
+        break;
       case CURRENT_RUNCORE:
         ret = interp->run_core->id;
         break;
@@ -1052,6 +1100,10 @@ Parrot_interp_info_p(PARROT_INTERP, INTVAL what)
         break;
       case CURRENT_CONT:
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+
+        /* It may get invoked after the caller returned */
+        if (!PMC_IS_NULL(result) && !PMC_IS_NULL(PARROT_CONTINUATION(result)->to_ctx))
+            CALLSIGNATURE_is_captured_SET(PARROT_CONTINUATION(result)->to_ctx);
         break;
       case CURRENT_LEXPAD:
         result = Parrot_pcc_get_lex_pad(interp, CURRENT_CONTEXT(interp));
@@ -1429,6 +1481,13 @@ Parrot_interp_set_run_core(PARROT_INTERP, Parrot_Run_core_t core)
       case PARROT_FAST_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
         break;
+      case PARROT_CGOTO_CORE:
+#if PARROT_HAS_CGOTO
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
+#else
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
+#endif
+        break;
       case PARROT_EXEC_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "exec"));
         break;
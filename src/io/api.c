@@ -338,14 +338,22 @@ Parrot_io_open(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(STRING *path),
     {
         const INTVAL flags = Parrot_io_parse_open_flags(interp, mode);
         INTVAL status = vtable->open(interp, handle, path, flags, mode);
+        INTVAL mapped;
 
         if (!status)
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
                 "Unable to open %s from path '%Ss'", vtable->name, path);
 
+        /* A read-only file may be read through a mapping, which takes the
+           place of the read buffer. */
+        mapped = flags & PIO_F_MMAP
+              && (flags & (PIO_F_READ|PIO_F_WRITE)) == PIO_F_READ
+              && vtable->number == IO_VTABLE_FILEHANDLE
+              && Parrot_io_buffer_map(interp, handle, vtable);
+
         /* If this type uses buffers by default, set them up, and if we're
            in an acceptable mode, set up buffers. */
-        if (vtable->flags & PIO_VF_DEFAULT_READ_BUF && flags & PIO_F_READ)
+        if (!mapped && vtable->flags & PIO_VF_DEFAULT_READ_BUF && flags & PIO_F_READ)
             Parrot_io_buffer_add_to_handle(interp, handle, IO_PTR_IDX_READ_BUFFER, BUFFER_SIZE_ANY,
                                            PIO_BF_BLKBUF);
         if (vtable->flags & PIO_VF_DEFAULT_WRITE_BUF && flags & PIO_F_WRITE)
@@ -555,7 +563,9 @@ Parrot_io_close(PARROT_INTERP, ARGMOD(PMC *handle), INTVAL autoflush)
         IO_BUFFER * const read_buffer = IO_GET_READ_BUFFER(interp, handle);
         if (write_buffer)
             Parrot_io_buffer_flush(interp, write_buffer, handle, vtable);
-        if (read_buffer)
+        if (read_buffer && read_buffer->flags & PIO_BF_MMAP)
+            Parrot_io_buffer_remove_from_handle(interp, handle, IO_PTR_IDX_READ_BUFFER);
+        else if (read_buffer)
             Parrot_io_buffer_clear(interp, read_buffer);
 
         /* TODO: We need to better-document the autoflush values, and maybe
@@ -564,6 +574,11 @@ Parrot_io_close(PARROT_INTERP, ARGMOD(PMC *handle), INTVAL autoflush)
             autoflush = (vtable->flags & PIO_VF_FLUSH_ON_CLOSE) ? 1 : 0;
         if (autoflush == 1)
             vtable->flush(interp, handle);
+
+        /* A task waiting for the handle would wait forever */
+        if (Parrot_cx_io_waiting(interp))
+            Parrot_cx_cancel_io(interp, handle);
+
         return vtable->close(interp, handle);
     }
 }
@@ -711,7 +726,7 @@ Parrot_io_read_s(PARROT_INTERP, ARGMOD(PMC *handle), size_t length)
            avoid using a read_buffer here. Detect that case and don't assign
            a buffer if not needed. */
         if (read_buffer == NULL)
-            read_buffer = io_verify_has_read_buffer(interp, handle, vtable, BUFFER_SIZE_ANY);
+            read_buffer = io_verify_has_read_buffer(interp, handle, vtable, BUFFER_FLAGS_ANY);
         io_verify_is_open_for(interp, handle, vtable, PIO_F_READ);
         io_sync_buffers_for_read(interp, handle, vtable, read_buffer, write_buffer);
 
@@ -792,7 +807,12 @@ Parrot_io_readall_s(PARROT_INTERP, ARGMOD(PMC *handle))
         else {
             size_t remaining_size = total_size - vtable->get_position(interp, handle);
             IO_BUFFER * const read_buffer = IO_GET_READ_BUFFER(interp, handle);
-            STRING * const s = io_get_new_empty_string(interp, encoding, -1, remaining_size);
+
+            /* The data of a mapped file is not copied, don't allocate room
+               for it. */
+            STRING * const s = read_buffer && read_buffer->flags & PIO_BF_MMAP
+                             ? Parrot_str_new_init(interp, NULL, 0, encoding, 0)
+                             : io_get_new_empty_string(interp, encoding, -1, remaining_size);
 
             io_sync_buffers_for_read(interp, handle, vtable, read_buffer, write_buffer);
             if (remaining_size > 0 && !Parrot_io_eof(interp, handle))
@@ -827,13 +847,16 @@ Parrot_io_read_byte_buffer_pmc(PARROT_INTERP, ARGMOD(PMC *handle),
         ARGMOD_NULLOK(PMC *buffer), size_t byte_length)
 {
     ASSERT_ARGS(Parrot_io_read_byte_buffer_pmc)
+    INTVAL new_buffer = 0;
 
     if (PMC_IS_NULL(handle))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_PIO_ERROR,
             "Attempt to read bytes from a null or invalid PMC");
 
-    if (PMC_IS_NULL(buffer))
-        buffer = Parrot_pmc_new(interp, enum_class_ByteBuffer);
+    if (PMC_IS_NULL(buffer)) {
+        buffer     = Parrot_pmc_new(interp, enum_class_ByteBuffer);
+        new_buffer = 1;
+    }
 
     if (!byte_length)
         return buffer;
@@ -862,6 +885,20 @@ Parrot_io_read_byte_buffer_pmc(PARROT_INTERP, ARGMOD(PMC *handle),
                 return buffer;
         }
 
+        /* A new ByteBuffer can use the data of a mapped file in place, with
+           a STRING pointing into the mapping as its source. */
+        if (read_buffer && read_buffer->flags & PIO_BF_MMAP && new_buffer
+        &&  byte_length <= BUFFER_USED_SIZE(read_buffer)) {
+            STRING * const source = Parrot_str_new_init(interp, NULL, 0,
+                                                        Parrot_binary_encoding_ptr, 0);
+            io_read_chars_append_string(interp, source, handle, vtable, read_buffer,
+                                        byte_length);
+            SETATTR_ByteBuffer_source(interp, buffer, source);
+            SETATTR_ByteBuffer_size(interp, buffer, byte_length);
+            PARROT_GC_WRITE_BARRIER(interp, buffer);
+            return buffer;
+        }
+
         VTABLE_set_integer_native(interp, buffer, byte_length);
         content = (char *)VTABLE_get_pointer(interp, buffer);
         bytes_read = Parrot_io_buffer_read_b(interp, read_buffer, handle, vtable, content,
@@ -965,7 +1002,7 @@ Parrot_io_readline_s(PARROT_INTERP, ARGMOD(PMC *handle), ARGIN(STRING * terminat
         io_verify_is_open_for(interp, handle, vtable, PIO_F_READ);
 
         if (read_buffer == NULL)
-            read_buffer = io_verify_has_read_buffer(interp, handle, vtable, BUFFER_SIZE_ANY);
+            read_buffer = io_verify_has_read_buffer(interp, handle, vtable, BUFFER_FLAGS_ANY);
 
         /* Because of the way buffering works, the terminator sequence may be,
            at most, one character shorter than half the size of the buffer.
@@ -973,7 +1010,8 @@ Parrot_io_readline_s(PARROT_INTERP, ARGMOD(PMC *handle), ARGIN(STRING * terminat
            this isn't a big deal. */
         max_delimiter_byte_size = (read_buffer->buffer_size / 2) -
                                      STRING_max_bytes_per_codepoint(terminator);
-        if (terminator->bufused > max_delimiter_byte_size)
+        if (terminator->bufused > max_delimiter_byte_size
+        &&  !(read_buffer->flags & PIO_BF_MMAP))
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
                 "Readline terminator string must be smaller than %d bytes for this buffer");
 
@@ -1143,6 +1181,13 @@ Parrot_io_seek(PARROT_INTERP, ARGMOD(PMC *handle), PIOOFF_T offset, INTVAL w)
         if (write_buffer)
             Parrot_io_buffer_flush(interp, write_buffer, handle, vtable);
 
+        /* A mapping knows the size of the file, so the end is just another
+           offset from the start. */
+        if (read_buffer && read_buffer->flags & PIO_BF_MMAP && w == SEEK_END) {
+            offset += read_buffer->buffer_size;
+            w  = SEEK_SET;
+        }
+
         if (read_buffer && w != SEEK_END) {
             const PIOOFF_T new_offset = Parrot_io_buffer_seek(interp, read_buffer,
                                                 handle, vtable, offset, w);
@@ -35,6 +35,20 @@ static void io_buffer_add_bytes(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*buffer);
 
+PARROT_WARN_UNUSED_RESULT
+static size_t io_buffer_find_byte_marker(
+    ARGIN(const IO_BUFFER *buffer),
+    ARGIN(const STR_VTABLE *encoding),
+    ARGOUT(Parrot_String_Bounds *bounds),
+    char delim,
+    ARGOUT(INTVAL *have_delim))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*bounds)
+        FUNC_MODIFIES(*have_delim);
+
 static void io_buffer_normalize(PARROT_INTERP,
     ARGMOD_NULLOK(IO_BUFFER *buffer))
         __attribute__nonnull__(1)
@@ -56,9 +70,18 @@ static size_t io_buffer_transfer_to_mem(PARROT_INTERP,
         FUNC_MODIFIES(*buffer)
         FUNC_MODIFIES(* s);
 
+static void io_buffer_unmap(PARROT_INTERP, ARGIN(IO_BUFFER *buffer))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_io_buffer_add_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(buffer) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_io_buffer_find_byte_marker __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buffer) \
+    , PARROT_ASSERT_ARG(encoding) \
+    , PARROT_ASSERT_ARG(bounds) \
+    , PARROT_ASSERT_ARG(have_delim))
 #define ASSERT_ARGS_io_buffer_normalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_io_buffer_requires_flush __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -67,6 +90,9 @@ static size_t io_buffer_transfer_to_mem(PARROT_INTERP,
 #define ASSERT_ARGS_io_buffer_transfer_to_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_io_buffer_unmap __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buffer))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -79,7 +105,8 @@ Allocate a new buffer for PMC C<owner> with the given flags and settings.
 
 =item C<void Parrot_io_buffer_free(PARROT_INTERP, IO_BUFFER *buffer)>
 
-Free the C<buffer> memory.
+Free the C<buffer> memory. A file mapping which STRINGs still point into is
+unmapped when the last of them is freed.
 
 =cut
 
@@ -117,6 +144,7 @@ Parrot_io_buffer_allocate(PARROT_INTERP, ARGMOD(PMC *owner), INTVAL flags,
     PARROT_ASSERT(BUFFER_IS_EMPTY(buffer));
 
     buffer->raw_reads = 0;
+    buffer->mapping   = NULL;
 
     buffer->flags = flags;
     return buffer;
@@ -131,12 +159,97 @@ Parrot_io_buffer_free(PARROT_INTERP, ARGFREE(IO_BUFFER *buffer))
             mem_sys_free(buffer->buffer_start);
         }
         else if (buffer->flags & PIO_BF_MMAP) {
-            /* TODO */
+            io_buffer_unmap(interp, buffer);
         }
     }
     Parrot_gc_free_fixed_size_storage(interp, sizeof (IO_BUFFER), buffer);
 }
 
+/*
+
+=item C<INTVAL Parrot_io_buffer_map(PARROT_INTERP, PMC *handle, const IO_VTABLE
+*vtable)>
+
+Map the file open on C<handle> into memory and attach the mapping to the
+handle as its read buffer. The whole file then sits in the buffer, so reads
+never go to the OS and STRINGs read from the handle can point straight into
+the mapping. The OS handle is left at the end of the mapped data.
+
+Returns C<1> if the file was mapped and C<0> if it could not be (the size is
+unknown or zero, C<mmap> failed or is not available). The handle is left
+unchanged then.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_buffer_map(PARROT_INTERP, ARGMOD(PMC *handle), ARGIN(const IO_VTABLE *vtable))
+{
+    ASSERT_ARGS(Parrot_io_buffer_map)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    const size_t    size = vtable->total_size(interp, handle);
+    const PIOHANDLE os_handle = vtable->get_piohandle(interp, handle);
+    PIOOFF_T        pos;
+    IO_BUFFER      *buffer;
+    void           *map;
+
+    if (size == 0 || size == PIO_UNKNOWN_SIZE)
+        return 0;
+
+    pos = vtable->tell(interp, handle);
+    if (pos < 0 || (size_t)pos > size)
+        return 0;
+
+    map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, os_handle, 0);
+    if (map == MAP_FAILED)
+        return 0;
+#  ifdef MADV_SEQUENTIAL
+    madvise(map, size, MADV_SEQUENTIAL);
+#  endif
+
+    /* A handle being reopened may still have its old buffer */
+    Parrot_io_buffer_remove_from_handle(interp, handle, IO_PTR_IDX_READ_BUFFER);
+
+    buffer = Parrot_io_buffer_allocate(interp, handle, PIO_BF_MMAP, NULL, 0);
+    buffer->buffer_ptr   = (char *)map;
+    buffer->buffer_size  = size;
+    buffer->buffer_start = buffer->buffer_ptr + pos;
+    buffer->buffer_end   = buffer->buffer_ptr + size;
+    buffer->mapping      = Parrot_str_new_mapping(interp, buffer->buffer_ptr, size);
+    BUFFER_ASSERT_SANITY(buffer);
+
+    Parrot_io_internal_seek(interp, os_handle, (PIOOFF_T)size, SEEK_SET);
+    VTABLE_set_pointer_keyed_int(interp, handle, IO_PTR_IDX_READ_BUFFER, buffer);
+    return 1;
+#else
+    UNUSED(interp);
+    UNUSED(handle);
+    UNUSED(vtable);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<static void io_buffer_unmap(PARROT_INTERP, IO_BUFFER *buffer)>
+
+Drop the reference of C<buffer> to its file mapping. STRINGs read from the
+mapping point straight into it and hold references of their own, so it is only
+unmapped once the last of them is freed too.
+
+=cut
+
+*/
+
+static void
+io_buffer_unmap(PARROT_INTERP, ARGIN(IO_BUFFER *buffer))
+{
+    ASSERT_ARGS(io_buffer_unmap)
+    Parrot_str_release_mapping(interp, buffer->mapping);
+    buffer->mapping = NULL;
+}
+
 
 /*
 
@@ -146,13 +259,15 @@ INTVAL idx, const size_t length, const INTVAL flags)>
 Allocate a new C<IO_BUFFER*> and attach it to PMC C<handle> at position
 C<idx>. Valid positions are C<IO_PTR_IDX_READ_BUFFER> and
 C<IO_PTR_IDX_WRITE_BUFFER>. If the buffer already exists, resize it to match
-the specifications.
+the specifications. A file mapping already holds the whole file and is left
+as it is.
 
 =item C<void Parrot_io_buffer_remove_from_handle(PARROT_INTERP, PMC *handle,
 const INTVAL idx)>
 
 Remove the buffer from C<handle> at position C<idx>. Valid positions are
-C<IO_PTR_IDX_READ_BUFFER> and  C<IO_PTR_IDX_WRITE_BUFFER>.
+C<IO_PTR_IDX_READ_BUFFER> and  C<IO_PTR_IDX_WRITE_BUFFER>. Removing a file
+mapping moves the OS handle back to the first byte not read yet.
 
 =cut
 
@@ -168,6 +283,8 @@ Parrot_io_buffer_add_to_handle(PARROT_INTERP, ARGMOD(PMC *handle), const INTVAL
             "Unknown buffer number %d", idx);
     {
         IO_BUFFER * buffer = (IO_BUFFER *)VTABLE_get_pointer_keyed_int(interp, handle, idx);
+        if (buffer && buffer->flags & PIO_BF_MMAP)
+            return;
         if (buffer) {
             Parrot_io_buffer_resize(interp, buffer, length);
             PARROT_ASSERT(length == BUFFER_SIZE_ANY || buffer->buffer_size >= length);
@@ -193,6 +310,10 @@ Parrot_io_buffer_remove_from_handle(PARROT_INTERP, ARGMOD(PMC *handle), const IN
         IO_BUFFER * const buffer = (IO_BUFFER *)VTABLE_get_pointer_keyed_int(interp, handle, idx);
         if (!buffer)
             return;
+        if (buffer->flags & PIO_BF_MMAP) {
+            const IO_VTABLE * const vtable = IO_GET_VTABLE(interp, handle);
+            vtable->seek(interp, handle, vtable->get_position(interp, handle), SEEK_SET);
+        }
         /* TODO: Decrease reference count, only free it if the refcount is
            zero */
         Parrot_io_buffer_free(interp, buffer);
@@ -207,7 +328,7 @@ new_size)>
 
 Resize the C<buffer> to be able to accommodate the C<new_size>. The buffer may
 grow but probably will not shrink to avoid data loss. Return the new size of
-the buffer.
+the buffer. A file mapping is never resized.
 
 =cut
 
@@ -217,7 +338,7 @@ size_t
 Parrot_io_buffer_resize(SHIM_INTERP, ARGMOD(IO_BUFFER *buffer), size_t new_size)
 {
     ASSERT_ARGS(Parrot_io_buffer_resize)
-    if (new_size == BUFFER_SIZE_ANY)
+    if (new_size == BUFFER_SIZE_ANY || buffer->flags & PIO_BF_MMAP)
         return buffer->buffer_size;
 
     if (new_size < PIO_BUFFER_MIN_SIZE)
@@ -255,7 +376,8 @@ Parrot_io_buffer_mark(SHIM_INTERP, ARGMOD_NULLOK(IO_BUFFER *buffer))
 
 =item C<void Parrot_io_buffer_clear(PARROT_INTERP, IO_BUFFER *buffer)>
 
-Clear the buffer, erasing all data and normalizing all pointers.
+Clear the buffer, erasing all data and normalizing all pointers. Clearing a
+file mapping skips to the end of the file.
 
 =cut
 
@@ -267,6 +389,10 @@ Parrot_io_buffer_clear(SHIM_INTERP, ARGMOD_NULLOK(IO_BUFFER *buffer))
     ASSERT_ARGS(Parrot_io_buffer_clear)
     if (!buffer)
         return;
+    if (buffer->flags & PIO_BF_MMAP) {
+        buffer->buffer_start = buffer->buffer_end;
+        return;
+    }
     buffer->buffer_start = buffer->buffer_ptr;
     buffer->buffer_end = buffer->buffer_ptr;
     BUFFER_ASSERT_SANITY(buffer);
@@ -361,7 +487,8 @@ io_buffer_transfer_to_mem(PARROT_INTERP, ARGMOD_NULLOK(IO_BUFFER *buffer),
 =item C<static void io_buffer_normalize(PARROT_INTERP, IO_BUFFER *buffer)>
 
 Attempt to normalize the buffer. If we can, move data to the front of the
-buffer so we have the maximum amount of contiguous free space
+buffer so we have the maximum amount of contiguous free space. A file mapping
+is read-only and always full, so it is left alone.
 
 =cut
 
@@ -374,7 +501,7 @@ io_buffer_normalize(PARROT_INTERP, ARGMOD_NULLOK(IO_BUFFER *buffer))
     /* BUFFER_DBG_PRINT(buffer); */
     BUFFER_ASSERT_SANITY(buffer);
 
-    if (!buffer)
+    if (!buffer || buffer->flags & PIO_BF_MMAP)
         return;
 
     if (BUFFER_IS_EMPTY(buffer)) {
@@ -661,6 +788,66 @@ Parrot_io_buffer_advance_position(PARROT_INTERP, ARGMOD_NULLOK(IO_BUFFER *buffer
 
 /*
 
+=item C<static size_t io_buffer_find_byte_marker(const IO_BUFFER *buffer, const
+STR_VTABLE *encoding, Parrot_String_Bounds *bounds, char delim, INTVAL
+*have_delim)>
+
+Fast path of C<io_buffer_find_string_marker> for a one-byte ASCII delimiter
+in UTF-8 or an 8-bit encoding. Finds C<delim> with C<memchr> and returns the
+number of bytes up to and including it. Without the delimiter, returns the
+whole buffer less a UTF-8 character cut off at its end. The characters are
+not counted here; reading them into a STRING counts and checks them.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static size_t
+io_buffer_find_byte_marker(ARGIN(const IO_BUFFER *buffer),
+        ARGIN(const STR_VTABLE *encoding), ARGOUT(Parrot_String_Bounds *bounds),
+        char delim, ARGOUT(INTVAL *have_delim))
+{
+    ASSERT_ARGS(io_buffer_find_byte_marker)
+    const char * const start = buffer->buffer_start;
+    const char * const found = (const char *)memchr(start, delim, BUFFER_USED_SIZE(buffer));
+    size_t bytes;
+
+    if (found) {
+        bytes       = found - start + 1;
+        *have_delim = 1;
+    }
+    else {
+        bytes = BUFFER_USED_SIZE(buffer);
+
+        if (encoding == Parrot_utf8_encoding_ptr) {
+            /* Find the start byte of the last character, and leave the
+               character for the next fill if it is incomplete. */
+            const unsigned char * const end = (const unsigned char *)start + bytes;
+            size_t tail = 1;
+
+            while (tail < 4 && tail < bytes && (*(end - tail) & 0xC0) == 0x80)
+                ++tail;
+
+            if (*(end - tail) >= 0xC0) {
+                const size_t needed = *(end - tail) >= 0xF0 ? 4
+                                    : *(end - tail) >= 0xE0 ? 3
+                                    : 2;
+                if (needed > tail)
+                    bytes -= tail;
+            }
+        }
+    }
+
+    bounds->bytes = bytes;
+    bounds->chars = -1;
+    bounds->delim = found ? delim : -1;
+
+    return bytes;
+}
+
+/*
+
 =item C<size_t io_buffer_find_string_marker(PARROT_INTERP, IO_BUFFER *buffer,
 PMC *handle, const IO_VTABLE *vtable, const STR_VTABLE *encoding,
 Parrot_String_Bounds *bounds, STRING * delim, INTVAL *have_delim)>
@@ -690,13 +877,29 @@ io_buffer_find_string_marker(PARROT_INTERP, ARGMOD(IO_BUFFER *buffer),
 
     const size_t delim_bytelen = STRING_byte_length(delim);
     const size_t bytes_available = BUFFER_USED_SIZE(buffer);
+    size_t scan_bytes = bytes_available;
 
     *have_delim = 0;
 
     if (bytes_available == 0)
         return 0;
 
-    bounds->bytes = bytes_available;
+    /* Most lines end in "\n". An ASCII byte is always a character of its own
+       in UTF-8 and the 8-bit encodings, so find it without decoding. */
+    if (delim_bytelen == 1
+    &&  (unsigned char)delim->strstart[0] < 0x80
+    &&  (encoding == Parrot_utf8_encoding_ptr || encoding->max_bytes_per_codepoint == 1))
+        return io_buffer_find_byte_marker(buffer, encoding, bounds,
+                delim->strstart[0], have_delim);
+
+    /* A file mapping holds the rest of the file. Don't scan all of it for
+       every line, start with the size of a line buffer and widen the scan
+       until the delimiter turns up. */
+    if (buffer->flags & PIO_BF_MMAP && scan_bytes > PIO_BUFFER_LINEBUF_SIZE)
+        scan_bytes = PIO_BUFFER_LINEBUF_SIZE;
+
+  scan:
+    bounds->bytes = scan_bytes;
     bounds->chars = -1;
     bounds->delim = -1;
 
@@ -731,6 +934,13 @@ io_buffer_find_string_marker(PARROT_INTERP, ARGMOD(IO_BUFFER *buffer),
             return bounds->bytes + delim_bytelen;
         }
 
+        if (scan_bytes < bytes_available) {
+            scan_bytes = scan_bytes < bytes_available / 2
+                       ? scan_bytes * 2
+                       : bytes_available;
+            goto scan;
+        }
+
         /* If we haven't found the delimiter, we MIGHT have part of it. First,
            check a few simplifying cases before we do anything else.
 
@@ -744,8 +954,10 @@ io_buffer_find_string_marker(PARROT_INTERP, ARGMOD(IO_BUFFER *buffer),
            left for us to read because we tried to fill before we started this
            loop. If so, just return all the bytes in the buffer. If we've hit
            EOF and don't have the terminator, we'll never have it, so just
-           return everything also. */
-        if (BUFFER_FREE_END_SPACE(buffer) > 0 || vtable->is_eof(interp, handle))
+           return everything also. A file mapping holds the rest of the file,
+           so there is nothing more to come either. */
+        if (BUFFER_FREE_END_SPACE(buffer) > 0 || vtable->is_eof(interp, handle)
+        ||  buffer->flags & PIO_BF_MMAP)
             return bounds->bytes;
 
         /* If the delimiter is multiple bytes, we might have part of it. We need
@@ -824,7 +1036,8 @@ io_buffer_find_num_characters(PARROT_INTERP, ARGMOD(IO_BUFFER *buffer),
 Perform a seek in the buffer. C<w> must be C<SEEK_SET>, currently. This must
 be a read buffer. If the buffer contains enough data to satisfy the seek,
 adjust the pointer accordingly and continue. Otherwise, clear the buffer and
-perform a seek on the underlying handle.
+perform a seek on the underlying handle. A file mapping holds the whole file,
+so seeking in it never touches the underlying handle.
 
 =cut
 
@@ -843,6 +1056,17 @@ Parrot_io_buffer_seek(PARROT_INTERP, ARGMOD(IO_BUFFER *buffer),
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
             "Illegal seek origin argument, only SEEK_SET is supported");
 
+    if (buffer->flags & PIO_BF_MMAP) {
+        if (offset < 0)
+            Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_OUT_OF_BOUNDS,
+                "Illegal seek offset argument");
+        buffer->buffer_start = (size_t)offset < buffer->buffer_size
+                             ? buffer->buffer_ptr + offset
+                             : buffer->buffer_end;
+        vtable->set_eof(interp, handle, 0);
+        return offset;
+    }
+
     if (cur_pos == offset)
         return offset;
     if (offset < cur_pos) {
@@ -209,6 +209,7 @@ io_socket_setup_vtable(PARROT_INTERP, ARGMOD_NULLOK(IO_VTABLE *vtable), INTVAL i
     vtable->set_flags = io_socket_set_flags;
     vtable->get_flags = io_socket_get_flags;
     vtable->total_size = io_socket_total_size;
+    vtable->get_piohandle = io_socket_get_piohandle;
 }
 
 /*
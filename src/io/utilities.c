@@ -33,7 +33,8 @@ of intelligence between the IO API and the buffering API.
 *mode_str)>
 
 Parses a Parrot string for file open mode flags (C<r> for read, C<w> for write,
-C<a> for append, and C<p> for pipe) and returns the combined generic bit flags.
+C<a> for append, C<p> for pipe, C<b> for binary and C<m> to read through a
+memory mapping of the file) and returns the combined generic bit flags.
 
 =cut
 
@@ -76,6 +77,9 @@ Parrot_io_parse_open_flags(PARROT_INTERP, ARGIN(const STRING *mode_str))
           case 'b':
             flags |= PIO_F_BINARY;
             break;
+          case 'm':
+            flags |= PIO_F_MMAP;
+            break;
           default:
             break;
         }
@@ -365,6 +369,10 @@ reading. The value in C<adv_length>, if larger than C<byte_length> is the
 actual number of bytes to advance the buffer by (the difference adv_length -
 byte_length are characters which are discarded).
 
+If C<buffer> is a file mapping and the STRING is still empty, the STRING is
+pointed straight into the mapping instead of copying the data. The STRING then
+keeps the mapping from being unmapped when the handle is closed.
+
 =cut
 
 */
@@ -380,7 +388,30 @@ io_read_chars_append_string(PARROT_INTERP, ARGMOD(STRING * s),
     PARROT_ASSERT(s->encoding);
     PARROT_ASSERT(byte_length > 0);
 
-    if (alloc_size > s->_buflen) {
+    if (buffer && buffer->flags & PIO_BF_MMAP
+    &&  s->bufused == 0 && byte_length <= BUFFER_USED_SIZE(buffer)) {
+        Buffer_bufstart(s) = s->strstart = buffer->buffer_start;
+        Buffer_buflen(s)   = s->bufused  = byte_length;
+        Parrot_str_attach_mapping(interp, s, buffer->mapping);
+        buffer->buffer_start += byte_length;
+        vtable->adv_position(interp, handle, byte_length);
+        STRING_scan(interp, s);
+        return;
+    }
+
+    if (PObj_external_TEST(s)) {
+        /* Appending to a STRING which points into a mapping. Copy it out
+           first, the mapping is read-only. */
+        STRING mapped = *s;
+        Parrot_gc_allocate_string_storage(interp, s, alloc_size);
+        memcpy(s->strstart, mapped.strstart, s->bufused);
+        PObj_external_CLEAR(s);
+        if (PObj_mapped_TEST(s)) {
+            PObj_mapped_CLEAR(s);
+            Parrot_str_detach_mapping(interp, &mapped);
+        }
+    }
+    else if (alloc_size > s->_buflen) {
         if (s->strstart)
             Parrot_gc_reallocate_string_storage(interp, s, alloc_size);
         else
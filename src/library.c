@@ -35,6 +35,11 @@ static void add_env_paths(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void clear_lookup_list(PARROT_INTERP, ARGMOD(Lib_lookup_list *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*list);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static STRING * cnv_to_win32_filesep(PARROT_INTERP,
@@ -42,6 +47,38 @@ static STRING * cnv_to_win32_filesep(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * directory_entry_of(PARROT_INTERP,
+    ARGIN(STRING *file),
+    enum_runtime_ft type)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static INTVAL directory_has_entry(PARROT_INTERP,
+    ARGMOD(Lib_lookup_list *list),
+    ARGIN(STRING *dir),
+    ARGIN(STRING *entry))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*list);
+
+static INTVAL directory_mtime(PARROT_INTERP, ARGIN(STRING *dir))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static Lib_lookup_list * get_lookup_list(PARROT_INTERP,
+    enum_lib_paths which,
+    ARGIN(PMC *paths),
+    ARGIN(STRING *prefix))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC* get_search_paths(PARROT_INTERP, enum_lib_paths which)
@@ -52,6 +89,11 @@ static int is_abs_path(PARROT_INTERP, ARGIN(const STRING *file))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static INTVAL listings_unchanged(PARROT_INTERP,
+    ARGIN(Lib_lookup_list *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static STRING* path_concat(PARROT_INTERP,
@@ -68,6 +110,20 @@ static STRING* path_guarantee_trailing_separator(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING* search_runtime_paths(PARROT_INTERP,
+    ARGIN(STRING *file),
+    enum_runtime_ft type,
+    ARGIN(PMC *paths),
+    ARGIN(STRING *prefix),
+    ARGMOD_NULLOK(Lib_lookup_list *list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*list);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
@@ -84,14 +140,35 @@ static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(libpath) \
     , PARROT_ASSERT_ARG(envstr))
+#define ASSERT_ARGS_clear_lookup_list __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_cnv_to_win32_filesep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_directory_entry_of __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_directory_has_entry __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(list) \
+    , PARROT_ASSERT_ARG(dir) \
+    , PARROT_ASSERT_ARG(entry))
+#define ASSERT_ARGS_directory_mtime __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(dir))
+#define ASSERT_ARGS_get_lookup_list __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(paths) \
+    , PARROT_ASSERT_ARG(prefix))
 #define ASSERT_ARGS_get_search_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_is_abs_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_listings_unchanged __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_path_concat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(l_path) \
@@ -100,6 +177,11 @@ static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_search_runtime_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(file) \
+    , PARROT_ASSERT_ARG(paths) \
+    , PARROT_ASSERT_ARG(prefix))
 #define ASSERT_ARGS_try_bytecode_extensions __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
@@ -573,6 +655,9 @@ try_load_path(PARROT_INTERP, ARGIN(STRING* path))
     path = cnv_to_win32_filesep(interp, path);
 #endif
 
+    if (interp->lib_lookups)
+        ++interp->lib_lookups->n_stats;
+
     if (Parrot_file_stat_intval(interp, path, STAT_EXISTS)) {
         return path;
     }
@@ -683,6 +768,9 @@ Parrot_lib_add_path(PARROT_INTERP,
         IGLOBALS_LIB_PATHS);
     PMC * const paths = VTABLE_get_pmc_keyed_int(interp, lib_paths, which);
     VTABLE_unshift_string(interp, paths, path_str);
+
+    if (interp->lib_lookups && which < PARROT_LIB_DYN_EXTS)
+        clear_lookup_list(interp, &interp->lib_lookups->lists[which]);
 }
 
 /*
@@ -709,6 +797,177 @@ Parrot_lib_add_path_from_cstring(PARROT_INTERP,
 
 /*
 
+=item C<Lib_lookup_cache * Parrot_lib_lookup_cache_create(PARROT_INTERP)>
+
+Creates the cache of located runtime files for an interpreter. With
+C<index_dirs> set, search directories are listed, and listed again only when
+their modification time changes. Files missing from the listing are not
+probed.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Lib_lookup_cache *
+Parrot_lib_lookup_cache_create(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_lib_lookup_cache_create)
+    return mem_gc_allocate_zeroed_typed(interp, Lib_lookup_cache);
+}
+
+/*
+
+=item C<void Parrot_lib_lookup_cache_destroy(PARROT_INTERP, Lib_lookup_cache
+*cache)>
+
+Frees a cache of located runtime files.
+
+=cut
+
+*/
+
+void
+Parrot_lib_lookup_cache_destroy(PARROT_INTERP, ARGFREE(Lib_lookup_cache *cache))
+{
+    ASSERT_ARGS(Parrot_lib_lookup_cache_destroy)
+    int i;
+
+    if (!cache)
+        return;
+
+    for (i = 0; i < PARROT_LIB_DYN_EXTS; ++i)
+        clear_lookup_list(interp, &cache->lists[i]);
+
+    mem_gc_free(interp, cache);
+}
+
+/*
+
+=item C<void Parrot_lib_lookup_cache_mark(PARROT_INTERP, Lib_lookup_cache
+*cache)>
+
+Marks the file names, located paths, directory listings and search paths of
+the cache as alive.
+
+=cut
+
+*/
+
+void
+Parrot_lib_lookup_cache_mark(PARROT_INTERP, ARGIN(Lib_lookup_cache *cache))
+{
+    ASSERT_ARGS(Parrot_lib_lookup_cache_mark)
+    int i;
+
+    for (i = 0; i < PARROT_LIB_DYN_EXTS; ++i) {
+        Lib_lookup_list * const list = &cache->lists[i];
+        INTVAL j;
+
+        if (!list->found)
+            continue;
+
+        Parrot_hash_mark(interp, list->found);
+        Parrot_hash_mark(interp, list->dirs);
+        Parrot_hash_mark(interp, list->dir_times);
+        Parrot_gc_mark_STRING_alive(interp, list->prefix);
+
+        for (j = 0; j < list->n_paths; ++j)
+            Parrot_gc_mark_STRING_alive(interp, list->paths[j]);
+    }
+}
+
+/*
+
+=item C<static void clear_lookup_list(PARROT_INTERP, Lib_lookup_list *list)>
+
+Forgets all files located in, and directories listed for, one search path
+list.
+
+=cut
+
+*/
+
+static void
+clear_lookup_list(PARROT_INTERP, ARGMOD(Lib_lookup_list *list))
+{
+    ASSERT_ARGS(clear_lookup_list)
+
+    if (list->found) {
+        Parrot_hash_destroy(interp, list->found);
+        Parrot_hash_destroy(interp, list->dirs);
+        Parrot_hash_destroy(interp, list->dir_times);
+    }
+    if (list->paths)
+        mem_gc_free(interp, list->paths);
+
+    list->found     = NULL;
+    list->dirs      = NULL;
+    list->dir_times = NULL;
+    list->paths     = NULL;
+    list->n_paths   = 0;
+    list->prefix    = NULL;
+}
+
+/*
+
+=item C<static Lib_lookup_list * get_lookup_list(PARROT_INTERP, enum_lib_paths
+which, PMC *paths, STRING *prefix)>
+
+Returns the files located in the search path list C<which>. C<paths> is
+compared with the search paths the files were located with, so that code
+which edits the list in C<iglobals> directly does not get stale results; the
+cached files are dropped if anything changed.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static Lib_lookup_list *
+get_lookup_list(PARROT_INTERP, enum_lib_paths which, ARGIN(PMC *paths),
+        ARGIN(STRING *prefix))
+{
+    ASSERT_ARGS(get_lookup_list)
+    Lib_lookup_list *list;
+    const INTVAL     n = VTABLE_elements(interp, paths);
+    INTVAL           i;
+    int              valid;
+
+    if (!interp->lib_lookups)
+        return NULL;
+
+    list  = &interp->lib_lookups->lists[which];
+    valid = list->found && list->n_paths == n
+         && STRING_equal(interp, list->prefix, prefix);
+
+    for (i = 0; valid && i < n; ++i)
+        valid = VTABLE_get_string_keyed_int(interp, paths, i) == list->paths[i];
+
+    if (!valid) {
+        clear_lookup_list(interp, list);
+
+        list->found     = Parrot_hash_create(interp,
+                            enum_type_STRING, Hash_key_type_STRING);
+        list->dirs      = Parrot_hash_create(interp,
+                            enum_type_PMC, Hash_key_type_STRING);
+        list->dir_times = Parrot_hash_create(interp,
+                            enum_type_INTVAL, Hash_key_type_STRING);
+        list->paths     = n ? mem_gc_allocate_n_typed(interp, n, STRING *) : NULL;
+        list->n_paths   = n;
+        list->prefix    = prefix;
+
+        for (i = 0; i < n; ++i)
+            list->paths[i] = VTABLE_get_string_keyed_int(interp, paths, i);
+    }
+
+    return list;
+}
+
+/*
+
 =item C<STRING* Parrot_locate_runtime_file_str(PARROT_INTERP, STRING *file,
 enum_runtime_ft type)>
 
@@ -717,6 +976,15 @@ Locate the full path for C<file_name> and the given file type(s).
 The C<enum_runtime_ft type> is one or more of the types defined in
 F<include/parrot/library.h>.
 
+Located files are remembered per search path list, so that loading the same
+library again does not probe every search path and extension again. A
+remembered file is checked to still exist before it is returned.
+
+Files that were not found are only remembered with C<index_dirs> set, where
+the miss is known from the directory listings. Such a miss stands for as long
+as none of the listed directories was modified; the current directory is not
+listed, so it is always probed again.
+
 =cut
 
 */
@@ -729,44 +997,119 @@ Parrot_locate_runtime_file_str(PARROT_INTERP, ARGIN(STRING *file),
         enum_runtime_ft type)
 {
     ASSERT_ARGS(Parrot_locate_runtime_file_str)
-    STRING *prefix;
-    STRING *full_name;
-    PMC    *paths;
-    INTVAL  i, n;
+    STRING   * const not_found = CONST_STRING(interp, "");
+    STRING          *prefix;
+    STRING          *full_name;
+    PMC             *paths;
+    Lib_lookup_list *list;
+    enum_lib_paths   which;
 
     /* if this is an absolute path return it as is */
     if (is_abs_path(interp, file))
         return file;
 
     if (type & PARROT_RUNTIME_FT_LANG)
-        paths = get_search_paths(interp, PARROT_LIB_PATH_LANG);
+        which = PARROT_LIB_PATH_LANG;
     else if (type & PARROT_RUNTIME_FT_DYNEXT)
-        paths = get_search_paths(interp, PARROT_LIB_PATH_DYNEXT);
+        which = PARROT_LIB_PATH_DYNEXT;
     else if (type & (PARROT_RUNTIME_FT_PBC | PARROT_RUNTIME_FT_SOURCE))
-        paths = get_search_paths(interp, PARROT_LIB_PATH_LIBRARY);
+        which = PARROT_LIB_PATH_LIBRARY;
     else
-        paths = get_search_paths(interp, PARROT_LIB_PATH_INCLUDE);
+        which = PARROT_LIB_PATH_INCLUDE;
 
+    paths  = get_search_paths(interp, which);
     prefix = Parrot_get_runtime_path(interp);
-    n = VTABLE_elements(interp, paths);
+
+    /* the dynext paths are only ever searched without trying extensions */
+    list = (which == PARROT_LIB_PATH_DYNEXT) == !!(type & PARROT_RUNTIME_FT_DYNEXT)
+         ? get_lookup_list(interp, which, paths, prefix)
+         : NULL;
+
+    if (list) {
+        full_name = (STRING *)Parrot_hash_get(interp, list->found, file);
+
+        if (full_name && !STRING_IS_EMPTY(full_name)) {
+            if (try_load_path(interp, full_name))
+                return full_name;
+        }
+        else if (full_name && listings_unchanged(interp, list)) {
+            /* the current directory is not listed */
+            full_name =
+                (type & PARROT_RUNTIME_FT_DYNEXT)
+                    ? try_load_path(interp, file)
+                    : try_bytecode_extensions(interp, file);
+
+            if (full_name)
+                Parrot_hash_put(interp, list->found, file, full_name);
+            return full_name;
+        }
+    }
+
+    full_name = search_runtime_paths(interp, file, type, paths, prefix, list);
+
+    if (!list)
+        return full_name;
+
+    if (full_name)
+        Parrot_hash_put(interp, list->found, file, full_name);
+
+    /* remember a file missing from the listings as the empty string */
+    else if (interp->lib_lookups->index_dirs && directory_entry_of(interp, file, type))
+        Parrot_hash_put(interp, list->found, file, not_found);
+
+    return full_name;
+}
+
+/*
+
+=item C<static STRING* search_runtime_paths(PARROT_INTERP, STRING *file,
+enum_runtime_ft type, PMC *paths, STRING *prefix, Lib_lookup_list *list)>
+
+Probes C<file> in each of the search C<paths>, also below the runtime
+C<prefix> for relative paths, and finally as given. With directory listings
+enabled, C<list> holds the listings of the search directories.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING*
+search_runtime_paths(PARROT_INTERP, ARGIN(STRING *file), enum_runtime_ft type,
+        ARGIN(PMC *paths), ARGIN(STRING *prefix), ARGMOD_NULLOK(Lib_lookup_list *list))
+{
+    ASSERT_ARGS(search_runtime_paths)
+    STRING      *full_name;
+    STRING      *entry = NULL;
+    const INTVAL n = VTABLE_elements(interp, paths);
+    INTVAL       i;
+
+    if (list && interp->lib_lookups->index_dirs)
+        entry = directory_entry_of(interp, file, type);
 
     for (i = 0; i < n; ++i) {
         STRING * const path = VTABLE_get_string_keyed_int(interp, paths, i);
-        STRING *found_name;
+        STRING *found_name = NULL;
 
         full_name = path_concat(interp, path, file);
 
-        found_name =
-            (type & PARROT_RUNTIME_FT_DYNEXT)
-                ? try_load_path(interp, full_name)
-                : try_bytecode_extensions(interp, full_name);
+        if (!entry || directory_has_entry(interp, list, path, entry))
+            found_name =
+                (type & PARROT_RUNTIME_FT_DYNEXT)
+                    ? try_load_path(interp, full_name)
+                    : try_bytecode_extensions(interp, full_name);
 
         if (found_name)
             return found_name;
 
-        if (STRING_length(prefix) && !is_abs_path(interp, path)) {
+        if (!STRING_IS_EMPTY(prefix) && !is_abs_path(interp, path)) {
             full_name = path_concat(interp, prefix, full_name);
 
+            if (entry && !directory_has_entry(interp, list,
+                    path_concat(interp, prefix, path), entry))
+                continue;
+
             found_name =
                 (type & PARROT_RUNTIME_FT_DYNEXT)
                     ? try_load_path(interp, full_name)
@@ -787,6 +1130,141 @@ Parrot_locate_runtime_file_str(PARROT_INTERP, ARGIN(STRING *file),
 
 /*
 
+=item C<static STRING * directory_entry_of(PARROT_INTERP, STRING *file,
+enum_runtime_ft type)>
+
+Returns the name that has to be listed in a search directory for C<file> to
+possibly be found in it: the first component of a relative path, or the name
+without its extension, since bytecode lookups also try the other extensions.
+Returns NULL if the directory listings cannot tell.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+directory_entry_of(PARROT_INTERP, ARGIN(STRING *file), enum_runtime_ft type)
+{
+    ASSERT_ARGS(directory_entry_of)
+    INTVAL slash, dot;
+
+    if (STRING_index(interp, file, CONST_STRING(interp, "\\"), 0) >= 0)
+        return NULL;
+
+    slash = STRING_index(interp, file, CONST_STRING(interp, "/"), 0);
+    if (slash == 0)
+        return NULL;
+    if (slash > 0)
+        return STRING_substr(interp, file, 0, slash);
+    if (type & PARROT_RUNTIME_FT_DYNEXT)
+        return file;
+
+    dot = STRING_rindex(interp, file, CONST_STRING(interp, "."), STRING_length(file));
+    return dot > 0 ? STRING_substr(interp, file, 0, dot) : file;
+}
+
+/*
+
+=item C<static INTVAL directory_has_entry(PARROT_INTERP, Lib_lookup_list *list,
+STRING *dir, STRING *entry)>
+
+Tells whether the search directory C<dir> has a file or subdirectory called
+C<entry>, with or without an extension. The directory is listed the first
+time it is asked about, and again once it was modified; a directory that does
+not exist has no entries.
+
+=cut
+
+*/
+
+static INTVAL
+directory_has_entry(PARROT_INTERP, ARGMOD(Lib_lookup_list *list),
+        ARGIN(STRING *dir), ARGIN(STRING *entry))
+{
+    ASSERT_ARGS(directory_has_entry)
+    PMC         *entries = (PMC *)Parrot_hash_get(interp, list->dirs, dir);
+    const INTVAL mtime   = directory_mtime(interp, dir);
+
+    if (!entries || (INTVAL)Parrot_hash_get(interp, list->dir_times, dir) != mtime) {
+        entries = Parrot_pmc_new(interp, enum_class_Hash);
+
+        if (mtime) {
+            PMC * const names = Parrot_file_readdir(interp, dir);
+            STRING * const dot = CONST_STRING(interp, ".");
+            const INTVAL n = VTABLE_elements(interp, names);
+            INTVAL i;
+
+            ++interp->lib_lookups->n_readdirs;
+
+            for (i = 0; i < n; ++i) {
+                STRING * const name = VTABLE_get_string_keyed_int(interp, names, i);
+                const INTVAL   ext  = STRING_rindex(interp, name, dot, STRING_length(name));
+
+                VTABLE_set_integer_keyed_str(interp, entries, name, 1);
+                if (ext > 0)
+                    VTABLE_set_integer_keyed_str(interp, entries,
+                            STRING_substr(interp, name, 0, ext), 1);
+            }
+        }
+
+        Parrot_hash_put(interp, list->dirs, dir, entries);
+
+        /* files created later in the same second would not change the
+           mtime, so such a listing is never trusted */
+        Parrot_hash_put(interp, list->dir_times, dir,
+                (void *)(mtime < Parrot_intval_time() ? mtime : -1));
+    }
+
+    return VTABLE_exists_keyed_str(interp, entries, entry);
+}
+
+/*
+
+=item C<static INTVAL directory_mtime(PARROT_INTERP, STRING *dir)>
+
+Returns the modification time of the directory C<dir>, or 0 if there is no
+such directory.
+
+=item C<static INTVAL listings_unchanged(PARROT_INTERP, Lib_lookup_list *list)>
+
+Tells whether none of the directories listed for C<list> was modified since.
+
+=cut
+
+*/
+
+static INTVAL
+directory_mtime(PARROT_INTERP, ARGIN(STRING *dir))
+{
+    ASSERT_ARGS(directory_mtime)
+
+    ++interp->lib_lookups->n_stats;
+
+    if (Parrot_file_stat_intval(interp, dir, STAT_EXISTS)
+    &&  Parrot_file_stat_intval(interp, dir, STAT_ISDIR))
+        return Parrot_file_stat_intval(interp, dir, STAT_MODIFYTIME);
+
+    return 0;
+}
+
+static INTVAL
+listings_unchanged(PARROT_INTERP, ARGIN(Lib_lookup_list *list))
+{
+    ASSERT_ARGS(listings_unchanged)
+    INTVAL unchanged = 1;
+
+    parrot_hash_iterate(list->dir_times,
+        if (unchanged
+        &&  directory_mtime(interp, (STRING *)_bucket->key) != (INTVAL)_bucket->value)
+            unchanged = 0;);
+
+    return unchanged;
+}
+
+/*
+
 =item C<char* Parrot_locate_runtime_file(PARROT_INTERP, const char *file_name,
 enum_runtime_ft type)>
 
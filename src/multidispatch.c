@@ -83,22 +83,80 @@ static PMC* mmd_build_type_tuple_from_type_list(PARROT_INTERP,
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_types(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *types))
+static MMD_Cache_entry * mmd_cache_find(
+    ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL arity,
+    UINTVAL hashval)
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_PURE_FUNCTION
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_values(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *values))
+static UINTVAL mmd_cache_hash(
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL arity)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * mmd_cache_lookup(
+    ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL arity)
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void mmd_cache_store(
+    ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL arity,
+    ARGIN(PMC *chosen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*cache);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_types(PARROT_INTERP,
+    ARGIN(PMC *type_pmc),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_values(PARROT_INTERP,
+    ARGIN(PMC *values),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_varargs(PARROT_INTERP,
+    ARGIN(const char *sig),
+    ARGMOD(va_list *args),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*args)
+        FUNC_MODIFIES(*types);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static PMC * mmd_cached_type_tuple(PARROT_INTERP, ARGIN(STRING *long_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* mmd_cvt_to_types(PARROT_INTERP, ARGIN(PMC *multi_sig))
@@ -112,6 +170,13 @@ static UINTVAL mmd_distance(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * mmd_long_sig_namespace(PARROT_INTERP,
+    ARGIN(STRING *long_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void mmd_search_by_sig_obj(PARROT_INTERP,
     ARGIN(STRING *name),
     ARGIN(PMC *sig_obj),
@@ -167,14 +232,34 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(type_list))
-#define ASSERT_ARGS_mmd_cache_key_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_find __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_lookup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(chosen))
+#define ASSERT_ARGS_mmd_cache_types_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(type_pmc) \
     , PARROT_ASSERT_ARG(types))
-#define ASSERT_ARGS_mmd_cache_key_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_types_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(values))
+    , PARROT_ASSERT_ARG(values) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_types_from_varargs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sig) \
+    , PARROT_ASSERT_ARG(args) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cached_type_tuple __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(long_sig))
 #define ASSERT_ARGS_mmd_cvt_to_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(multi_sig))
@@ -182,6 +267,9 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc) \
     , PARROT_ASSERT_ARG(arg_tuple))
+#define ASSERT_ARGS_mmd_long_sig_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(long_sig))
 #define ASSERT_ARGS_mmd_search_by_sig_obj __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
@@ -265,23 +353,35 @@ Parrot_mmd_multi_dispatch_from_c_args(PARROT_INTERP,
     PMC *call_obj, *sub;
     va_list args;
     const char *arg_sig, *ret_sig;
+    INTVAL types[MMD_CACHE_MAX_ARITY];
+    INTVAL arity;
 
     Parrot_pcc_split_signature_string(sig, &arg_sig, &ret_sig);
 
+    /* Check the cache, with the type ids read straight from the arguments */
+    va_start(args, sig);
+    arity = mmd_cache_types_from_varargs(interp, arg_sig, &args, types);
+    va_end(args);
+
     va_start(args, sig);
     call_obj = Parrot_pcc_build_call_from_varargs(interp, PMCNULL, arg_sig, &args);
 
-    /* Check the cache. */
-    sub = Parrot_mmd_cache_lookup_by_types(interp, interp->op_mmd_cache, name,
+    sub = arity >= 0
+        ? mmd_cache_lookup(interp->op_mmd_cache, name, types, arity)
+        : Parrot_mmd_cache_lookup_by_types(interp, interp->op_mmd_cache, name,
             VTABLE_get_pmc(interp, call_obj));
 
     if (PMC_IS_NULL(sub)) {
         sub = Parrot_mmd_find_multi_from_sig_obj(interp,
             Parrot_str_new_constant(interp, name), call_obj);
 
-        if (!PMC_IS_NULL(sub))
-            Parrot_mmd_cache_store_by_types(interp, interp->op_mmd_cache, name,
-                    VTABLE_get_pmc(interp, call_obj), sub);
+        if (!PMC_IS_NULL(sub)) {
+            if (arity >= 0)
+                mmd_cache_store(interp->op_mmd_cache, name, types, arity, sub);
+            else
+                Parrot_mmd_cache_store_by_types(interp, interp->op_mmd_cache, name,
+                        VTABLE_get_pmc(interp, call_obj), sub);
+        }
     }
 
     if (PMC_IS_NULL(sub))
@@ -438,6 +538,73 @@ mmd_build_type_tuple_from_long_sig(PARROT_INTERP, ARGIN(STRING *long_sig))
 
 /*
 
+=item C<static PMC * mmd_cached_type_tuple(PARROT_INTERP, STRING *long_sig)>
+
+Return the type tuple for a comma-delimited C<long_sig> of a multi registered
+from C. The core PMCs register the same few dozen signatures over and over
+while the interpreter starts up, so tuples are kept in
+C<interp-E<gt>mmd_type_tuples> and shared between all multis with the same
+signature; the dispatcher never modifies them. A tuple naming a type that is
+not registered yet is built but not kept, so that it gets resolved again once
+the type exists.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static PMC *
+mmd_cached_type_tuple(PARROT_INTERP, ARGIN(STRING *long_sig))
+{
+    ASSERT_ARGS(mmd_cached_type_tuple)
+    PMC   *multi_sig;
+    INTVAL i, param_count;
+
+    if (!interp->mmd_type_tuples)
+        interp->mmd_type_tuples = Parrot_hash_create(interp,
+                enum_type_PMC, Hash_key_type_STRING);
+    else {
+        multi_sig = (PMC *)Parrot_hash_get(interp, interp->mmd_type_tuples, long_sig);
+        if (multi_sig)
+            return multi_sig;
+    }
+
+    multi_sig   = mmd_build_type_tuple_from_long_sig(interp, long_sig);
+    param_count = VTABLE_elements(interp, multi_sig);
+
+    for (i = 0; i < param_count; ++i)
+        if (VTABLE_get_integer_keyed_int(interp, multi_sig, i) == enum_type_undef)
+            return multi_sig;
+
+    Parrot_hash_put(interp, interp->mmd_type_tuples, long_sig, multi_sig);
+    return multi_sig;
+}
+
+/*
+
+=item C<static STRING * mmd_long_sig_namespace(PARROT_INTERP, STRING *long_sig)>
+
+Return the first type name of C<long_sig>, which names the namespace the multi
+gets stored in.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+mmd_long_sig_namespace(PARROT_INTERP, ARGIN(STRING *long_sig))
+{
+    ASSERT_ARGS(mmd_long_sig_namespace)
+    const INTVAL comma = STRING_index(interp, long_sig, CONST_STRING(interp, ","), 0);
+
+    return comma < 0 ? long_sig : STRING_substr(interp, long_sig, 0, comma);
+}
+
+/*
+
 =item C<PMC* Parrot_mmd_build_type_tuple_from_sig_obj(PARROT_INTERP, PMC
 *sig_obj)>
 
@@ -959,11 +1126,10 @@ Parrot_mmd_add_multi_from_long_sig(PARROT_INTERP,
     ASSERT_ARGS(Parrot_mmd_add_multi_from_long_sig)
     Parrot_Sub_attributes *sub;
     STRING     *sub_str     = CONST_STRING(interp, "Sub");
-    PMC        *type_list   = Parrot_str_split(interp, CONST_STRING(interp, ","), long_sig);
-    STRING     *ns_name     = VTABLE_get_string_keyed_int(interp, type_list, 0);
+    STRING     *ns_name     = mmd_long_sig_namespace(interp, long_sig);
 
     /* Attach a type tuple array to the sub for multi dispatch */
-    PMC    *multi_sig = mmd_build_type_tuple_from_type_list(interp, type_list);
+    PMC    *multi_sig = mmd_cached_type_tuple(interp, long_sig);
 
     PARROT_GC_WRITE_BARRIER(interp, sub_obj);
 
@@ -1002,17 +1168,14 @@ Parrot_mmd_add_multi_from_c_args(PARROT_INTERP,
         ARGIN(const char *long_sig), ARGIN(funcptr_t multi_func_ptr))
 {
     ASSERT_ARGS(Parrot_mmd_add_multi_from_c_args)
-    STRING *comma         = CONST_STRING(interp, ",");
     STRING *sub_name_str  = Parrot_str_new_constant(interp, sub_name);
     STRING *long_sig_str  = Parrot_str_new_constant(interp, long_sig);
     STRING *short_sig_str = Parrot_str_new_constant(interp, short_sig);
-    PMC    *type_list     = Parrot_str_split(interp, comma, long_sig_str);
-    STRING *ns_name       = VTABLE_get_string_keyed_int(interp, type_list, 0);
+    STRING *ns_name       = mmd_long_sig_namespace(interp, long_sig_str);
 
     /* Create an NCI sub for the C function */
     PMC    *sub_obj       = Parrot_pmc_new(interp, enum_class_NCI);
-    PMC    *multi_sig     = mmd_build_type_tuple_from_long_sig(interp,
-                                long_sig_str);
+    PMC    *multi_sig     = mmd_cached_type_tuple(interp, long_sig_str);
 
     PARROT_GC_WRITE_BARRIER(interp, sub_obj);
 
@@ -1080,6 +1243,10 @@ Parrot_mmd_add_multi_list_from_c_args(PARROT_INTERP,
 
 Creates and returns a new MMD cache.
 
+The cache is a small set-associative table keyed on the name of the multi and
+the packed type ids of the arguments.  A lookup only hashes and compares those,
+so a hit allocates nothing.
+
 =cut
 
 */
@@ -1090,17 +1257,75 @@ MMD_Cache *
 Parrot_mmd_cache_create(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_mmd_cache_create)
-    /* String hash. */
-    PMC *cache = Parrot_pmc_new(interp, enum_class_Hash);
-    return cache;
+    return mem_gc_allocate_zeroed_typed(interp, MMD_Cache);
+}
+
+/*
+
+=item C<void Parrot_mmd_cache_destroy(PARROT_INTERP, MMD_Cache *cache)>
+
+Frees an MMD cache and the names it holds.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_cache_destroy(PARROT_INTERP, ARGFREE(MMD_Cache *cache))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_destroy)
+    INTVAL set, way;
+
+    if (!cache)
+        return;
+
+    for (set = 0; set < MMD_CACHE_SETS; ++set)
+        for (way = 0; way < MMD_CACHE_WAYS; ++way)
+            if (cache->entries[set][way].name)
+                mem_sys_free(cache->entries[set][way].name);
+
+    mem_gc_free(interp, cache);
 }
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_values(PARROT_INTERP, const char
-*name, PMC *values)>
+=item C<static UINTVAL mmd_cache_hash(const char *name, const INTVAL *types,
+INTVAL arity)>
 
-Generates an MMD cache key from an array of values.
+Hashes the name of a multi together with the type ids of its arguments.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL
+mmd_cache_hash(ARGIN_NULLOK(const char *name), ARGIN(const INTVAL *types),
+    INTVAL arity)
+{
+    ASSERT_ARGS(mmd_cache_hash)
+    UINTVAL hashval = 5381;
+    INTVAL  i;
+
+    if (name)
+        while (*name)
+            hashval = hashval * 33 + (unsigned char)*name++;
+
+    for (i = 0; i < arity; ++i)
+        hashval = (hashval ^ (UINTVAL)types[i]) * 0x9E3779B1;
+
+    return hashval ^ (hashval >> 16);
+}
+
+/*
+
+=item C<static MMD_Cache_entry * mmd_cache_find(MMD_Cache *cache, const char
+*name, const INTVAL *types, INTVAL arity, UINTVAL hashval)>
+
+Returns the entry of C<cache> for C<name> and C<types>, or NULL if there is
+none.
 
 =cut
 
@@ -1108,38 +1333,235 @@ Generates an MMD cache key from an array of values.
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_values(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *values))
+static MMD_Cache_entry *
+mmd_cache_find(ARGIN(MMD_Cache *cache), ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types), INTVAL arity, UINTVAL hashval)
 {
-    ASSERT_ARGS(mmd_cache_key_from_values)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
+    ASSERT_ARGS(mmd_cache_find)
+    MMD_Cache_entry * const set = cache->entries[hashval & (MMD_CACHE_SETS - 1)];
+    INTVAL way;
+
+    for (way = 0; way < MMD_CACHE_WAYS; ++way) {
+        MMD_Cache_entry * const entry = &set[way];
+
+        if (entry->chosen
+        &&  entry->hashval == hashval
+        &&  entry->arity   == arity
+        &&  memcmp(entry->types, types, arity * sizeof (INTVAL)) == 0
+        &&  (entry->name && name
+                ? strcmp(entry->name, name) == 0
+                : entry->name == name))
+            return entry;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static PMC * mmd_cache_lookup(MMD_Cache *cache, const char *name, const
+INTVAL *types, INTVAL arity)>
+
+Looks up the candidate cached for C<name> and the C<arity> type ids in
+C<types>.  Returns PMCNULL on a miss.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+mmd_cache_lookup(ARGIN(MMD_Cache *cache), ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types), INTVAL arity)
+{
+    ASSERT_ARGS(mmd_cache_lookup)
+    const MMD_Cache_entry * const entry = mmd_cache_find(cache, name, types,
+            arity, mmd_cache_hash(name, types, arity));
+
+    return entry ? entry->chosen : PMCNULL;
+}
+
+/*
+
+=item C<static void mmd_cache_store(MMD_Cache *cache, const char *name, const
+INTVAL *types, INTVAL arity, PMC *chosen)>
+
+Caches C<chosen> as the candidate for C<name> and the C<arity> type ids in
+C<types>.  When its set is full, one of the older entries is replaced.
+
+=cut
+
+*/
+
+static void
+mmd_cache_store(ARGMOD(MMD_Cache *cache), ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types), INTVAL arity, ARGIN(PMC *chosen))
+{
+    ASSERT_ARGS(mmd_cache_store)
+    const UINTVAL    hashval = mmd_cache_hash(name, types, arity);
+    MMD_Cache_entry *entry   = mmd_cache_find(cache, name, types, arity, hashval);
+
+    if (!entry) {
+        MMD_Cache_entry * const set = cache->entries[hashval & (MMD_CACHE_SETS - 1)];
+        INTVAL way;
+
+        for (way = 0; way < MMD_CACHE_WAYS; ++way)
+            if (!set[way].chosen)
+                break;
+
+        if (way == MMD_CACHE_WAYS)
+            way = cache->next_way++ % MMD_CACHE_WAYS;
+
+        entry = &set[way];
+
+        if (entry->name)
+            mem_sys_free(entry->name);
+
+        entry->name    = name ? mem_sys_strdup(name) : NULL;
+        entry->hashval = hashval;
+        entry->arity   = arity;
+        memcpy(entry->types, types, arity * sizeof (INTVAL));
+    }
+
+    entry->chosen = chosen;
+}
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_values(PARROT_INTERP, PMC *values,
+INTVAL *types)>
+
+Fills C<types> with the type ids of an array of values.  Returns their number,
+or -1 if the tuple can't be cached.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_types_from_values(PARROT_INTERP, ARGIN(PMC *values),
+    ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_types_from_values)
     const INTVAL num_values = VTABLE_elements(interp, values);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_values * sizeof (INTVAL) + name_len;
-    INTVAL *type_ids        = mem_gc_allocate_n_typed(interp, num_values + name_len, INTVAL);
-    STRING *key;
-    INTVAL  i;
+    INTVAL       i;
+
+    if (num_values > MMD_CACHE_MAX_ARITY)
+        return -1;
 
     for (i = 0; i < num_values; ++i) {
         const INTVAL id = VTABLE_type(interp, VTABLE_get_pmc_keyed_int(interp, values, i));
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
 
-        type_ids[i] = id;
+        if (id == 0)
+            return -1;
+
+        types[i] = id;
     }
 
-    if (name)
-        strcpy((char *)(type_ids + num_values), name);
+    return num_values;
+}
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_types(PARROT_INTERP, PMC *type_pmc,
+INTVAL *types)>
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
-    mem_gc_free(interp, type_ids);
+Fills C<types> from an array of type ids.  Returns their number, or -1 if the
+tuple can't be cached.
 
-    return key;
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_types_from_types(PARROT_INTERP, ARGIN(PMC *type_pmc),
+    ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_types_from_types)
+    const INTVAL num_types = VTABLE_elements(interp, type_pmc);
+    INTVAL       i;
+
+    if (num_types > MMD_CACHE_MAX_ARITY)
+        return -1;
+
+    for (i = 0; i < num_types; ++i) {
+        const INTVAL id = VTABLE_get_integer_keyed_int(interp, type_pmc, i);
+
+        if (id == 0)
+            return -1;
+
+        types[i] = id;
+    }
+
+    return num_types;
+}
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_varargs(PARROT_INTERP, const char
+*sig, va_list *args, INTVAL *types)>
+
+Fills C<types> with the type ids of the C arguments described by C<sig>, the
+same ids a CallContext built from them would give as its type tuple.  Returns
+their number, or -1 if the tuple can't be cached, for example because an
+argument gets flattened.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_types_from_varargs(PARROT_INTERP, ARGIN(const char *sig),
+    ARGMOD(va_list *args), ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_types_from_varargs)
+    INTVAL arity = 0;
+
+    for (; *sig != '\0' && *sig != '-'; ++sig) {
+        INTVAL id;
+
+        switch (*sig) {
+          case 'I':
+            (void)va_arg(*args, INTVAL);
+            id = -enum_type_INTVAL;
+            break;
+          case 'N':
+            (void)va_arg(*args, FLOATVAL);
+            id = -enum_type_FLOATVAL;
+            break;
+          case 'S':
+            (void)va_arg(*args, STRING *);
+            id = -enum_type_STRING;
+            break;
+          case 'P':
+            {
+                PMC * const pmc_arg = va_arg(*args, PMC *);
+
+                if (sig[1] == 'f')
+                    return -1;
+                if (sig[1] == 'i')
+                    ++sig;
+
+                id = PMC_IS_NULL(pmc_arg)
+                   ? (INTVAL)-enum_type_PMC
+                   : VTABLE_type(interp, pmc_arg);
+                break;
+            }
+          default:
+            return -1;
+        }
+
+        if (id == 0 || arity == MMD_CACHE_MAX_ARITY)
+            return -1;
+
+        types[arity++] = id;
+    }
+
+    return arity;
 }
 
 /*
@@ -1161,10 +1583,11 @@ Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *values))
 {
     ASSERT_ARGS(Parrot_mmd_cache_lookup_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    INTVAL       types[MMD_CACHE_MAX_ARITY];
+    const INTVAL arity = mmd_cache_types_from_values(interp, values, types);
 
-    if (key)
-        return VTABLE_get_pmc_keyed_str(interp, cache, key);
+    if (arity >= 0)
+        return mmd_cache_lookup(cache, name, types, arity);
 
     return PMCNULL;
 }
@@ -1187,59 +1610,11 @@ Parrot_mmd_cache_store_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *values), ARGIN(PMC *chosen))
 {
     ASSERT_ARGS(Parrot_mmd_cache_store_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    INTVAL       types[MMD_CACHE_MAX_ARITY];
+    const INTVAL arity = mmd_cache_types_from_values(interp, values, types);
 
-    if (key)
-        VTABLE_set_pmc_keyed_str(interp, cache, key, chosen);
-}
-
-/*
-
-=item C<static STRING * mmd_cache_key_from_types(PARROT_INTERP, const char
-*name, PMC *types)>
-
-Generates an MMD cache key from an array of types.
-
-=cut
-
-*/
-
-PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_types(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *types))
-{
-    ASSERT_ARGS(mmd_cache_key_from_types)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
-    const INTVAL num_types  = VTABLE_elements(interp, types);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_types * sizeof (INTVAL) + name_len;
-    INTVAL * const type_ids = mem_gc_allocate_n_typed(interp, num_types + name_len, INTVAL);
-
-    STRING *key;
-    INTVAL  i;
-
-    for (i = 0; i < num_types; ++i) {
-        const INTVAL id = VTABLE_get_integer_keyed_int(interp, types, i);
-
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
-
-        type_ids[i] = id;
-    }
-
-    if (name)
-        strcpy((char *)(type_ids + num_types), name);
-
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
-
-    mem_gc_free(interp, type_ids);
-    return key;
+    if (arity >= 0)
+        mmd_cache_store(cache, name, types, arity, chosen);
 }
 
 /*
@@ -1261,10 +1636,11 @@ Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *types))
 {
     ASSERT_ARGS(Parrot_mmd_cache_lookup_by_types)
-    STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    INTVAL       type_ids[MMD_CACHE_MAX_ARITY];
+    const INTVAL arity = mmd_cache_types_from_types(interp, types, type_ids);
 
-    if (key)
-        return VTABLE_get_pmc_keyed_str(interp, cache, key);
+    if (arity >= 0)
+        return mmd_cache_lookup(cache, name, type_ids, arity);
 
     return PMCNULL;
 }
@@ -1288,17 +1664,18 @@ Parrot_mmd_cache_store_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
     ARGIN(const char *name), ARGIN(PMC *types), ARGIN(PMC *chosen))
 {
     ASSERT_ARGS(Parrot_mmd_cache_store_by_types)
-    STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    INTVAL       type_ids[MMD_CACHE_MAX_ARITY];
+    const INTVAL arity = mmd_cache_types_from_types(interp, types, type_ids);
 
-    if (key)
-        VTABLE_set_pmc_keyed_str(interp, cache, key, chosen);
+    if (arity >= 0)
+        mmd_cache_store(cache, name, type_ids, arity, chosen);
 }
 
 /*
 
 =item C<void Parrot_mmd_cache_mark(PARROT_INTERP, MMD_Cache *cache)>
 
-GC-marks an MMD cache.
+GC-marks the candidates held by an MMD cache.
 
 =cut
 
@@ -1309,10 +1686,12 @@ void
 Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 {
     ASSERT_ARGS(Parrot_mmd_cache_mark)
-    /* As a small future optimization, note that we only *really* need to mark
-    * keys - the candidates will be referenced outside the cache, provided it's
-    * invalidated properly. */
-    Parrot_gc_mark_PMC_alive(interp, cache);
+    INTVAL set, way;
+
+    for (set = 0; set < MMD_CACHE_SETS; ++set)
+        for (way = 0; way < MMD_CACHE_WAYS; ++way)
+            if (cache->entries[set][way].chosen)
+                Parrot_gc_mark_PMC_alive(interp, cache->entries[set][way].chosen);
 }
 
 /*
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2007-2011, Parrot Foundation.
+Copyright (C) 2007-2015, Parrot Foundation.
 
 =head1 NAME
 
@@ -55,6 +55,13 @@ PARROT_WARN_UNUSED_RESULT
 static PMC * get_pmc_proxy(PARROT_INTERP, INTVAL type)
         __attribute__nonnull__(1);
 
+static void grow_object_cache(PARROT_INTERP,
+    ARGMOD(Caches *mc),
+    UINTVAL type)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*mc);
+
 static void invalidate_all_caches(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -73,6 +80,9 @@ static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
     , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_get_pmc_proxy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_grow_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mc))
 #define ASSERT_ARGS_invalidate_all_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_type_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -738,15 +748,20 @@ Parrot_oo_register_type(PARROT_INTERP, ARGIN(PMC *name), ARGIN(PMC *_namespace))
 
 Marks all PMCs in the object method cache as live.  This shouldn't strictly be
 necessary, as they're likely all reachable from namespaces and classes, but
-it's unlikely to hurt anything except mark phase performance.
+it's unlikely to hurt anything except mark phase performance.  The method names
+are not marked, see C<Parrot_find_method_with_cache>.
 
 =cut
 
 */
 
-#define TBL_SIZE_MASK 0x1ff   /* x bits 2..10 */
+#define TBL_SIZE_MASK 0x1ff   /* low bits of the hash of the name */
 #define TBL_SIZE (1 + TBL_SIZE_MASK)
 
+/* Call sites share the inline caches by their address */
+#define IC_SIZE_MASK 0x3ff
+#define IC_SIZE (1 + IC_SIZE_MASK)
+
 void
 mark_object_cache(PARROT_INTERP)
 {
@@ -769,6 +784,20 @@ mark_object_cache(PARROT_INTERP)
             }
         }
     }
+
+    if (!mc->sites)
+        return;
+
+    for (entry = 0; entry < IC_SIZE; ++entry) {
+        Meth_inline_cache * const ic = &mc->sites[entry];
+        UINTVAL way;
+
+        Parrot_gc_mark_STRING_alive(interp, ic->name);
+        for (way = 0; way < METH_IC_WAYS; ++way) {
+            Parrot_gc_mark_PMC_alive(interp, ic->ways[way]._class);
+            Parrot_gc_mark_PMC_alive(interp, ic->ways[way].method);
+        }
+    }
 }
 
 
@@ -787,7 +816,9 @@ init_object_cache(PARROT_INTERP)
 {
     ASSERT_ARGS(init_object_cache)
     Caches * const mc = interp->caches = mem_gc_allocate_zeroed_typed(interp, Caches);
-    mc->idx = NULL;
+    mc->idx    = NULL;
+    mc->epochs = NULL;
+    mc->sites  = NULL;
 }
 
 
@@ -816,7 +847,42 @@ destroy_object_cache(PARROT_INTERP)
     }
 
     mem_gc_free(interp, mc->idx);
+    mem_gc_free(interp, mc->epochs);
+    mem_gc_free(interp, mc->sites);
     mem_gc_free(interp, mc);
+    interp->caches = NULL;
+}
+
+
+/*
+
+=item C<static void grow_object_cache(PARROT_INTERP, Caches *mc, UINTVAL type)>
+
+Makes room in the object cache for the types up to C<type>.
+
+=cut
+
+*/
+
+static void
+grow_object_cache(PARROT_INTERP, ARGMOD(Caches *mc), UINTVAL type)
+{
+    ASSERT_ARGS(grow_object_cache)
+
+    if (mc->idx) {
+        mc->idx    = mem_gc_realloc_n_typed_zeroed(interp, mc->idx,
+                type + 1, mc->mc_size, Meth_cache_entry **);
+        mc->epochs = mem_gc_realloc_n_typed_zeroed(interp, mc->epochs,
+                type + 1, mc->mc_size, UINTVAL);
+    }
+    else {
+        mc->idx    = mem_gc_allocate_n_zeroed_typed(interp, type + 1,
+                Meth_cache_entry **);
+        mc->epochs = mem_gc_allocate_n_zeroed_typed(interp, type + 1,
+                UINTVAL);
+    }
+
+    mc->mc_size = type + 1;
 }
 
 
@@ -824,8 +890,7 @@ destroy_object_cache(PARROT_INTERP)
 
 =item C<static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)>
 
-Invalidate the cache of the specified type. Free each entry and then free
-the entire cache.
+Free each entry of the cache of the specified type and then the entire cache.
 
 =cut
 
@@ -863,8 +928,7 @@ invalidate_type_caches(PARROT_INTERP, UINTVAL type)
 
 =item C<static void invalidate_all_caches(PARROT_INTERP)>
 
-Invalidate all caches by looping over each cache and calling
-C<invalidate_type_caches> on them.
+Invalidate all caches by bumping the method epoch of every type.
 
 =cut
 
@@ -874,9 +938,11 @@ static void
 invalidate_all_caches(PARROT_INTERP)
 {
     ASSERT_ARGS(invalidate_all_caches)
-    int i;
-    for (i = 1; i < interp->n_vtable_max; ++i)
-        invalidate_type_caches(interp, i);
+    Caches * const mc = interp->caches;
+    UINTVAL i;
+
+    for (i = 0; i < mc->mc_size; ++i)
+        ++mc->epochs[i];
 }
 
 
@@ -916,7 +982,71 @@ Parrot_invalidate_method_cache(PARROT_INTERP, ARGIN_NULLOK(STRING *_class))
     if (type == 0)
         invalidate_all_caches(interp);
     else if (type > 0)
-        invalidate_type_caches(interp, (UINTVAL)type);
+        Parrot_invalidate_method_cache_type(interp, type);
+}
+
+/*
+
+=item C<void Parrot_invalidate_method_cache_type(PARROT_INTERP, INTVAL type)>
+
+Clear method cache for the type numbered C<type>, by bumping its method epoch.
+The cached methods of other types stay.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_invalidate_method_cache_type(PARROT_INTERP, INTVAL type)
+{
+    ASSERT_ARGS(Parrot_invalidate_method_cache_type)
+    Caches * const mc = interp->caches;
+
+    if (mc && type >= 0 && (UINTVAL)type < mc->mc_size)
+        ++mc->epochs[type];
+}
+
+/*
+
+=item C<void Parrot_forget_method_name(PARROT_INTERP, STRING *name)>
+
+Drops the method cache entries keyed on the interned STRING C<name>.  Called
+by the GC when it frees C<name>, as the cache does not keep its names alive.
+
+=cut
+
+*/
+
+void
+Parrot_forget_method_name(PARROT_INTERP, ARGIN(STRING *name))
+{
+    ASSERT_ARGS(Parrot_forget_method_name)
+    Caches * const mc   = interp->caches;
+    const UINTVAL  bits = name->hashval & TBL_SIZE_MASK;
+    UINTVAL        type;
+
+    if (!mc || !mc->n_freeable_names)
+        return;
+
+    for (type = 0; type < mc->mc_size; ++type) {
+        Meth_cache_entry **prev;
+
+        if (!mc->idx[type])
+            continue;
+
+        for (prev = &mc->idx[type][bits]; *prev;) {
+            Meth_cache_entry * const e = *prev;
+
+            if (e->name == name) {
+                *prev = e->next;
+                mem_gc_free(interp, e);
+                --mc->n_freeable_names;
+            }
+            else
+                prev = &e->next;
+        }
+    }
 }
 
 /*
@@ -1032,10 +1162,16 @@ Parrot_find_method_direct(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *metho
 Find a method PMC for a named method, given the class PMC, current
 interp, and name of the method.
 
-This routine should use the current scope's method cache, if there is
-one. If not, it creates a new method cache. Or, rather, it will when
-we've got that bit working. For now it unconditionally goes and looks
-up the name in the global stash.
+The cache is keyed on the type of the class and the method name, so names
+built at runtime hit it as well as constant ones.  Entries looked up before
+the last change to the methods of the type are looked up again.
+
+Only constant and interned names get an entry of their own; others are looked
+up directly unless an equal name has one.  The cache does not keep its names
+alive, so the intern table stays weak: an interned name's entries are dropped
+when the GC frees it, see C<Parrot_forget_method_name>.  This bounds the
+cache by the names the program holds on to, not by every name it ever
+looked up.
 
 =cut
 
@@ -1055,25 +1191,17 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 
     Caches           *mc;
     Meth_cache_entry *e;
-    UINTVAL type, bits;
-
-    if (! PObj_constant_TEST(method_name))
-        return Parrot_find_method_direct(interp, _class, method_name);
+    UINTVAL type, bits, epoch;
+    const size_t hash = method_name->hashval
+                      ? method_name->hashval
+                      : Parrot_str_to_hashval(interp, method_name);
 
     mc   = interp->caches;
     type = _class->vtable->base_type;
-    bits = (((UINTVAL) Buffer_bufstart(method_name)) >> 2) & TBL_SIZE_MASK;
+    bits = hash & TBL_SIZE_MASK;
 
-    if (type >= mc->mc_size) {
-        if (mc->idx)
-            mc->idx = mem_gc_realloc_n_typed_zeroed(interp, mc->idx,
-                    type + 1, mc->mc_size, Meth_cache_entry **);
-        else
-            mc->idx = mem_gc_allocate_n_zeroed_typed(interp, type + 1,
-                        Meth_cache_entry **);
-
-        mc->mc_size = type + 1;
-    }
+    if (type >= mc->mc_size)
+        grow_object_cache(interp, mc, type);
 
     if (! mc->idx[type])
         mc->idx[type] = mem_gc_allocate_n_zeroed_typed(interp,
@@ -1081,20 +1209,35 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 
     e = mc->idx[type][bits];
 
-    while (e && e->strstart != Buffer_bufstart(method_name))
+    while (e && e->name != method_name
+    && (e->name->hashval != hash || !STRING_equal(interp, e->name, method_name)))
         e = e->next;
 
     if (!e) {
+        const int interned = PObj_interned_TEST(method_name)
+                          && !PObj_constant_TEST(method_name);
+
+        /* a name that may die unnoticed can't be a key */
+        if (!interned && !PObj_constant_TEST(method_name))
+            return Parrot_find_method_direct(interp, _class, method_name);
+
         /* when here no or no correct entry was at [bits] */
         /* Use zeroed allocation because find_method_direct can trigger GC */
         e = mem_gc_allocate_zeroed_typed(interp, Meth_cache_entry);
 
+        e->name = method_name;
+        e->next = mc->idx[type][bits];
         mc->idx[type][bits] = e;
 
-        e->pmc      = Parrot_find_method_direct(interp, _class, method_name);
-        e->next     = NULL;
-        e->strstart = Buffer_bufstart(method_name);
+        if (interned)
+            ++mc->n_freeable_names;
     }
+    else if (e->epoch == mc->epochs[type])
+        return e->pmc;
+
+    epoch    = mc->epochs[type];
+    e->pmc   = Parrot_find_method_direct(interp, _class, method_name);
+    e->epoch = epoch;
 
     return e->pmc;
 
@@ -1102,6 +1245,102 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 }
 
 
+/*
+
+=item C<PMC * Parrot_find_method_at_site(PARROT_INTERP, PMC *object, STRING
+*method_name, const opcode_t *pc)>
+
+Find the method C<method_name> of C<object> for the method call op at C<pc>,
+like C<VTABLE_find_method>.  Each call site has an inline cache of the
+methods found there for the last few types of invocant, checked against the
+method epochs of the types.  A call site that sees the same few types over and
+over skips the lookup.  Only invocants whose C<find_method> depends on nothing
+but their type and the name are cached: Objects, by their class, and PMCs using
+the default C<find_method>, by their vtable.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_find_method_at_site(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(STRING *method_name), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_find_method_at_site)
+    Caches       * const mc     = interp->caches;
+    const VTABLE * const vtable = object->vtable;
+    Meth_inline_cache   *ic;
+    Meth_ic_way         *way    = NULL;
+    PMC                 *_class, *method;
+    INTVAL               type;
+    UINTVAL              epoch, i;
+
+    if (vtable->find_method == interp->vtables[enum_class_Object]->find_method) {
+        _class = PARROT_OBJECT(object)->_class;
+        type   = PARROT_CLASS(_class)->id;
+    }
+    else if (vtable->find_method == interp->vtables[enum_class_default]->find_method) {
+        _class = NULL;
+        type   = vtable->base_type;
+    }
+    else
+        return VTABLE_find_method(interp, object, method_name);
+
+    if (!mc->sites)
+        mc->sites = mem_gc_allocate_n_zeroed_typed(interp, IC_SIZE,
+                Meth_inline_cache);
+
+    ic = &mc->sites[((UINTVAL)pc / sizeof (opcode_t)) & IC_SIZE_MASK];
+
+    if (ic->pc == pc && Parrot_str_equal(interp, ic->name, method_name)) {
+        for (i = 0; i < METH_IC_WAYS; ++i) {
+            if (ic->ways[i].vtable == vtable && ic->ways[i]._class == _class) {
+                if (ic->ways[i].epoch == mc->epochs[type])
+                    return ic->ways[i].method;
+                break;
+            }
+        }
+    }
+
+    if ((UINTVAL)type >= mc->mc_size)
+        grow_object_cache(interp, mc, (UINTVAL)type);
+
+    epoch  = mc->epochs[type];
+    method = VTABLE_find_method(interp, object, method_name);
+
+    if (PMC_IS_NULL(method))
+        return method;
+
+    /* The lookup may have run code that took over the inline cache */
+    if (ic->pc != pc || !Parrot_str_equal(interp, ic->name, method_name)) {
+        memset(ic, 0, sizeof (Meth_inline_cache));
+        ic->pc   = pc;
+        ic->name = method_name;
+    }
+
+    for (i = 0; i < METH_IC_WAYS; ++i) {
+        if (!ic->ways[i].vtable
+        || (ic->ways[i].vtable == vtable && ic->ways[i]._class == _class)) {
+            way = &ic->ways[i];
+            break;
+        }
+    }
+
+    if (!way)
+        way = &ic->ways[ic->next_way++ % METH_IC_WAYS];
+
+    way->vtable = vtable;
+    way->_class = _class;
+    way->epoch  = epoch;
+    way->method = method;
+
+    return method;
+}
+
+
 /*
 
 =item C<static PMC* C3_merge(PARROT_INTERP, PMC *merge_list)>
@@ -26,7 +26,7 @@
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
 #undef  PCONST
-#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
 
 static int get_op(PARROT_INTERP, const char * name, int full);
 
@@ -79,13 +79,13 @@ extern op_lib_t core_op_lib;
 
 
 
-INTVAL core_numops = 1132;
+INTVAL core_numops = 1134;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1132] = {
+static op_func_t core_op_func_table[1134] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -1217,6 +1217,8 @@ static op_func_t core_op_func_table[1132] = {
   Parrot_disable_preemption,                         /*   1128 */
   Parrot_enable_preemption,                          /*   1129 */
   Parrot_terminate,                                  /*   1130 */
+  Parrot_intern_s_s,                                 /*   1131 */
+  Parrot_intern_s_sc,                                /*   1132 */
 
   NULL /* NULL function pointer */
 };
@@ -1227,7 +1229,7 @@ static op_func_t core_op_func_table[1132] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1132] = {
+static op_info_t core_op_info_table[1134] = {
   { /* 0 */
     "end",
     "end",
@@ -13669,6 +13671,28 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
+  { /* 1131 */
+    "intern",
+    "intern_s_s",
+    "Parrot_intern_s_s",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1132 */
+    "intern",
+    "intern_s_sc",
+    "Parrot_intern_s_sc",
+    0,
+    3,
+    { PARROT_ARG_S, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
 
 };
 
@@ -13961,9 +13985,11 @@ Parrot_tailcall_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_returncc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  *      const  p = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    PMC  *      const  ctx = CURRENT_CONTEXT(interp);
+    PMC  *      const  p = Parrot_pcc_get_continuation(interp, ctx);
     opcode_t  * const  dest = VTABLE_invoke(interp, p,  cur_opcode + 1);
 
+    Parrot_pcc_release_registers(interp, ctx);
     return (opcode_t *)dest;
 }
 
@@ -18654,7 +18680,7 @@ Parrot_callmethodcc_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
         dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for non-object", meth);
     }
     else {
-        method_pmc = VTABLE_find_method(interp, object, meth);
+        method_pmc = Parrot_find_method_at_site(interp, object, meth, cur_opcode);
     }
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18692,7 +18718,7 @@ Parrot_callmethodcc_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
         dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for non-object", meth);
     }
     else {
-        method_pmc = VTABLE_find_method(interp, object, meth);
+        method_pmc = Parrot_find_method_at_site(interp, object, meth, cur_opcode);
     }
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18734,7 +18760,7 @@ Parrot_callmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
     opcode_t  * const  next =  cur_opcode + 4;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_at_site(interp, object, meth, cur_opcode);
     opcode_t  * dest;
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18754,7 +18780,7 @@ Parrot_callmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
     opcode_t  * const  next =  cur_opcode + 4;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_at_site(interp, object, meth, cur_opcode);
     opcode_t  * dest;
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18786,7 +18812,7 @@ Parrot_tailcallmethod_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  next =  cur_opcode + 3;
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_at_site(interp, object, meth, cur_opcode);
     opcode_t  * dest;
 
     if (PMC_IS_NULL(method_pmc)) {
@@ -18806,7 +18832,7 @@ Parrot_tailcallmethod_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  next =  cur_opcode + 3;
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_at_site(interp, object, meth, cur_opcode);
     opcode_t  * dest;
 
     if (PMC_IS_NULL(method_pmc)) {
@@ -20035,7 +20061,7 @@ opcode_t *
 Parrot_find_method_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  resume =  cur_opcode + 4;
 
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
+    PREG(1) = Parrot_find_method_at_site(interp, PREG(2), SREG(3), cur_opcode);
     if (PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1)))) {
         opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SREG(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
 
@@ -20054,7 +20080,7 @@ opcode_t *
 Parrot_find_method_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  resume =  cur_opcode + 4;
 
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
+    PREG(1) = Parrot_find_method_at_site(interp, PREG(2), SCONST(3), cur_opcode);
     if (PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1)))) {
         opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
 
@@ -24946,6 +24972,20 @@ Parrot_terminate(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 1;
 }
 
+opcode_t *
+Parrot_intern_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_intern(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_intern_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_intern(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
 
 /*
 ** op lib descriptor:
@@ -24959,7 +24999,7 @@ op_lib_t core_op_lib = {
   0,                                /* flags */
   PARROT_PBC_MAJOR,
   PARROT_PBC_MINOR,
-  1131,             /* op_count */
+  1133,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
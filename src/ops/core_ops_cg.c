@@ -0,0 +1,6116 @@
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/ops/core.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+
+#include "parrot/oplib/core_ops_cg.h"
+#include "parrot/pbcversion.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::CGoto */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
+
+#define CG_SYNC_PC()   Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode)
+#define CG_DISPATCH()  goto *cg_code[cur_opcode - cg_base]
+#define CG_NEXT(dest)  do { cur_opcode = (dest); CG_DISPATCH(); } while (0)
+#define CG_JUMP(dest)  do { cur_opcode = (dest); goto CG_BRANCH; } while (0)
+
+
+
+#include "parrot/dynext.h"
+#include "parrot/runcore_api.h"
+#include "parrot/events.h"
+#include "pmc/pmc_exception.h"
+#include "pmc/pmc_exceptionhandler.h"
+#include "pmc/pmc_continuation.h"
+#include "pmc/pmc_fixedintegerarray.h"
+#include "pmc/pmc_parrotlibrary.h"
+
+
+
+ /* Signed shift operator that is compatible with PMC shifts.  This is
+  * guaranteed to produce the same result as bitwise_left_shift_internal modulo
+  * word size, ignoring the fact that Parrot integers are always signed.  This
+  * usually gives the same answer regardless whether you shift PMC operands and
+  * then assign to an I-reg, or move the operands to I-regs and do the shift
+  * there -- except when the true result is between 2^{w-1} and 2^w (where w is
+  * the word size), in which case the high order bit is taken as the sign,
+  * giving a truncated result that is 2^w lower.
+  */
+#define bit_shift_left(number, bits) \
+    ((bits) >= 8*INTVAL_SIZE     ? 0                    \
+     : (bits) >= 0               ? (number) << (bits)   \
+     : (bits) > -8*INTVAL_SIZE   ? (number) >> -(bits)   \
+     : 0)
+
+
+#include "../io/io_private.h"
+
+
+#include "parrot/encoding.h"
+#include "parrot/namealias.h"
+#if PARROT_HAS_ICU
+#  include <unicode/uchar.h>
+#endif
+
+
+
+#include "parrot/scheduler_private.h"
+#include "pmc/pmc_task.h"
+
+
+#if PARROT_HAS_CGOTO
+
+static void ** core_cg_load_segment(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs),
+        ARGIN(void *translate));
+
+/*
+** Threaded code for a segment: one label address per opcode_t, initially
+** all pointing at the translation label.
+*/
+
+static void **
+core_cg_load_segment(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs), ARGIN(void *translate))
+{
+    if (cs->cgoto_size != cs->base.size) {
+        size_t i;
+
+        if (cs->cgoto_code)
+            mem_gc_free(interp, cs->cgoto_code);
+
+        cs->cgoto_code      = mem_gc_allocate_n_typed(interp, cs->base.size, void *);
+        cs->cgoto_size      = cs->base.size;
+        cs->cgoto_translate = translate;
+
+        for (i = 0; i < cs->cgoto_size; ++i)
+            cs->cgoto_code[i] = translate;
+    }
+
+    return cs->cgoto_code;
+}
+
+/*
+** Computed goto runcore:
+*/
+
+opcode_t *
+core_cg_runops(PARROT_INTERP, ARGIN(opcode_t *cur_opcode))
+{
+    static void * const ops_addr[] = {
+        &&PC_0,                        /*      0 */
+        &&PC_1,                        /*      1 */
+        &&PC_2,                        /*      2 */
+        &&PC_3,                        /*      3 */
+        &&PC_4,                        /*      4 */
+        &&PC_5,                        /*      5 */
+        &&PC_6,                        /*      6 */
+        &&PC_7,                        /*      7 */
+        &&PC_8,                        /*      8 */
+        &&PC_9,                        /*      9 */
+        &&PC_10,                       /*     10 */
+        &&PC_11,                       /*     11 */
+        &&PC_12,                       /*     12 */
+        &&PC_13,                       /*     13 */
+        &&PC_14,                       /*     14 */
+        &&PC_15,                       /*     15 */
+        &&PC_16,                       /*     16 */
+        &&PC_17,                       /*     17 */
+        &&PC_18,                       /*     18 */
+        &&PC_19,                       /*     19 */
+        &&PC_20,                       /*     20 */
+        &&PC_21,                       /*     21 */
+        &&PC_22,                       /*     22 */
+        &&PC_23,                       /*     23 */
+        &&PC_24,                       /*     24 */
+        &&PC_25,                       /*     25 */
+        &&PC_26,                       /*     26 */
+        &&PC_27,                       /*     27 */
+        &&PC_28,                       /*     28 */
+        &&PC_29,                       /*     29 */
+        &&PC_30,                       /*     30 */
+        &&PC_31,                       /*     31 */
+        &&PC_32,                       /*     32 */
+        &&PC_33,                       /*     33 */
+        &&PC_34,                       /*     34 */
+        &&PC_35,                       /*     35 */
+        &&PC_36,                       /*     36 */
+        &&PC_37,                       /*     37 */
+        &&PC_38,                       /*     38 */
+        &&PC_39,                       /*     39 */
+        &&PC_40,                       /*     40 */
+        &&PC_41,                       /*     41 */
+        &&PC_42,                       /*     42 */
+        &&PC_43,                       /*     43 */
+        &&PC_44,                       /*     44 */
+        &&PC_45,                       /*     45 */
+        &&PC_46,                       /*     46 */
+        &&PC_47,                       /*     47 */
+        &&PC_48,                       /*     48 */
+        &&PC_49,                       /*     49 */
+        &&PC_50,                       /*     50 */
+        &&PC_51,                       /*     51 */
+        &&PC_52,                       /*     52 */
+        &&PC_53,                       /*     53 */
+        &&PC_54,                       /*     54 */
+        &&PC_55,                       /*     55 */
+        &&PC_56,                       /*     56 */
+        &&PC_57,                       /*     57 */
+        &&PC_58,                       /*     58 */
+        &&PC_59,                       /*     59 */
+        &&PC_60,                       /*     60 */
+        &&PC_61,                       /*     61 */
+        &&PC_62,                       /*     62 */
+        &&PC_63,                       /*     63 */
+        &&PC_64,                       /*     64 */
+        &&PC_65,                       /*     65 */
+        &&PC_66,                       /*     66 */
+        &&PC_67,                       /*     67 */
+        &&PC_68,                       /*     68 */
+        &&PC_69,                       /*     69 */
+        &&PC_70,                       /*     70 */
+        &&PC_71,                       /*     71 */
+        &&PC_72,                       /*     72 */
+        &&PC_73,                       /*     73 */
+        &&PC_74,                       /*     74 */
+        &&PC_75,                       /*     75 */
+        &&PC_76,                       /*     76 */
+        &&PC_77,                       /*     77 */
+        &&PC_78,                       /*     78 */
+        &&PC_79,                       /*     79 */
+        &&PC_80,                       /*     80 */
+        &&PC_81,                       /*     81 */
+        &&PC_82,                       /*     82 */
+        &&PC_83,                       /*     83 */
+        &&PC_84,                       /*     84 */
+        &&PC_85,                       /*     85 */
+        &&PC_86,                       /*     86 */
+        &&PC_87,                       /*     87 */
+        &&PC_88,                       /*     88 */
+        &&PC_89,                       /*     89 */
+        &&PC_90,                       /*     90 */
+        &&PC_91,                       /*     91 */
+        &&PC_92,                       /*     92 */
+        &&PC_93,                       /*     93 */
+        &&PC_94,                       /*     94 */
+        &&PC_95,                       /*     95 */
+        &&PC_96,                       /*     96 */
+        &&PC_97,                       /*     97 */
+        &&PC_98,                       /*     98 */
+        &&PC_99,                       /*     99 */
+        &&PC_100,                      /*    100 */
+        &&PC_101,                      /*    101 */
+        &&PC_102,                      /*    102 */
+        &&PC_103,                      /*    103 */
+        &&PC_104,                      /*    104 */
+        &&PC_105,                      /*    105 */
+        &&PC_106,                      /*    106 */
+        &&PC_107,                      /*    107 */
+        &&PC_108,                      /*    108 */
+        &&PC_109,                      /*    109 */
+        &&PC_110,                      /*    110 */
+        &&PC_111,                      /*    111 */
+        &&PC_112,                      /*    112 */
+        &&PC_113,                      /*    113 */
+        &&PC_114,                      /*    114 */
+        &&PC_115,                      /*    115 */
+        &&PC_116,                      /*    116 */
+        &&PC_117,                      /*    117 */
+        &&PC_118,                      /*    118 */
+        &&PC_119,                      /*    119 */
+        &&PC_120,                      /*    120 */
+        &&PC_121,                      /*    121 */
+        &&PC_122,                      /*    122 */
+        &&PC_123,                      /*    123 */
+        &&PC_124,                      /*    124 */
+        &&PC_125,                      /*    125 */
+        &&PC_126,                      /*    126 */
+        &&PC_127,                      /*    127 */
+        &&PC_128,                      /*    128 */
+        &&PC_129,                      /*    129 */
+        &&PC_130,                      /*    130 */
+        &&PC_131,                      /*    131 */
+        &&PC_132,                      /*    132 */
+        &&PC_133,                      /*    133 */
+        &&PC_134,                      /*    134 */
+        &&PC_135,                      /*    135 */
+        &&PC_136,                      /*    136 */
+        &&PC_137,                      /*    137 */
+        &&PC_138,                      /*    138 */
+        &&PC_139,                      /*    139 */
+        &&PC_140,                      /*    140 */
+        &&PC_141,                      /*    141 */
+        &&PC_142,                      /*    142 */
+        &&PC_143,                      /*    143 */
+        &&PC_144,                      /*    144 */
+        &&PC_145,                      /*    145 */
+        &&PC_146,                      /*    146 */
+        &&PC_147,                      /*    147 */
+        &&PC_148,                      /*    148 */
+        &&PC_149,                      /*    149 */
+        &&PC_150,                      /*    150 */
+        &&PC_151,                      /*    151 */
+        &&PC_152,                      /*    152 */
+        &&PC_153,                      /*    153 */
+        &&PC_154,                      /*    154 */
+        &&PC_155,                      /*    155 */
+        &&PC_156,                      /*    156 */
+        &&PC_157,                      /*    157 */
+        &&PC_158,                      /*    158 */
+        &&PC_159,                      /*    159 */
+        &&PC_160,                      /*    160 */
+        &&PC_161,                      /*    161 */
+        &&PC_162,                      /*    162 */
+        &&PC_163,                      /*    163 */
+        &&PC_164,                      /*    164 */
+        &&PC_165,                      /*    165 */
+        &&PC_166,                      /*    166 */
+        &&PC_167,                      /*    167 */
+        &&PC_168,                      /*    168 */
+        &&PC_169,                      /*    169 */
+        &&PC_170,                      /*    170 */
+        &&PC_171,                      /*    171 */
+        &&PC_172,                      /*    172 */
+        &&PC_173,                      /*    173 */
+        &&PC_174,                      /*    174 */
+        &&PC_175,                      /*    175 */
+        &&PC_176,                      /*    176 */
+        &&PC_177,                      /*    177 */
+        &&PC_178,                      /*    178 */
+        &&PC_179,                      /*    179 */
+        &&PC_180,                      /*    180 */
+        &&PC_181,                      /*    181 */
+        &&PC_182,                      /*    182 */
+        &&PC_183,                      /*    183 */
+        &&PC_184,                      /*    184 */
+        &&PC_185,                      /*    185 */
+        &&PC_186,                      /*    186 */
+        &&PC_187,                      /*    187 */
+        &&PC_188,                      /*    188 */
+        &&PC_189,                      /*    189 */
+        &&PC_190,                      /*    190 */
+        &&PC_191,                      /*    191 */
+        &&PC_192,                      /*    192 */
+        &&PC_193,                      /*    193 */
+        &&PC_194,                      /*    194 */
+        &&PC_195,                      /*    195 */
+        &&PC_196,                      /*    196 */
+        &&PC_197,                      /*    197 */
+        &&PC_198,                      /*    198 */
+        &&PC_199,                      /*    199 */
+        &&PC_200,                      /*    200 */
+        &&PC_201,                      /*    201 */
+        &&PC_202,                      /*    202 */
+        &&PC_203,                      /*    203 */
+        &&PC_204,                      /*    204 */
+        &&PC_205,                      /*    205 */
+        &&PC_206,                      /*    206 */
+        &&PC_207,                      /*    207 */
+        &&PC_208,                      /*    208 */
+        &&PC_209,                      /*    209 */
+        &&PC_210,                      /*    210 */
+        &&PC_211,                      /*    211 */
+        &&PC_212,                      /*    212 */
+        &&PC_213,                      /*    213 */
+        &&PC_214,                      /*    214 */
+        &&PC_215,                      /*    215 */
+        &&PC_216,                      /*    216 */
+        &&PC_217,                      /*    217 */
+        &&PC_218,                      /*    218 */
+        &&PC_219,                      /*    219 */
+        &&PC_220,                      /*    220 */
+        &&PC_221,                      /*    221 */
+        &&PC_222,                      /*    222 */
+        &&PC_223,                      /*    223 */
+        &&PC_224,                      /*    224 */
+        &&PC_225,                      /*    225 */
+        &&PC_226,                      /*    226 */
+        &&PC_227,                      /*    227 */
+        &&PC_228,                      /*    228 */
+        &&PC_229,                      /*    229 */
+        &&PC_230,                      /*    230 */
+        &&PC_231,                      /*    231 */
+        &&PC_232,                      /*    232 */
+        &&PC_233,                      /*    233 */
+        &&PC_234,                      /*    234 */
+        &&PC_235,                      /*    235 */
+        &&PC_236,                      /*    236 */
+        &&PC_237,                      /*    237 */
+        &&PC_238,                      /*    238 */
+        &&PC_239,                      /*    239 */
+        &&PC_240,                      /*    240 */
+        &&PC_241,                      /*    241 */
+        &&PC_242,                      /*    242 */
+        &&PC_243,                      /*    243 */
+        &&PC_244,                      /*    244 */
+        &&PC_245,                      /*    245 */
+        &&PC_246,                      /*    246 */
+        &&PC_247,                      /*    247 */
+        &&PC_248,                      /*    248 */
+        &&PC_249,                      /*    249 */
+        &&PC_250,                      /*    250 */
+        &&PC_251,                      /*    251 */
+        &&PC_252,                      /*    252 */
+        &&PC_253,                      /*    253 */
+        &&PC_254,                      /*    254 */
+        &&PC_255,                      /*    255 */
+        &&PC_256,                      /*    256 */
+        &&PC_257,                      /*    257 */
+        &&PC_258,                      /*    258 */
+        &&PC_259,                      /*    259 */
+        &&PC_260,                      /*    260 */
+        &&PC_261,                      /*    261 */
+        &&PC_262,                      /*    262 */
+        &&PC_263,                      /*    263 */
+        &&PC_264,                      /*    264 */
+        &&PC_265,                      /*    265 */
+        &&PC_266,                      /*    266 */
+        &&PC_267,                      /*    267 */
+        &&PC_268,                      /*    268 */
+        &&PC_269,                      /*    269 */
+        &&PC_270,                      /*    270 */
+        &&PC_271,                      /*    271 */
+        &&PC_272,                      /*    272 */
+        &&PC_273,                      /*    273 */
+        &&PC_274,                      /*    274 */
+        &&PC_275,                      /*    275 */
+        &&PC_276,                      /*    276 */
+        &&PC_277,                      /*    277 */
+        &&PC_278,                      /*    278 */
+        &&PC_279,                      /*    279 */
+        &&PC_280,                      /*    280 */
+        &&PC_281,                      /*    281 */
+        &&PC_282,                      /*    282 */
+        &&PC_283,                      /*    283 */
+        &&PC_284,                      /*    284 */
+        &&PC_285,                      /*    285 */
+        &&PC_286,                      /*    286 */
+        &&PC_287,                      /*    287 */
+        &&PC_288,                      /*    288 */
+        &&PC_289,                      /*    289 */
+        &&PC_290,                      /*    290 */
+        &&PC_291,                      /*    291 */
+        &&PC_292,                      /*    292 */
+        &&PC_293,                      /*    293 */
+        &&PC_294,                      /*    294 */
+        &&PC_295,                      /*    295 */
+        &&PC_296,                      /*    296 */
+        &&PC_297,                      /*    297 */
+        &&PC_298,                      /*    298 */
+        &&PC_299,                      /*    299 */
+        &&PC_300,                      /*    300 */
+        &&PC_301,                      /*    301 */
+        &&PC_302,                      /*    302 */
+        &&PC_303,                      /*    303 */
+        &&PC_304,                      /*    304 */
+        &&PC_305,                      /*    305 */
+        &&PC_306,                      /*    306 */
+        &&PC_307,                      /*    307 */
+        &&PC_308,                      /*    308 */
+        &&PC_309,                      /*    309 */
+        &&PC_310,                      /*    310 */
+        &&PC_311,                      /*    311 */
+        &&PC_312,                      /*    312 */
+        &&PC_313,                      /*    313 */
+        &&PC_314,                      /*    314 */
+        &&PC_315,                      /*    315 */
+        &&PC_316,                      /*    316 */
+        &&PC_317,                      /*    317 */
+        &&PC_318,                      /*    318 */
+        &&PC_319,                      /*    319 */
+        &&PC_320,                      /*    320 */
+        &&PC_321,                      /*    321 */
+        &&PC_322,                      /*    322 */
+        &&PC_323,                      /*    323 */
+        &&PC_324,                      /*    324 */
+        &&PC_325,                      /*    325 */
+        &&PC_326,                      /*    326 */
+        &&PC_327,                      /*    327 */
+        &&PC_328,                      /*    328 */
+        &&PC_329,                      /*    329 */
+        &&PC_330,                      /*    330 */
+        &&PC_331,                      /*    331 */
+        &&PC_332,                      /*    332 */
+        &&PC_333,                      /*    333 */
+        &&PC_334,                      /*    334 */
+        &&PC_335,                      /*    335 */
+        &&PC_336,                      /*    336 */
+        &&PC_337,                      /*    337 */
+        &&PC_338,                      /*    338 */
+        &&PC_339,                      /*    339 */
+        &&PC_340,                      /*    340 */
+        &&PC_341,                      /*    341 */
+        &&PC_342,                      /*    342 */
+        &&PC_343,                      /*    343 */
+        &&PC_344,                      /*    344 */
+        &&PC_345,                      /*    345 */
+        &&PC_346,                      /*    346 */
+        &&PC_347,                      /*    347 */
+        &&PC_348,                      /*    348 */
+        &&PC_349,                      /*    349 */
+        &&PC_350,                      /*    350 */
+        &&PC_351,                      /*    351 */
+        &&PC_352,                      /*    352 */
+        &&PC_353,                      /*    353 */
+        &&PC_354,                      /*    354 */
+        &&PC_355,                      /*    355 */
+        &&PC_356,                      /*    356 */
+        &&PC_357,                      /*    357 */
+        &&PC_358,                      /*    358 */
+        &&PC_359,                      /*    359 */
+        &&PC_360,                      /*    360 */
+        &&PC_361,                      /*    361 */
+        &&PC_362,                      /*    362 */
+        &&PC_363,                      /*    363 */
+        &&PC_364,                      /*    364 */
+        &&PC_365,                      /*    365 */
+        &&PC_366,                      /*    366 */
+        &&PC_367,                      /*    367 */
+        &&PC_368,                      /*    368 */
+        &&PC_369,                      /*    369 */
+        &&PC_370,                      /*    370 */
+        &&PC_371,                      /*    371 */
+        &&PC_372,                      /*    372 */
+        &&PC_373,                      /*    373 */
+        &&PC_374,                      /*    374 */
+        &&PC_375,                      /*    375 */
+        &&PC_376,                      /*    376 */
+        &&PC_377,                      /*    377 */
+        &&PC_378,                      /*    378 */
+        &&PC_379,                      /*    379 */
+        &&PC_380,                      /*    380 */
+        &&PC_381,                      /*    381 */
+        &&PC_382,                      /*    382 */
+        &&PC_383,                      /*    383 */
+        &&PC_384,                      /*    384 */
+        &&PC_385,                      /*    385 */
+        &&PC_386,                      /*    386 */
+        &&PC_387,                      /*    387 */
+        &&PC_388,                      /*    388 */
+        &&PC_389,                      /*    389 */
+        &&PC_390,                      /*    390 */
+        &&PC_391,                      /*    391 */
+        &&PC_392,                      /*    392 */
+        &&PC_393,                      /*    393 */
+        &&PC_394,                      /*    394 */
+        &&PC_395,                      /*    395 */
+        &&PC_396,                      /*    396 */
+        &&PC_397,                      /*    397 */
+        &&PC_398,                      /*    398 */
+        &&PC_399,                      /*    399 */
+        &&PC_400,                      /*    400 */
+        &&PC_401,                      /*    401 */
+        &&PC_402,                      /*    402 */
+        &&PC_403,                      /*    403 */
+        &&PC_404,                      /*    404 */
+        &&PC_405,                      /*    405 */
+        &&PC_406,                      /*    406 */
+        &&PC_407,                      /*    407 */
+        &&PC_408,                      /*    408 */
+        &&PC_409,                      /*    409 */
+        &&PC_410,                      /*    410 */
+        &&PC_411,                      /*    411 */
+        &&PC_412,                      /*    412 */
+        &&PC_413,                      /*    413 */
+        &&PC_414,                      /*    414 */
+        &&PC_415,                      /*    415 */
+        &&PC_416,                      /*    416 */
+        &&PC_417,                      /*    417 */
+        &&PC_418,                      /*    418 */
+        &&PC_419,                      /*    419 */
+        &&PC_420,                      /*    420 */
+        &&PC_421,                      /*    421 */
+        &&PC_422,                      /*    422 */
+        &&PC_423,                      /*    423 */
+        &&PC_424,                      /*    424 */
+        &&PC_425,                      /*    425 */
+        &&PC_426,                      /*    426 */
+        &&PC_427,                      /*    427 */
+        &&PC_428,                      /*    428 */
+        &&PC_429,                      /*    429 */
+        &&PC_430,                      /*    430 */
+        &&PC_431,                      /*    431 */
+        &&PC_432,                      /*    432 */
+        &&PC_433,                      /*    433 */
+        &&PC_434,                      /*    434 */
+        &&PC_435,                      /*    435 */
+        &&PC_436,                      /*    436 */
+        &&PC_437,                      /*    437 */
+        &&PC_438,                      /*    438 */
+        &&PC_439,                      /*    439 */
+        &&PC_440,                      /*    440 */
+        &&PC_441,                      /*    441 */
+        &&PC_442,                      /*    442 */
+        &&PC_443,                      /*    443 */
+        &&PC_444,                      /*    444 */
+        &&PC_445,                      /*    445 */
+        &&PC_446,                      /*    446 */
+        &&PC_447,                      /*    447 */
+        &&PC_448,                      /*    448 */
+        &&PC_449,                      /*    449 */
+        &&PC_450,                      /*    450 */
+        &&PC_451,                      /*    451 */
+        &&PC_452,                      /*    452 */
+        &&PC_453,                      /*    453 */
+        &&PC_454,                      /*    454 */
+        &&PC_455,                      /*    455 */
+        &&PC_456,                      /*    456 */
+        &&PC_457,                      /*    457 */
+        &&PC_458,                      /*    458 */
+        &&PC_459,                      /*    459 */
+        &&PC_460,                      /*    460 */
+        &&PC_461,                      /*    461 */
+        &&PC_462,                      /*    462 */
+        &&PC_463,                      /*    463 */
+        &&PC_464,                      /*    464 */
+        &&PC_465,                      /*    465 */
+        &&PC_466,                      /*    466 */
+        &&PC_467,                      /*    467 */
+        &&PC_468,                      /*    468 */
+        &&PC_469,                      /*    469 */
+        &&PC_470,                      /*    470 */
+        &&PC_471,                      /*    471 */
+        &&PC_472,                      /*    472 */
+        &&PC_473,                      /*    473 */
+        &&PC_474,                      /*    474 */
+        &&PC_475,                      /*    475 */
+        &&PC_476,                      /*    476 */
+        &&PC_477,                      /*    477 */
+        &&PC_478,                      /*    478 */
+        &&PC_479,                      /*    479 */
+        &&PC_480,                      /*    480 */
+        &&PC_481,                      /*    481 */
+        &&PC_482,                      /*    482 */
+        &&PC_483,                      /*    483 */
+        &&PC_484,                      /*    484 */
+        &&PC_485,                      /*    485 */
+        &&PC_486,                      /*    486 */
+        &&PC_487,                      /*    487 */
+        &&PC_488,                      /*    488 */
+        &&PC_489,                      /*    489 */
+        &&PC_490,                      /*    490 */
+        &&PC_491,                      /*    491 */
+        &&PC_492,                      /*    492 */
+        &&PC_493,                      /*    493 */
+        &&PC_494,                      /*    494 */
+        &&PC_495,                      /*    495 */
+        &&PC_496,                      /*    496 */
+        &&PC_497,                      /*    497 */
+        &&PC_498,                      /*    498 */
+        &&PC_499,                      /*    499 */
+        &&PC_500,                      /*    500 */
+        &&PC_501,                      /*    501 */
+        &&PC_502,                      /*    502 */
+        &&PC_503,                      /*    503 */
+        &&PC_504,                      /*    504 */
+        &&PC_505,                      /*    505 */
+        &&PC_506,                      /*    506 */
+        &&PC_507,                      /*    507 */
+        &&PC_508,                      /*    508 */
+        &&PC_509,                      /*    509 */
+        &&PC_510,                      /*    510 */
+        &&PC_511,                      /*    511 */
+        &&PC_512,                      /*    512 */
+        &&PC_513,                      /*    513 */
+        &&PC_514,                      /*    514 */
+        &&PC_515,                      /*    515 */
+        &&PC_516,                      /*    516 */
+        &&PC_517,                      /*    517 */
+        &&PC_518,                      /*    518 */
+        &&PC_519,                      /*    519 */
+        &&PC_520,                      /*    520 */
+        &&PC_521,                      /*    521 */
+        &&PC_522,                      /*    522 */
+        &&PC_523,                      /*    523 */
+        &&PC_524,                      /*    524 */
+        &&PC_525,                      /*    525 */
+        &&PC_526,                      /*    526 */
+        &&PC_527,                      /*    527 */
+        &&PC_528,                      /*    528 */
+        &&PC_529,                      /*    529 */
+        &&PC_530,                      /*    530 */
+        &&PC_531,                      /*    531 */
+        &&PC_532,                      /*    532 */
+        &&PC_533,                      /*    533 */
+        &&PC_534,                      /*    534 */
+        &&PC_535,                      /*    535 */
+        &&PC_536,                      /*    536 */
+        &&PC_537,                      /*    537 */
+        &&PC_538,                      /*    538 */
+        &&PC_539,                      /*    539 */
+        &&PC_540,                      /*    540 */
+        &&PC_541,                      /*    541 */
+        &&PC_542,                      /*    542 */
+        &&PC_543,                      /*    543 */
+        &&PC_544,                      /*    544 */
+        &&PC_545,                      /*    545 */
+        &&PC_546,                      /*    546 */
+        &&PC_547,                      /*    547 */
+        &&PC_548,                      /*    548 */
+        &&PC_549,                      /*    549 */
+        &&PC_550,                      /*    550 */
+        &&PC_551,                      /*    551 */
+        &&PC_552,                      /*    552 */
+        &&PC_553,                      /*    553 */
+        &&PC_554,                      /*    554 */
+        &&PC_555,                      /*    555 */
+        &&PC_556,                      /*    556 */
+        &&PC_557,                      /*    557 */
+        &&PC_558,                      /*    558 */
+        &&PC_559,                      /*    559 */
+        &&PC_560,                      /*    560 */
+        &&PC_561,                      /*    561 */
+        &&PC_562,                      /*    562 */
+        &&PC_563,                      /*    563 */
+        &&PC_564,                      /*    564 */
+        &&PC_565,                      /*    565 */
+        &&PC_566,                      /*    566 */
+        &&PC_567,                      /*    567 */
+        &&PC_568,                      /*    568 */
+        &&PC_569,                      /*    569 */
+        &&PC_570,                      /*    570 */
+        &&PC_571,                      /*    571 */
+        &&PC_572,                      /*    572 */
+        &&PC_573,                      /*    573 */
+        &&PC_574,                      /*    574 */
+        &&PC_575,                      /*    575 */
+        &&PC_576,                      /*    576 */
+        &&PC_577,                      /*    577 */
+        &&PC_578,                      /*    578 */
+        &&PC_579,                      /*    579 */
+        &&PC_580,                      /*    580 */
+        &&PC_581,                      /*    581 */
+        &&PC_582,                      /*    582 */
+        &&PC_583,                      /*    583 */
+        &&PC_584,                      /*    584 */
+        &&PC_585,                      /*    585 */
+        &&PC_586,                      /*    586 */
+        &&PC_587,                      /*    587 */
+        &&PC_588,                      /*    588 */
+        &&PC_589,                      /*    589 */
+        &&PC_590,                      /*    590 */
+        &&PC_591,                      /*    591 */
+        &&PC_592,                      /*    592 */
+        &&PC_593,                      /*    593 */
+        &&PC_594,                      /*    594 */
+        &&PC_595,                      /*    595 */
+        &&PC_596,                      /*    596 */
+        &&PC_597,                      /*    597 */
+        &&PC_598,                      /*    598 */
+        &&PC_599,                      /*    599 */
+        &&PC_600,                      /*    600 */
+        &&PC_601,                      /*    601 */
+        &&PC_602,                      /*    602 */
+        &&PC_603,                      /*    603 */
+        &&PC_604,                      /*    604 */
+        &&PC_605,                      /*    605 */
+        &&PC_606,                      /*    606 */
+        &&PC_607,                      /*    607 */
+        &&PC_608,                      /*    608 */
+        &&PC_609,                      /*    609 */
+        &&PC_610,                      /*    610 */
+        &&PC_611,                      /*    611 */
+        &&PC_612,                      /*    612 */
+        &&PC_613,                      /*    613 */
+        &&PC_614,                      /*    614 */
+        &&PC_615,                      /*    615 */
+        &&PC_616,                      /*    616 */
+        &&PC_617,                      /*    617 */
+        &&PC_618,                      /*    618 */
+        &&PC_619,                      /*    619 */
+        &&PC_620,                      /*    620 */
+        &&PC_621,                      /*    621 */
+        &&PC_622,                      /*    622 */
+        &&PC_623,                      /*    623 */
+        &&PC_624,                      /*    624 */
+        &&PC_625,                      /*    625 */
+        &&PC_626,                      /*    626 */
+        &&PC_627,                      /*    627 */
+        &&PC_628,                      /*    628 */
+        &&PC_629,                      /*    629 */
+        &&PC_630,                      /*    630 */
+        &&PC_631,                      /*    631 */
+        &&PC_632,                      /*    632 */
+        &&PC_633,                      /*    633 */
+        &&PC_634,                      /*    634 */
+        &&PC_635,                      /*    635 */
+        &&PC_636,                      /*    636 */
+        &&PC_637,                      /*    637 */
+        &&PC_638,                      /*    638 */
+        &&PC_639,                      /*    639 */
+        &&PC_640,                      /*    640 */
+        &&PC_641,                      /*    641 */
+        &&PC_642,                      /*    642 */
+        &&PC_643,                      /*    643 */
+        &&PC_644,                      /*    644 */
+        &&PC_645,                      /*    645 */
+        &&PC_646,                      /*    646 */
+        &&PC_647,                      /*    647 */
+        &&PC_648,                      /*    648 */
+        &&PC_649,                      /*    649 */
+        &&PC_650,                      /*    650 */
+        &&PC_651,                      /*    651 */
+        &&PC_652,                      /*    652 */
+        &&PC_653,                      /*    653 */
+        &&PC_654,                      /*    654 */
+        &&PC_655,                      /*    655 */
+        &&PC_656,                      /*    656 */
+        &&PC_657,                      /*    657 */
+        &&PC_658,                      /*    658 */
+        &&PC_659,                      /*    659 */
+        &&PC_660,                      /*    660 */
+        &&PC_661,                      /*    661 */
+        &&PC_662,                      /*    662 */
+        &&PC_663,                      /*    663 */
+        &&PC_664,                      /*    664 */
+        &&PC_665,                      /*    665 */
+        &&PC_666,                      /*    666 */
+        &&PC_667,                      /*    667 */
+        &&PC_668,                      /*    668 */
+        &&PC_669,                      /*    669 */
+        &&PC_670,                      /*    670 */
+        &&PC_671,                      /*    671 */
+        &&PC_672,                      /*    672 */
+        &&PC_673,                      /*    673 */
+        &&PC_674,                      /*    674 */
+        &&PC_675,                      /*    675 */
+        &&PC_676,                      /*    676 */
+        &&PC_677,                      /*    677 */
+        &&PC_678,                      /*    678 */
+        &&PC_679,                      /*    679 */
+        &&PC_680,                      /*    680 */
+        &&PC_681,                      /*    681 */
+        &&PC_682,                      /*    682 */
+        &&PC_683,                      /*    683 */
+        &&PC_684,                      /*    684 */
+        &&PC_685,                      /*    685 */
+        &&PC_686,                      /*    686 */
+        &&PC_687,                      /*    687 */
+        &&PC_688,                      /*    688 */
+        &&PC_689,                      /*    689 */
+        &&PC_690,                      /*    690 */
+        &&PC_691,                      /*    691 */
+        &&PC_692,                      /*    692 */
+        &&PC_693,                      /*    693 */
+        &&PC_694,                      /*    694 */
+        &&PC_695,                      /*    695 */
+        &&PC_696,                      /*    696 */
+        &&PC_697,                      /*    697 */
+        &&PC_698,                      /*    698 */
+        &&PC_699,                      /*    699 */
+        &&PC_700,                      /*    700 */
+        &&PC_701,                      /*    701 */
+        &&PC_702,                      /*    702 */
+        &&PC_703,                      /*    703 */
+        &&PC_704,                      /*    704 */
+        &&PC_705,                      /*    705 */
+        &&PC_706,                      /*    706 */
+        &&PC_707,                      /*    707 */
+        &&PC_708,                      /*    708 */
+        &&PC_709,                      /*    709 */
+        &&PC_710,                      /*    710 */
+        &&PC_711,                      /*    711 */
+        &&PC_712,                      /*    712 */
+        &&PC_713,                      /*    713 */
+        &&PC_714,                      /*    714 */
+        &&PC_715,                      /*    715 */
+        &&PC_716,                      /*    716 */
+        &&PC_717,                      /*    717 */
+        &&PC_718,                      /*    718 */
+        &&PC_719,                      /*    719 */
+        &&PC_720,                      /*    720 */
+        &&PC_721,                      /*    721 */
+        &&PC_722,                      /*    722 */
+        &&PC_723,                      /*    723 */
+        &&PC_724,                      /*    724 */
+        &&PC_725,                      /*    725 */
+        &&PC_726,                      /*    726 */
+        &&PC_727,                      /*    727 */
+        &&PC_728,                      /*    728 */
+        &&PC_729,                      /*    729 */
+        &&PC_730,                      /*    730 */
+        &&PC_731,                      /*    731 */
+        &&PC_732,                      /*    732 */
+        &&PC_733,                      /*    733 */
+        &&PC_734,                      /*    734 */
+        &&PC_735,                      /*    735 */
+        &&PC_736,                      /*    736 */
+        &&PC_737,                      /*    737 */
+        &&PC_738,                      /*    738 */
+        &&PC_739,                      /*    739 */
+        &&PC_740,                      /*    740 */
+        &&PC_741,                      /*    741 */
+        &&PC_742,                      /*    742 */
+        &&PC_743,                      /*    743 */
+        &&PC_744,                      /*    744 */
+        &&PC_745,                      /*    745 */
+        &&PC_746,                      /*    746 */
+        &&PC_747,                      /*    747 */
+        &&PC_748,                      /*    748 */
+        &&PC_749,                      /*    749 */
+        &&PC_750,                      /*    750 */
+        &&PC_751,                      /*    751 */
+        &&PC_752,                      /*    752 */
+        &&PC_753,                      /*    753 */
+        &&PC_754,                      /*    754 */
+        &&PC_755,                      /*    755 */
+        &&PC_756,                      /*    756 */
+        &&PC_757,                      /*    757 */
+        &&PC_758,                      /*    758 */
+        &&PC_759,                      /*    759 */
+        &&PC_760,                      /*    760 */
+        &&PC_761,                      /*    761 */
+        &&PC_762,                      /*    762 */
+        &&PC_763,                      /*    763 */
+        &&PC_764,                      /*    764 */
+        &&PC_765,                      /*    765 */
+        &&PC_766,                      /*    766 */
+        &&PC_767,                      /*    767 */
+        &&PC_768,                      /*    768 */
+        &&PC_769,                      /*    769 */
+        &&PC_770,                      /*    770 */
+        &&PC_771,                      /*    771 */
+        &&PC_772,                      /*    772 */
+        &&PC_773,                      /*    773 */
+        &&PC_774,                      /*    774 */
+        &&PC_775,                      /*    775 */
+        &&PC_776,                      /*    776 */
+        &&PC_777,                      /*    777 */
+        &&PC_778,                      /*    778 */
+        &&PC_779,                      /*    779 */
+        &&PC_780,                      /*    780 */
+        &&PC_781,                      /*    781 */
+        &&PC_782,                      /*    782 */
+        &&PC_783,                      /*    783 */
+        &&PC_784,                      /*    784 */
+        &&PC_785,                      /*    785 */
+        &&PC_786,                      /*    786 */
+        &&PC_787,                      /*    787 */
+        &&PC_788,                      /*    788 */
+        &&PC_789,                      /*    789 */
+        &&PC_790,                      /*    790 */
+        &&PC_791,                      /*    791 */
+        &&PC_792,                      /*    792 */
+        &&PC_793,                      /*    793 */
+        &&PC_794,                      /*    794 */
+        &&PC_795,                      /*    795 */
+        &&PC_796,                      /*    796 */
+        &&PC_797,                      /*    797 */
+        &&PC_798,                      /*    798 */
+        &&PC_799,                      /*    799 */
+        &&PC_800,                      /*    800 */
+        &&PC_801,                      /*    801 */
+        &&PC_802,                      /*    802 */
+        &&PC_803,                      /*    803 */
+        &&PC_804,                      /*    804 */
+        &&PC_805,                      /*    805 */
+        &&PC_806,                      /*    806 */
+        &&PC_807,                      /*    807 */
+        &&PC_808,                      /*    808 */
+        &&PC_809,                      /*    809 */
+        &&PC_810,                      /*    810 */
+        &&PC_811,                      /*    811 */
+        &&PC_812,                      /*    812 */
+        &&PC_813,                      /*    813 */
+        &&PC_814,                      /*    814 */
+        &&PC_815,                      /*    815 */
+        &&PC_816,                      /*    816 */
+        &&PC_817,                      /*    817 */
+        &&PC_818,                      /*    818 */
+        &&PC_819,                      /*    819 */
+        &&PC_820,                      /*    820 */
+        &&PC_821,                      /*    821 */
+        &&PC_822,                      /*    822 */
+        &&PC_823,                      /*    823 */
+        &&PC_824,                      /*    824 */
+        &&PC_825,                      /*    825 */
+        &&PC_826,                      /*    826 */
+        &&PC_827,                      /*    827 */
+        &&PC_828,                      /*    828 */
+        &&PC_829,                      /*    829 */
+        &&PC_830,                      /*    830 */
+        &&PC_831,                      /*    831 */
+        &&PC_832,                      /*    832 */
+        &&PC_833,                      /*    833 */
+        &&PC_834,                      /*    834 */
+        &&PC_835,                      /*    835 */
+        &&PC_836,                      /*    836 */
+        &&PC_837,                      /*    837 */
+        &&PC_838,                      /*    838 */
+        &&PC_839,                      /*    839 */
+        &&PC_840,                      /*    840 */
+        &&PC_841,                      /*    841 */
+        &&PC_842,                      /*    842 */
+        &&PC_843,                      /*    843 */
+        &&PC_844,                      /*    844 */
+        &&PC_845,                      /*    845 */
+        &&PC_846,                      /*    846 */
+        &&PC_847,                      /*    847 */
+        &&PC_848,                      /*    848 */
+        &&PC_849,                      /*    849 */
+        &&PC_850,                      /*    850 */
+        &&PC_851,                      /*    851 */
+        &&PC_852,                      /*    852 */
+        &&PC_853,                      /*    853 */
+        &&PC_854,                      /*    854 */
+        &&PC_855,                      /*    855 */
+        &&PC_856,                      /*    856 */
+        &&PC_857,                      /*    857 */
+        &&PC_858,                      /*    858 */
+        &&PC_859,                      /*    859 */
+        &&PC_860,                      /*    860 */
+        &&PC_861,                      /*    861 */
+        &&PC_862,                      /*    862 */
+        &&PC_863,                      /*    863 */
+        &&PC_864,                      /*    864 */
+        &&PC_865,                      /*    865 */
+        &&PC_866,                      /*    866 */
+        &&PC_867,                      /*    867 */
+        &&PC_868,                      /*    868 */
+        &&PC_869,                      /*    869 */
+        &&PC_870,                      /*    870 */
+        &&PC_871,                      /*    871 */
+        &&PC_872,                      /*    872 */
+        &&PC_873,                      /*    873 */
+        &&PC_874,                      /*    874 */
+        &&PC_875,                      /*    875 */
+        &&PC_876,                      /*    876 */
+        &&PC_877,                      /*    877 */
+        &&PC_878,                      /*    878 */
+        &&PC_879,                      /*    879 */
+        &&PC_880,                      /*    880 */
+        &&PC_881,                      /*    881 */
+        &&PC_882,                      /*    882 */
+        &&PC_883,                      /*    883 */
+        &&PC_884,                      /*    884 */
+        &&PC_885,                      /*    885 */
+        &&PC_886,                      /*    886 */
+        &&PC_887,                      /*    887 */
+        &&PC_888,                      /*    888 */
+        &&PC_889,                      /*    889 */
+        &&PC_890,                      /*    890 */
+        &&PC_891,                      /*    891 */
+        &&PC_892,                      /*    892 */
+        &&PC_893,                      /*    893 */
+        &&PC_894,                      /*    894 */
+        &&PC_895,                      /*    895 */
+        &&PC_896,                      /*    896 */
+        &&PC_897,                      /*    897 */
+        &&PC_898,                      /*    898 */
+        &&PC_899,                      /*    899 */
+        &&PC_900,                      /*    900 */
+        &&PC_901,                      /*    901 */
+        &&PC_902,                      /*    902 */
+        &&PC_903,                      /*    903 */
+        &&PC_904,                      /*    904 */
+        &&PC_905,                      /*    905 */
+        &&PC_906,                      /*    906 */
+        &&PC_907,                      /*    907 */
+        &&PC_908,                      /*    908 */
+        &&PC_909,                      /*    909 */
+        &&PC_910,                      /*    910 */
+        &&PC_911,                      /*    911 */
+        &&PC_912,                      /*    912 */
+        &&PC_913,                      /*    913 */
+        &&PC_914,                      /*    914 */
+        &&PC_915,                      /*    915 */
+        &&PC_916,                      /*    916 */
+        &&PC_917,                      /*    917 */
+        &&PC_918,                      /*    918 */
+        &&PC_919,                      /*    919 */
+        &&PC_920,                      /*    920 */
+        &&PC_921,                      /*    921 */
+        &&PC_922,                      /*    922 */
+        &&PC_923,                      /*    923 */
+        &&PC_924,                      /*    924 */
+        &&PC_925,                      /*    925 */
+        &&PC_926,                      /*    926 */
+        &&PC_927,                      /*    927 */
+        &&PC_928,                      /*    928 */
+        &&PC_929,                      /*    929 */
+        &&PC_930,                      /*    930 */
+        &&PC_931,                      /*    931 */
+        &&PC_932,                      /*    932 */
+        &&PC_933,                      /*    933 */
+        &&PC_934,                      /*    934 */
+        &&PC_935,                      /*    935 */
+        &&PC_936,                      /*    936 */
+        &&PC_937,                      /*    937 */
+        &&PC_938,                      /*    938 */
+        &&PC_939,                      /*    939 */
+        &&PC_940,                      /*    940 */
+        &&PC_941,                      /*    941 */
+        &&PC_942,                      /*    942 */
+        &&PC_943,                      /*    943 */
+        &&PC_944,                      /*    944 */
+        &&PC_945,                      /*    945 */
+        &&PC_946,                      /*    946 */
+        &&PC_947,                      /*    947 */
+        &&PC_948,                      /*    948 */
+        &&PC_949,                      /*    949 */
+        &&PC_950,                      /*    950 */
+        &&PC_951,                      /*    951 */
+        &&PC_952,                      /*    952 */
+        &&PC_953,                      /*    953 */
+        &&PC_954,                      /*    954 */
+        &&PC_955,                      /*    955 */
+        &&PC_956,                      /*    956 */
+        &&PC_957,                      /*    957 */
+        &&PC_958,                      /*    958 */
+        &&PC_959,                      /*    959 */
+        &&PC_960,                      /*    960 */
+        &&PC_961,                      /*    961 */
+        &&PC_962,                      /*    962 */
+        &&PC_963,                      /*    963 */
+        &&PC_964,                      /*    964 */
+        &&PC_965,                      /*    965 */
+        &&PC_966,                      /*    966 */
+        &&PC_967,                      /*    967 */
+        &&PC_968,                      /*    968 */
+        &&PC_969,                      /*    969 */
+        &&PC_970,                      /*    970 */
+        &&PC_971,                      /*    971 */
+        &&PC_972,                      /*    972 */
+        &&PC_973,                      /*    973 */
+        &&PC_974,                      /*    974 */
+        &&PC_975,                      /*    975 */
+        &&PC_976,                      /*    976 */
+        &&PC_977,                      /*    977 */
+        &&PC_978,                      /*    978 */
+        &&PC_979,                      /*    979 */
+        &&PC_980,                      /*    980 */
+        &&PC_981,                      /*    981 */
+        &&PC_982,                      /*    982 */
+        &&PC_983,                      /*    983 */
+        &&PC_984,                      /*    984 */
+        &&PC_985,                      /*    985 */
+        &&PC_986,                      /*    986 */
+        &&PC_987,                      /*    987 */
+        &&PC_988,                      /*    988 */
+        &&PC_989,                      /*    989 */
+        &&PC_990,                      /*    990 */
+        &&PC_991,                      /*    991 */
+        &&PC_992,                      /*    992 */
+        &&PC_993,                      /*    993 */
+        &&PC_994,                      /*    994 */
+        &&PC_995,                      /*    995 */
+        &&PC_996,                      /*    996 */
+        &&PC_997,                      /*    997 */
+        &&PC_998,                      /*    998 */
+        &&PC_999,                      /*    999 */
+        &&PC_1000,                     /*   1000 */
+        &&PC_1001,                     /*   1001 */
+        &&PC_1002,                     /*   1002 */
+        &&PC_1003,                     /*   1003 */
+        &&PC_1004,                     /*   1004 */
+        &&PC_1005,                     /*   1005 */
+        &&PC_1006,                     /*   1006 */
+        &&PC_1007,                     /*   1007 */
+        &&PC_1008,                     /*   1008 */
+        &&PC_1009,                     /*   1009 */
+        &&PC_1010,                     /*   1010 */
+        &&PC_1011,                     /*   1011 */
+        &&PC_1012,                     /*   1012 */
+        &&PC_1013,                     /*   1013 */
+        &&PC_1014,                     /*   1014 */
+        &&PC_1015,                     /*   1015 */
+        &&PC_1016,                     /*   1016 */
+        &&PC_1017,                     /*   1017 */
+        &&PC_1018,                     /*   1018 */
+        &&PC_1019,                     /*   1019 */
+        &&PC_1020,                     /*   1020 */
+        &&PC_1021,                     /*   1021 */
+        &&PC_1022,                     /*   1022 */
+        &&PC_1023,                     /*   1023 */
+        &&PC_1024,                     /*   1024 */
+        &&PC_1025,                     /*   1025 */
+        &&PC_1026,                     /*   1026 */
+        &&PC_1027,                     /*   1027 */
+        &&PC_1028,                     /*   1028 */
+        &&PC_1029,                     /*   1029 */
+        &&PC_1030,                     /*   1030 */
+        &&PC_1031,                     /*   1031 */
+        &&PC_1032,                     /*   1032 */
+        &&PC_1033,                     /*   1033 */
+        &&PC_1034,                     /*   1034 */
+        &&PC_1035,                     /*   1035 */
+        &&PC_1036,                     /*   1036 */
+        &&PC_1037,                     /*   1037 */
+        &&PC_1038,                     /*   1038 */
+        &&PC_1039,                     /*   1039 */
+        &&PC_1040,                     /*   1040 */
+        &&PC_1041,                     /*   1041 */
+        &&PC_1042,                     /*   1042 */
+        &&PC_1043,                     /*   1043 */
+        &&PC_1044,                     /*   1044 */
+        &&PC_1045,                     /*   1045 */
+        &&PC_1046,                     /*   1046 */
+        &&PC_1047,                     /*   1047 */
+        &&PC_1048,                     /*   1048 */
+        &&PC_1049,                     /*   1049 */
+        &&PC_1050,                     /*   1050 */
+        &&PC_1051,                     /*   1051 */
+        &&PC_1052,                     /*   1052 */
+        &&PC_1053,                     /*   1053 */
+        &&PC_1054,                     /*   1054 */
+        &&PC_1055,                     /*   1055 */
+        &&PC_1056,                     /*   1056 */
+        &&PC_1057,                     /*   1057 */
+        &&PC_1058,                     /*   1058 */
+        &&PC_1059,                     /*   1059 */
+        &&PC_1060,                     /*   1060 */
+        &&PC_1061,                     /*   1061 */
+        &&PC_1062,                     /*   1062 */
+        &&PC_1063,                     /*   1063 */
+        &&PC_1064,                     /*   1064 */
+        &&PC_1065,                     /*   1065 */
+        &&PC_1066,                     /*   1066 */
+        &&PC_1067,                     /*   1067 */
+        &&PC_1068,                     /*   1068 */
+        &&PC_1069,                     /*   1069 */
+        &&PC_1070,                     /*   1070 */
+        &&PC_1071,                     /*   1071 */
+        &&PC_1072,                     /*   1072 */
+        &&PC_1073,                     /*   1073 */
+        &&PC_1074,                     /*   1074 */
+        &&PC_1075,                     /*   1075 */
+        &&PC_1076,                     /*   1076 */
+        &&PC_1077,                     /*   1077 */
+        &&PC_1078,                     /*   1078 */
+        &&PC_1079,                     /*   1079 */
+        &&PC_1080,                     /*   1080 */
+        &&PC_1081,                     /*   1081 */
+        &&PC_1082,                     /*   1082 */
+        &&PC_1083,                     /*   1083 */
+        &&PC_1084,                     /*   1084 */
+        &&PC_1085,                     /*   1085 */
+        &&PC_1086,                     /*   1086 */
+        &&PC_1087,                     /*   1087 */
+        &&PC_1088,                     /*   1088 */
+        &&PC_1089,                     /*   1089 */
+        &&PC_1090,                     /*   1090 */
+        &&PC_1091,                     /*   1091 */
+        &&PC_1092,                     /*   1092 */
+        &&PC_1093,                     /*   1093 */
+        &&PC_1094,                     /*   1094 */
+        &&PC_1095,                     /*   1095 */
+        &&PC_1096,                     /*   1096 */
+        &&PC_1097,                     /*   1097 */
+        &&PC_1098,                     /*   1098 */
+        &&PC_1099,                     /*   1099 */
+        &&PC_1100,                     /*   1100 */
+        &&PC_1101,                     /*   1101 */
+        &&PC_1102,                     /*   1102 */
+        &&PC_1103,                     /*   1103 */
+        &&PC_1104,                     /*   1104 */
+        &&PC_1105,                     /*   1105 */
+        &&PC_1106,                     /*   1106 */
+        &&PC_1107,                     /*   1107 */
+        &&PC_1108,                     /*   1108 */
+        &&PC_1109,                     /*   1109 */
+        &&PC_1110,                     /*   1110 */
+        &&PC_1111,                     /*   1111 */
+        &&PC_1112,                     /*   1112 */
+        &&PC_1113,                     /*   1113 */
+        &&PC_1114,                     /*   1114 */
+        &&PC_1115,                     /*   1115 */
+        &&PC_1116,                     /*   1116 */
+        &&PC_1117,                     /*   1117 */
+        &&PC_1118,                     /*   1118 */
+        &&PC_1119,                     /*   1119 */
+        &&PC_1120,                     /*   1120 */
+        &&PC_1121,                     /*   1121 */
+        &&PC_1122,                     /*   1122 */
+        &&PC_1123,                     /*   1123 */
+        &&PC_1124,                     /*   1124 */
+        &&PC_1125,                     /*   1125 */
+        &&PC_1126,                     /*   1126 */
+        &&PC_1127,                     /*   1127 */
+        &&PC_1128,                     /*   1128 */
+        &&PC_1129,                     /*   1129 */
+        &&PC_1130,                     /*   1130 */
+        &&PC_1131,                     /*   1131 */
+        &&PC_1132,                     /*   1132 */
+        NULL
+    };
+
+    op_lib_t * const   core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+    PackFile_ByteCode *cg_seg   = interp->code;
+    opcode_t          *cg_base  = cg_seg->base.data;
+    void             **cg_code  = core_cg_load_segment(interp, cg_seg, &&CG_TRANSLATE);
+
+    CG_DISPATCH();
+
+  CG_BRANCH:
+    /* Absolute jump; the target may live in another segment or be the end. */
+    if (!cur_opcode)
+        return NULL;
+
+    if (cg_seg != interp->code) {
+        cg_seg  = interp->code;
+        cg_base = cg_seg->base.data;
+        cg_code = core_cg_load_segment(interp, cg_seg, &&CG_TRANSLATE);
+    }
+
+    CG_DISPATCH();
+
+  CG_TRANSLATE:
+    /* While event checking, ops run through the swapped function table. */
+    if (cg_seg->save_func_table)
+        goto CG_FUNCTION;
+
+    /* First execution of the op at this offset: bind its label. */
+    {
+        const op_info_t * const info  = cg_seg->op_info_table[*cur_opcode];
+        void            * const label = info->lib == core_lib
+                                      ? ops_addr[info - core_lib->op_info_table]
+                                      : &&CG_FUNCTION;
+
+        cg_code[cur_opcode - cg_base] = label;
+        goto *label;
+    }
+
+  CG_FUNCTION:
+    /* Ops from dynamic oplibs, and every op while event checking, are
+     * dispatched through the function table. */
+    CG_SYNC_PC();
+    CG_JUMP((cg_seg->op_func_table[*cur_opcode])(cur_opcode, interp));
+
+  PC_0: /* end */
+{
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    CG_JUMP((opcode_t *)0);
+}
+  PC_1: /* noop */
+{
+    UNUSED(interp);
+    CG_NEXT(cur_opcode + 1);
+}
+  PC_2: /* check_events */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_check_events(cur_opcode, interp));
+
+  PC_3: /* check_events__ */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_check_events__(cur_opcode, interp));
+
+  PC_4: /* load_bytecode_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_load_bytecode_s(cur_opcode, interp));
+
+  PC_5: /* load_bytecode_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_load_bytecode_sc(cur_opcode, interp));
+
+  PC_6: /* load_bytecode_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_load_bytecode_p_s(cur_opcode, interp));
+
+  PC_7: /* load_bytecode_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_load_bytecode_p_sc(cur_opcode, interp));
+
+  PC_8: /* load_language_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_load_language_s(cur_opcode, interp));
+
+  PC_9: /* load_language_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_load_language_sc(cur_opcode, interp));
+
+  PC_10: /* branch_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_branch_i(cur_opcode, interp));
+
+  PC_11: /* branch_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_branch_ic(cur_opcode, interp));
+
+  PC_12: /* local_branch_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_local_branch_p_i(cur_opcode, interp));
+
+  PC_13: /* local_branch_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_local_branch_p_ic(cur_opcode, interp));
+
+  PC_14: /* local_return_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_local_return_p(cur_opcode, interp));
+
+  PC_15: /* jump_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_jump_i(cur_opcode, interp));
+
+  PC_16: /* jump_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_jump_ic(cur_opcode, interp));
+
+  PC_17: /* if_i_ic */
+{
+    if (IREG(1) != 0) {
+        CG_NEXT(cur_opcode + ICONST(2));
+    }
+
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_18: /* if_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_if_n_ic(cur_opcode, interp));
+
+  PC_19: /* if_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_if_s_ic(cur_opcode, interp));
+
+  PC_20: /* if_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_if_p_ic(cur_opcode, interp));
+
+  PC_21: /* unless_i_ic */
+{
+    if (IREG(1) == 0) {
+        CG_NEXT(cur_opcode + ICONST(2));
+    }
+
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_22: /* unless_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unless_n_ic(cur_opcode, interp));
+
+  PC_23: /* unless_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unless_s_ic(cur_opcode, interp));
+
+  PC_24: /* unless_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unless_p_ic(cur_opcode, interp));
+
+  PC_25: /* invokecc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_invokecc_p(cur_opcode, interp));
+
+  PC_26: /* invoke_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_invoke_p_p(cur_opcode, interp));
+
+  PC_27: /* yield */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_yield(cur_opcode, interp));
+
+  PC_28: /* tailcall_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_tailcall_p(cur_opcode, interp));
+
+  PC_29: /* returncc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_returncc(cur_opcode, interp));
+
+  PC_30: /* capture_lex_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_capture_lex_p(cur_opcode, interp));
+
+  PC_31: /* newclosure_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_newclosure_p_p(cur_opcode, interp));
+
+  PC_32: /* set_args_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_args_pc(cur_opcode, interp));
+
+  PC_33: /* get_params_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_params_pc(cur_opcode, interp));
+
+  PC_34: /* set_returns_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_returns_pc(cur_opcode, interp));
+
+  PC_35: /* get_results_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_results_pc(cur_opcode, interp));
+
+  PC_36: /* set_result_info_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_result_info_p(cur_opcode, interp));
+
+  PC_37: /* set_result_info_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_result_info_pc(cur_opcode, interp));
+
+  PC_38: /* result_info_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_result_info_p(cur_opcode, interp));
+
+  PC_39: /* set_addr_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_addr_i_ic(cur_opcode, interp));
+
+  PC_40: /* set_addr_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_addr_p_ic(cur_opcode, interp));
+
+  PC_41: /* set_addr_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_addr_p_i(cur_opcode, interp));
+
+  PC_42: /* get_addr_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_addr_i_p(cur_opcode, interp));
+
+  PC_43: /* schedule_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_schedule_p(cur_opcode, interp));
+
+  PC_44: /* schedule_local_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_schedule_local_p(cur_opcode, interp));
+
+  PC_45: /* addhandler_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addhandler_p(cur_opcode, interp));
+
+  PC_46: /* push_eh_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_eh_ic(cur_opcode, interp));
+
+  PC_47: /* push_eh_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_eh_p(cur_opcode, interp));
+
+  PC_48: /* pop_eh */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_eh(cur_opcode, interp));
+
+  PC_49: /* throw_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_throw_p(cur_opcode, interp));
+
+  PC_50: /* throw_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_throw_p_p(cur_opcode, interp));
+
+  PC_51: /* rethrow_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rethrow_p(cur_opcode, interp));
+
+  PC_52: /* count_eh_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_count_eh_i(cur_opcode, interp));
+
+  PC_53: /* die_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_s(cur_opcode, interp));
+
+  PC_54: /* die_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_sc(cur_opcode, interp));
+
+  PC_55: /* die_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_p(cur_opcode, interp));
+
+  PC_56: /* die_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_pc(cur_opcode, interp));
+
+  PC_57: /* die_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_i_i(cur_opcode, interp));
+
+  PC_58: /* die_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_ic_i(cur_opcode, interp));
+
+  PC_59: /* die_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_i_ic(cur_opcode, interp));
+
+  PC_60: /* die_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_die_ic_ic(cur_opcode, interp));
+
+  PC_61: /* exit_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_exit_i(cur_opcode, interp));
+
+  PC_62: /* exit_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_exit_ic(cur_opcode, interp));
+
+  PC_63: /* finalize_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_finalize_p(cur_opcode, interp));
+
+  PC_64: /* finalize_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_finalize_pc(cur_opcode, interp));
+
+  PC_65: /* pop_upto_eh_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_upto_eh_p(cur_opcode, interp));
+
+  PC_66: /* pop_upto_eh_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_upto_eh_pc(cur_opcode, interp));
+
+  PC_67: /* peek_exception_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_peek_exception_p(cur_opcode, interp));
+
+  PC_68: /* debug_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_debug_i(cur_opcode, interp));
+
+  PC_69: /* debug_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_debug_ic(cur_opcode, interp));
+
+  PC_70: /* bounds_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_bounds_i(cur_opcode, interp));
+
+  PC_71: /* bounds_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_bounds_ic(cur_opcode, interp));
+
+  PC_72: /* profile_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_profile_i(cur_opcode, interp));
+
+  PC_73: /* profile_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_profile_ic(cur_opcode, interp));
+
+  PC_74: /* trace_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trace_i(cur_opcode, interp));
+
+  PC_75: /* trace_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trace_ic(cur_opcode, interp));
+
+  PC_76: /* gc_debug_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gc_debug_i(cur_opcode, interp));
+
+  PC_77: /* gc_debug_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gc_debug_ic(cur_opcode, interp));
+
+  PC_78: /* interpinfo_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_interpinfo_i_i(cur_opcode, interp));
+
+  PC_79: /* interpinfo_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_interpinfo_i_ic(cur_opcode, interp));
+
+  PC_80: /* interpinfo_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_interpinfo_p_i(cur_opcode, interp));
+
+  PC_81: /* interpinfo_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_interpinfo_p_ic(cur_opcode, interp));
+
+  PC_82: /* interpinfo_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_interpinfo_s_i(cur_opcode, interp));
+
+  PC_83: /* interpinfo_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_interpinfo_s_ic(cur_opcode, interp));
+
+  PC_84: /* warningson_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_warningson_i(cur_opcode, interp));
+
+  PC_85: /* warningson_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_warningson_ic(cur_opcode, interp));
+
+  PC_86: /* warningsoff_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_warningsoff_i(cur_opcode, interp));
+
+  PC_87: /* warningsoff_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_warningsoff_ic(cur_opcode, interp));
+
+  PC_88: /* errorson_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_errorson_i(cur_opcode, interp));
+
+  PC_89: /* errorson_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_errorson_ic(cur_opcode, interp));
+
+  PC_90: /* errorsoff_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_errorsoff_i(cur_opcode, interp));
+
+  PC_91: /* errorsoff_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_errorsoff_ic(cur_opcode, interp));
+
+  PC_92: /* set_runcore_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_runcore_s(cur_opcode, interp));
+
+  PC_93: /* set_runcore_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_runcore_sc(cur_opcode, interp));
+
+  PC_94: /* runinterp_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_runinterp_p_i(cur_opcode, interp));
+
+  PC_95: /* runinterp_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_runinterp_p_ic(cur_opcode, interp));
+
+  PC_96: /* getinterp_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getinterp_p(cur_opcode, interp));
+
+  PC_97: /* sweep_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sweep_ic(cur_opcode, interp));
+
+  PC_98: /* collect */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_collect(cur_opcode, interp));
+
+  PC_99: /* sweepoff */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sweepoff(cur_opcode, interp));
+
+  PC_100: /* sweepon */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sweepon(cur_opcode, interp));
+
+  PC_101: /* collectoff */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_collectoff(cur_opcode, interp));
+
+  PC_102: /* collecton */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_collecton(cur_opcode, interp));
+
+  PC_103: /* needs_destroy_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_needs_destroy_p(cur_opcode, interp));
+
+  PC_104: /* loadlib_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_loadlib_p_s(cur_opcode, interp));
+
+  PC_105: /* loadlib_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_loadlib_p_sc(cur_opcode, interp));
+
+  PC_106: /* loadlib_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_loadlib_p_s_p(cur_opcode, interp));
+
+  PC_107: /* loadlib_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_loadlib_p_sc_p(cur_opcode, interp));
+
+  PC_108: /* loadlib_p_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_loadlib_p_s_pc(cur_opcode, interp));
+
+  PC_109: /* loadlib_p_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_loadlib_p_sc_pc(cur_opcode, interp));
+
+  PC_110: /* dlfunc_p_p_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlfunc_p_p_s_s(cur_opcode, interp));
+
+  PC_111: /* dlfunc_p_p_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlfunc_p_p_sc_s(cur_opcode, interp));
+
+  PC_112: /* dlfunc_p_p_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlfunc_p_p_s_sc(cur_opcode, interp));
+
+  PC_113: /* dlfunc_p_p_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlfunc_p_p_sc_sc(cur_opcode, interp));
+
+  PC_114: /* dlfunc_p_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlfunc_p_p_s_p(cur_opcode, interp));
+
+  PC_115: /* dlfunc_p_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlfunc_p_p_sc_p(cur_opcode, interp));
+
+  PC_116: /* dlvar_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlvar_p_p_s(cur_opcode, interp));
+
+  PC_117: /* dlvar_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dlvar_p_p_sc(cur_opcode, interp));
+
+  PC_118: /* compreg_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_compreg_s_p(cur_opcode, interp));
+
+  PC_119: /* compreg_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_compreg_sc_p(cur_opcode, interp));
+
+  PC_120: /* compreg_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_compreg_p_s(cur_opcode, interp));
+
+  PC_121: /* compreg_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_compreg_p_sc(cur_opcode, interp));
+
+  PC_122: /* new_callback_p_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_callback_p_p_p_s(cur_opcode, interp));
+
+  PC_123: /* new_callback_p_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_callback_p_p_p_sc(cur_opcode, interp));
+
+  PC_124: /* annotations_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_annotations_p(cur_opcode, interp));
+
+  PC_125: /* annotations_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_annotations_p_s(cur_opcode, interp));
+
+  PC_126: /* annotations_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_annotations_p_sc(cur_opcode, interp));
+
+  PC_127: /* band_i_i */
+{
+    (IREG(1) &= IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_128: /* band_i_ic */
+{
+    (IREG(1) &= ICONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_129: /* band_i_i_i */
+{
+    IREG(1) = (IREG(2) & IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_130: /* band_i_ic_i */
+{
+    IREG(1) = (ICONST(2) & IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_131: /* band_i_i_ic */
+{
+    IREG(1) = (IREG(2) & ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_132: /* bor_i_i */
+{
+    (IREG(1) |= IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_133: /* bor_i_ic */
+{
+    (IREG(1) |= ICONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_134: /* bor_i_i_i */
+{
+    IREG(1) = (IREG(2) | IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_135: /* bor_i_ic_i */
+{
+    IREG(1) = (ICONST(2) | IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_136: /* bor_i_i_ic */
+{
+    IREG(1) = (IREG(2) | ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_137: /* shl_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shl_i_i(cur_opcode, interp));
+
+  PC_138: /* shl_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shl_i_ic(cur_opcode, interp));
+
+  PC_139: /* shl_i_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shl_i_i_i(cur_opcode, interp));
+
+  PC_140: /* shl_i_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shl_i_ic_i(cur_opcode, interp));
+
+  PC_141: /* shl_i_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shl_i_i_ic(cur_opcode, interp));
+
+  PC_142: /* shr_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shr_i_i(cur_opcode, interp));
+
+  PC_143: /* shr_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shr_i_ic(cur_opcode, interp));
+
+  PC_144: /* shr_i_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shr_i_i_i(cur_opcode, interp));
+
+  PC_145: /* shr_i_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shr_i_ic_i(cur_opcode, interp));
+
+  PC_146: /* shr_i_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shr_i_i_ic(cur_opcode, interp));
+
+  PC_147: /* lsr_i_i */
+{
+    const UINTVAL   a = (UINTVAL)IREG(1);
+    const UINTVAL   b = (a >> IREG(2));
+
+    IREG(1) = (INTVAL)b;
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_148: /* lsr_i_ic */
+{
+    const UINTVAL   a = (UINTVAL)IREG(1);
+    const UINTVAL   b = (a >> ICONST(2));
+
+    IREG(1) = (INTVAL)b;
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_149: /* lsr_i_i_i */
+{
+    IREG(1) = (INTVAL)(((UINTVAL)IREG(2) >> IREG(3)));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_150: /* lsr_i_ic_i */
+{
+    IREG(1) = (INTVAL)(((UINTVAL)ICONST(2) >> IREG(3)));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_151: /* lsr_i_i_ic */
+{
+    IREG(1) = (INTVAL)(((UINTVAL)IREG(2) >> ICONST(3)));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_152: /* bxor_i_i */
+{
+    (IREG(1) ^= IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_153: /* bxor_i_ic */
+{
+    (IREG(1) ^= ICONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_154: /* bxor_i_i_i */
+{
+    IREG(1) = (IREG(2) ^ IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_155: /* bxor_i_ic_i */
+{
+    IREG(1) = (ICONST(2) ^ IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_156: /* bxor_i_i_ic */
+{
+    IREG(1) = (IREG(2) ^ ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_157: /* eq_i_i_ic */
+{
+    if (IREG(1) == IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_158: /* eq_ic_i_ic */
+{
+    if (ICONST(1) == IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_159: /* eq_i_ic_ic */
+{
+    if (IREG(1) == ICONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_160: /* eq_n_n_ic */
+{
+    if (NREG(1) == NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_161: /* eq_nc_n_ic */
+{
+    if (NCONST(1) == NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_162: /* eq_n_nc_ic */
+{
+    if (NREG(1) == NCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_163: /* eq_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_s_s_ic(cur_opcode, interp));
+
+  PC_164: /* eq_sc_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_sc_s_ic(cur_opcode, interp));
+
+  PC_165: /* eq_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_s_sc_ic(cur_opcode, interp));
+
+  PC_166: /* eq_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_p_ic(cur_opcode, interp));
+
+  PC_167: /* eq_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_i_ic(cur_opcode, interp));
+
+  PC_168: /* eq_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_ic_ic(cur_opcode, interp));
+
+  PC_169: /* eq_p_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_n_ic(cur_opcode, interp));
+
+  PC_170: /* eq_p_nc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_nc_ic(cur_opcode, interp));
+
+  PC_171: /* eq_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_s_ic(cur_opcode, interp));
+
+  PC_172: /* eq_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_p_sc_ic(cur_opcode, interp));
+
+  PC_173: /* eq_str_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_str_p_p_ic(cur_opcode, interp));
+
+  PC_174: /* eq_num_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_eq_num_p_p_ic(cur_opcode, interp));
+
+  PC_175: /* eq_addr_s_s_ic */
+{
+    if (SREG(1) == SREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_176: /* eq_addr_sc_s_ic */
+{
+    if (SCONST(1) == SREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_177: /* eq_addr_s_sc_ic */
+{
+    if (SREG(1) == SCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_178: /* eq_addr_sc_sc_ic */
+{
+    if (SCONST(1) == SCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_179: /* eq_addr_p_p_ic */
+{
+    if (PREG(1) == PREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_180: /* ne_i_i_ic */
+{
+    if (IREG(1) != IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_181: /* ne_ic_i_ic */
+{
+    if (ICONST(1) != IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_182: /* ne_i_ic_ic */
+{
+    if (IREG(1) != ICONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_183: /* ne_n_n_ic */
+{
+    if (NREG(1) != NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_184: /* ne_nc_n_ic */
+{
+    if (NCONST(1) != NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_185: /* ne_n_nc_ic */
+{
+    if (NREG(1) != NCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_186: /* ne_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_s_s_ic(cur_opcode, interp));
+
+  PC_187: /* ne_sc_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_sc_s_ic(cur_opcode, interp));
+
+  PC_188: /* ne_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_s_sc_ic(cur_opcode, interp));
+
+  PC_189: /* ne_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_p_ic(cur_opcode, interp));
+
+  PC_190: /* ne_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_i_ic(cur_opcode, interp));
+
+  PC_191: /* ne_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_ic_ic(cur_opcode, interp));
+
+  PC_192: /* ne_p_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_n_ic(cur_opcode, interp));
+
+  PC_193: /* ne_p_nc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_nc_ic(cur_opcode, interp));
+
+  PC_194: /* ne_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_s_ic(cur_opcode, interp));
+
+  PC_195: /* ne_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_p_sc_ic(cur_opcode, interp));
+
+  PC_196: /* ne_str_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_str_p_p_ic(cur_opcode, interp));
+
+  PC_197: /* ne_num_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ne_num_p_p_ic(cur_opcode, interp));
+
+  PC_198: /* ne_addr_s_s_ic */
+{
+    if (SREG(1) != SREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_199: /* ne_addr_sc_s_ic */
+{
+    if (SCONST(1) != SREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_200: /* ne_addr_s_sc_ic */
+{
+    if (SREG(1) != SCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_201: /* ne_addr_sc_sc_ic */
+{
+    if (SCONST(1) != SCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_202: /* ne_addr_p_p_ic */
+{
+    if (PREG(1) != PREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_203: /* lt_i_i_ic */
+{
+    if (IREG(1) < IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_204: /* lt_ic_i_ic */
+{
+    if (ICONST(1) < IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_205: /* lt_i_ic_ic */
+{
+    if (IREG(1) < ICONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_206: /* lt_n_n_ic */
+{
+    if (NREG(1) < NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_207: /* lt_nc_n_ic */
+{
+    if (NCONST(1) < NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_208: /* lt_n_nc_ic */
+{
+    if (NREG(1) < NCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_209: /* lt_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_s_s_ic(cur_opcode, interp));
+
+  PC_210: /* lt_sc_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_sc_s_ic(cur_opcode, interp));
+
+  PC_211: /* lt_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_s_sc_ic(cur_opcode, interp));
+
+  PC_212: /* lt_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_p_ic(cur_opcode, interp));
+
+  PC_213: /* lt_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_i_ic(cur_opcode, interp));
+
+  PC_214: /* lt_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_ic_ic(cur_opcode, interp));
+
+  PC_215: /* lt_p_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_n_ic(cur_opcode, interp));
+
+  PC_216: /* lt_p_nc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_nc_ic(cur_opcode, interp));
+
+  PC_217: /* lt_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_s_ic(cur_opcode, interp));
+
+  PC_218: /* lt_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_p_sc_ic(cur_opcode, interp));
+
+  PC_219: /* lt_str_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_str_p_p_ic(cur_opcode, interp));
+
+  PC_220: /* lt_num_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_lt_num_p_p_ic(cur_opcode, interp));
+
+  PC_221: /* le_i_i_ic */
+{
+    if (IREG(1) <= IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_222: /* le_ic_i_ic */
+{
+    if (ICONST(1) <= IREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_223: /* le_i_ic_ic */
+{
+    if (IREG(1) <= ICONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_224: /* le_n_n_ic */
+{
+    if (NREG(1) <= NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_225: /* le_nc_n_ic */
+{
+    if (NCONST(1) <= NREG(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_226: /* le_n_nc_ic */
+{
+    if (NREG(1) <= NCONST(2)) {
+        CG_NEXT(cur_opcode + ICONST(3));
+    }
+
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_227: /* le_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_s_s_ic(cur_opcode, interp));
+
+  PC_228: /* le_sc_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_sc_s_ic(cur_opcode, interp));
+
+  PC_229: /* le_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_s_sc_ic(cur_opcode, interp));
+
+  PC_230: /* le_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_p_ic(cur_opcode, interp));
+
+  PC_231: /* le_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_i_ic(cur_opcode, interp));
+
+  PC_232: /* le_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_ic_ic(cur_opcode, interp));
+
+  PC_233: /* le_p_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_n_ic(cur_opcode, interp));
+
+  PC_234: /* le_p_nc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_nc_ic(cur_opcode, interp));
+
+  PC_235: /* le_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_s_ic(cur_opcode, interp));
+
+  PC_236: /* le_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_p_sc_ic(cur_opcode, interp));
+
+  PC_237: /* le_str_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_str_p_p_ic(cur_opcode, interp));
+
+  PC_238: /* le_num_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_le_num_p_p_ic(cur_opcode, interp));
+
+  PC_239: /* gt_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_p_ic(cur_opcode, interp));
+
+  PC_240: /* gt_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_i_ic(cur_opcode, interp));
+
+  PC_241: /* gt_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_ic_ic(cur_opcode, interp));
+
+  PC_242: /* gt_p_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_n_ic(cur_opcode, interp));
+
+  PC_243: /* gt_p_nc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_nc_ic(cur_opcode, interp));
+
+  PC_244: /* gt_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_s_ic(cur_opcode, interp));
+
+  PC_245: /* gt_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_p_sc_ic(cur_opcode, interp));
+
+  PC_246: /* gt_str_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_str_p_p_ic(cur_opcode, interp));
+
+  PC_247: /* gt_num_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_gt_num_p_p_ic(cur_opcode, interp));
+
+  PC_248: /* ge_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_p_ic(cur_opcode, interp));
+
+  PC_249: /* ge_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_i_ic(cur_opcode, interp));
+
+  PC_250: /* ge_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_ic_ic(cur_opcode, interp));
+
+  PC_251: /* ge_p_n_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_n_ic(cur_opcode, interp));
+
+  PC_252: /* ge_p_nc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_nc_ic(cur_opcode, interp));
+
+  PC_253: /* ge_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_s_ic(cur_opcode, interp));
+
+  PC_254: /* ge_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_p_sc_ic(cur_opcode, interp));
+
+  PC_255: /* ge_str_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_str_p_p_ic(cur_opcode, interp));
+
+  PC_256: /* ge_num_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ge_num_p_p_ic(cur_opcode, interp));
+
+  PC_257: /* if_null_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_if_null_p_ic(cur_opcode, interp));
+
+  PC_258: /* if_null_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_if_null_s_ic(cur_opcode, interp));
+
+  PC_259: /* unless_null_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unless_null_p_ic(cur_opcode, interp));
+
+  PC_260: /* unless_null_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unless_null_s_ic(cur_opcode, interp));
+
+  PC_261: /* cmp_i_i_i */
+{
+    IREG(1) = (IREG(2) < IREG(3)) ? (-1) : (IREG(2) > IREG(3)) ? (+1) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_262: /* cmp_i_ic_i */
+{
+    IREG(1) = (ICONST(2) < IREG(3)) ? (-1) : (ICONST(2) > IREG(3)) ? (+1) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_263: /* cmp_i_i_ic */
+{
+    IREG(1) = (IREG(2) < ICONST(3)) ? (-1) : (IREG(2) > ICONST(3)) ? (+1) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_264: /* cmp_i_n_n */
+{
+    IREG(1) = (NREG(2) < NREG(3)) ? (-1) : (NREG(2) > NREG(3)) ? (+1) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_265: /* cmp_i_nc_n */
+{
+    IREG(1) = (NCONST(2) < NREG(3)) ? (-1) : (NCONST(2) > NREG(3)) ? (+1) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_266: /* cmp_i_n_nc */
+{
+    IREG(1) = (NREG(2) < NCONST(3)) ? (-1) : (NREG(2) > NCONST(3)) ? (+1) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_267: /* cmp_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_s_s(cur_opcode, interp));
+
+  PC_268: /* cmp_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_sc_s(cur_opcode, interp));
+
+  PC_269: /* cmp_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_s_sc(cur_opcode, interp));
+
+  PC_270: /* cmp_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_p(cur_opcode, interp));
+
+  PC_271: /* cmp_i_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_i(cur_opcode, interp));
+
+  PC_272: /* cmp_i_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_ic(cur_opcode, interp));
+
+  PC_273: /* cmp_i_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_n(cur_opcode, interp));
+
+  PC_274: /* cmp_i_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_nc(cur_opcode, interp));
+
+  PC_275: /* cmp_i_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_s(cur_opcode, interp));
+
+  PC_276: /* cmp_i_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_i_p_sc(cur_opcode, interp));
+
+  PC_277: /* cmp_str_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_str_i_p_p(cur_opcode, interp));
+
+  PC_278: /* cmp_num_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_num_i_p_p(cur_opcode, interp));
+
+  PC_279: /* cmp_pmc_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_cmp_pmc_p_p_p(cur_opcode, interp));
+
+  PC_280: /* issame_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_issame_i_p_p(cur_opcode, interp));
+
+  PC_281: /* issame_i_s_s */
+{
+    IREG(1) = (SREG(2) == SREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_282: /* issame_i_sc_s */
+{
+    IREG(1) = (SCONST(2) == SREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_283: /* issame_i_s_sc */
+{
+    IREG(1) = (SREG(2) == SCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_284: /* issame_i_sc_sc */
+{
+    IREG(1) = (SCONST(2) == SCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_285: /* isntsame_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isntsame_i_p_p(cur_opcode, interp));
+
+  PC_286: /* isntsame_i_s_s */
+{
+    IREG(1) = (SREG(2) != SREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_287: /* isntsame_i_sc_s */
+{
+    IREG(1) = (SCONST(2) != SREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_288: /* isntsame_i_s_sc */
+{
+    IREG(1) = (SREG(2) != SCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_289: /* isntsame_i_sc_sc */
+{
+    IREG(1) = (SCONST(2) != SCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_290: /* istrue_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_istrue_i_p(cur_opcode, interp));
+
+  PC_291: /* isfalse_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isfalse_i_p(cur_opcode, interp));
+
+  PC_292: /* isnull_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isnull_i_p(cur_opcode, interp));
+
+  PC_293: /* isnull_i_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isnull_i_pc(cur_opcode, interp));
+
+  PC_294: /* isnull_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isnull_i_s(cur_opcode, interp));
+
+  PC_295: /* isnull_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isnull_i_sc(cur_opcode, interp));
+
+  PC_296: /* isgt_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isgt_i_p_p(cur_opcode, interp));
+
+  PC_297: /* isge_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isge_i_p_p(cur_opcode, interp));
+
+  PC_298: /* isle_i_i_i */
+{
+    IREG(1) = (IREG(2) <= IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_299: /* isle_i_ic_i */
+{
+    IREG(1) = (ICONST(2) <= IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_300: /* isle_i_i_ic */
+{
+    IREG(1) = (IREG(2) <= ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_301: /* isle_i_n_n */
+{
+    IREG(1) = (NREG(2) <= NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_302: /* isle_i_nc_n */
+{
+    IREG(1) = (NCONST(2) <= NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_303: /* isle_i_n_nc */
+{
+    IREG(1) = (NREG(2) <= NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_304: /* isle_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isle_i_s_s(cur_opcode, interp));
+
+  PC_305: /* isle_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isle_i_sc_s(cur_opcode, interp));
+
+  PC_306: /* isle_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isle_i_s_sc(cur_opcode, interp));
+
+  PC_307: /* isle_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isle_i_p_p(cur_opcode, interp));
+
+  PC_308: /* islt_i_i_i */
+{
+    IREG(1) = ((IREG(2) < IREG(3))) ? 1 : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_309: /* islt_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) < IREG(3))) ? 1 : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_310: /* islt_i_i_ic */
+{
+    IREG(1) = ((IREG(2) < ICONST(3))) ? 1 : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_311: /* islt_i_n_n */
+{
+    IREG(1) = (NREG(2) < NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_312: /* islt_i_nc_n */
+{
+    IREG(1) = (NCONST(2) < NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_313: /* islt_i_n_nc */
+{
+    IREG(1) = (NREG(2) < NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_314: /* islt_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_islt_i_s_s(cur_opcode, interp));
+
+  PC_315: /* islt_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_islt_i_sc_s(cur_opcode, interp));
+
+  PC_316: /* islt_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_islt_i_s_sc(cur_opcode, interp));
+
+  PC_317: /* islt_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_islt_i_p_p(cur_opcode, interp));
+
+  PC_318: /* iseq_i_i_i */
+{
+    IREG(1) = ((IREG(2) == IREG(3))) ? 1 : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_319: /* iseq_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) == IREG(3))) ? 1 : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_320: /* iseq_i_i_ic */
+{
+    IREG(1) = ((IREG(2) == ICONST(3))) ? 1 : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_321: /* iseq_i_n_n */
+{
+    IREG(1) = (NREG(2) == NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_322: /* iseq_i_nc_n */
+{
+    IREG(1) = (NCONST(2) == NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_323: /* iseq_i_n_nc */
+{
+    IREG(1) = (NREG(2) == NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_324: /* iseq_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_iseq_i_s_s(cur_opcode, interp));
+
+  PC_325: /* iseq_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_iseq_i_sc_s(cur_opcode, interp));
+
+  PC_326: /* iseq_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_iseq_i_s_sc(cur_opcode, interp));
+
+  PC_327: /* iseq_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_iseq_i_p_p(cur_opcode, interp));
+
+  PC_328: /* isne_i_i_i */
+{
+    IREG(1) = ((IREG(2) == IREG(3))) ? 0 : 1;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_329: /* isne_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) == IREG(3))) ? 0 : 1;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_330: /* isne_i_i_ic */
+{
+    IREG(1) = ((IREG(2) == ICONST(3))) ? 0 : 1;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_331: /* isne_i_n_n */
+{
+    IREG(1) = (NREG(2) != NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_332: /* isne_i_nc_n */
+{
+    IREG(1) = (NCONST(2) != NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_333: /* isne_i_n_nc */
+{
+    IREG(1) = (NREG(2) != NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_334: /* isne_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isne_i_s_s(cur_opcode, interp));
+
+  PC_335: /* isne_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isne_i_sc_s(cur_opcode, interp));
+
+  PC_336: /* isne_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isne_i_s_sc(cur_opcode, interp));
+
+  PC_337: /* isne_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isne_i_p_p(cur_opcode, interp));
+
+  PC_338: /* and_i_i_i */
+{
+    IREG(1) = IREG(2) ? IREG(3) : IREG(2);
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_339: /* and_i_ic_i */
+{
+    IREG(1) = ICONST(2) ? IREG(3) : ICONST(2);
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_340: /* and_i_i_ic */
+{
+    IREG(1) = IREG(2) ? ICONST(3) : IREG(2);
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_341: /* and_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_and_p_p_p(cur_opcode, interp));
+
+  PC_342: /* not_i */
+{
+    IREG(1) = (!IREG(1));
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_343: /* not_i_i */
+{
+    IREG(1) = (!IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_344: /* not_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_not_p(cur_opcode, interp));
+
+  PC_345: /* not_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_not_p_p(cur_opcode, interp));
+
+  PC_346: /* or_i_i_i */
+{
+    IREG(1) = IREG(2) ? IREG(2) : IREG(3);
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_347: /* or_i_ic_i */
+{
+    IREG(1) = ICONST(2) ? ICONST(2) : IREG(3);
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_348: /* or_i_i_ic */
+{
+    IREG(1) = IREG(2) ? IREG(2) : ICONST(3);
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_349: /* or_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_or_p_p_p(cur_opcode, interp));
+
+  PC_350: /* xor_i_i_i */
+{
+    IREG(1) = ((IREG(2) && (!IREG(3)))) ? IREG(2) : ((IREG(3) && (!IREG(2)))) ? IREG(3) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_351: /* xor_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) && (!IREG(3)))) ? ICONST(2) : ((IREG(3) && (!ICONST(2)))) ? IREG(3) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_352: /* xor_i_i_ic */
+{
+    IREG(1) = ((IREG(2) && (!ICONST(3)))) ? IREG(2) : ((ICONST(3) && (!IREG(2)))) ? ICONST(3) : 0;
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_353: /* xor_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_xor_p_p_p(cur_opcode, interp));
+
+  PC_354: /* print_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_i(cur_opcode, interp));
+
+  PC_355: /* print_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_ic(cur_opcode, interp));
+
+  PC_356: /* print_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_n(cur_opcode, interp));
+
+  PC_357: /* print_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_nc(cur_opcode, interp));
+
+  PC_358: /* print_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_s(cur_opcode, interp));
+
+  PC_359: /* print_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_sc(cur_opcode, interp));
+
+  PC_360: /* print_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p(cur_opcode, interp));
+
+  PC_361: /* say_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_i(cur_opcode, interp));
+
+  PC_362: /* say_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_ic(cur_opcode, interp));
+
+  PC_363: /* say_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_n(cur_opcode, interp));
+
+  PC_364: /* say_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_nc(cur_opcode, interp));
+
+  PC_365: /* say_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_s(cur_opcode, interp));
+
+  PC_366: /* say_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_sc(cur_opcode, interp));
+
+  PC_367: /* say_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_say_p(cur_opcode, interp));
+
+  PC_368: /* print_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_i(cur_opcode, interp));
+
+  PC_369: /* print_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_ic(cur_opcode, interp));
+
+  PC_370: /* print_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_n(cur_opcode, interp));
+
+  PC_371: /* print_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_nc(cur_opcode, interp));
+
+  PC_372: /* print_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_s(cur_opcode, interp));
+
+  PC_373: /* print_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_sc(cur_opcode, interp));
+
+  PC_374: /* print_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_print_p_p(cur_opcode, interp));
+
+  PC_375: /* getstdin_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getstdin_p(cur_opcode, interp));
+
+  PC_376: /* getstdout_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getstdout_p(cur_opcode, interp));
+
+  PC_377: /* getstderr_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getstderr_p(cur_opcode, interp));
+
+  PC_378: /* abs_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_abs_i(cur_opcode, interp));
+
+  PC_379: /* abs_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_abs_n(cur_opcode, interp));
+
+  PC_380: /* abs_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_abs_i_i(cur_opcode, interp));
+
+  PC_381: /* abs_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_abs_n_n(cur_opcode, interp));
+
+  PC_382: /* abs_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_abs_p(cur_opcode, interp));
+
+  PC_383: /* abs_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_abs_p_p(cur_opcode, interp));
+
+  PC_384: /* add_i_i */
+{
+    (IREG(1) += IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_385: /* add_i_ic */
+{
+    (IREG(1) += ICONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_386: /* add_n_n */
+{
+    (NREG(1) += NREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_387: /* add_n_nc */
+{
+    (NREG(1) += NCONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_388: /* add_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_p(cur_opcode, interp));
+
+  PC_389: /* add_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_i(cur_opcode, interp));
+
+  PC_390: /* add_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_ic(cur_opcode, interp));
+
+  PC_391: /* add_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_n(cur_opcode, interp));
+
+  PC_392: /* add_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_nc(cur_opcode, interp));
+
+  PC_393: /* add_i_i_i */
+{
+    IREG(1) = (IREG(2) + IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_394: /* add_i_ic_i */
+{
+    IREG(1) = (ICONST(2) + IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_395: /* add_i_i_ic */
+{
+    IREG(1) = (IREG(2) + ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_396: /* add_n_n_n */
+{
+    NREG(1) = (NREG(2) + NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_397: /* add_n_nc_n */
+{
+    NREG(1) = (NCONST(2) + NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_398: /* add_n_n_nc */
+{
+    NREG(1) = (NREG(2) + NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_399: /* add_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_p_p(cur_opcode, interp));
+
+  PC_400: /* add_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_p_i(cur_opcode, interp));
+
+  PC_401: /* add_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_p_ic(cur_opcode, interp));
+
+  PC_402: /* add_p_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_p_n(cur_opcode, interp));
+
+  PC_403: /* add_p_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_p_p_nc(cur_opcode, interp));
+
+  PC_404: /* dec_i */
+{
+    (IREG(1)--);
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_405: /* dec_n */
+{
+    (NREG(1)--);
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_406: /* dec_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_dec_p(cur_opcode, interp));
+
+  PC_407: /* div_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_i_i(cur_opcode, interp));
+
+  PC_408: /* div_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_i_ic(cur_opcode, interp));
+
+  PC_409: /* div_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_n_n(cur_opcode, interp));
+
+  PC_410: /* div_n_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_n_nc(cur_opcode, interp));
+
+  PC_411: /* div_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_p(cur_opcode, interp));
+
+  PC_412: /* div_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_i(cur_opcode, interp));
+
+  PC_413: /* div_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_ic(cur_opcode, interp));
+
+  PC_414: /* div_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_n(cur_opcode, interp));
+
+  PC_415: /* div_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_nc(cur_opcode, interp));
+
+  PC_416: /* div_i_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_i_i_i(cur_opcode, interp));
+
+  PC_417: /* div_i_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_i_ic_i(cur_opcode, interp));
+
+  PC_418: /* div_i_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_i_i_ic(cur_opcode, interp));
+
+  PC_419: /* div_i_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_i_ic_ic(cur_opcode, interp));
+
+  PC_420: /* div_n_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_n_n_n(cur_opcode, interp));
+
+  PC_421: /* div_n_nc_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_n_nc_n(cur_opcode, interp));
+
+  PC_422: /* div_n_n_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_n_n_nc(cur_opcode, interp));
+
+  PC_423: /* div_n_nc_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_n_nc_nc(cur_opcode, interp));
+
+  PC_424: /* div_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_p_p(cur_opcode, interp));
+
+  PC_425: /* div_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_p_i(cur_opcode, interp));
+
+  PC_426: /* div_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_p_ic(cur_opcode, interp));
+
+  PC_427: /* div_p_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_p_n(cur_opcode, interp));
+
+  PC_428: /* div_p_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_div_p_p_nc(cur_opcode, interp));
+
+  PC_429: /* fdiv_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_i_i(cur_opcode, interp));
+
+  PC_430: /* fdiv_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_i_ic(cur_opcode, interp));
+
+  PC_431: /* fdiv_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_n_n(cur_opcode, interp));
+
+  PC_432: /* fdiv_n_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_n_nc(cur_opcode, interp));
+
+  PC_433: /* fdiv_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_p(cur_opcode, interp));
+
+  PC_434: /* fdiv_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_i(cur_opcode, interp));
+
+  PC_435: /* fdiv_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_ic(cur_opcode, interp));
+
+  PC_436: /* fdiv_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_n(cur_opcode, interp));
+
+  PC_437: /* fdiv_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_nc(cur_opcode, interp));
+
+  PC_438: /* fdiv_i_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_i_i_i(cur_opcode, interp));
+
+  PC_439: /* fdiv_i_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_i_ic_i(cur_opcode, interp));
+
+  PC_440: /* fdiv_i_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_i_i_ic(cur_opcode, interp));
+
+  PC_441: /* fdiv_n_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_n_n_n(cur_opcode, interp));
+
+  PC_442: /* fdiv_n_nc_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_n_nc_n(cur_opcode, interp));
+
+  PC_443: /* fdiv_n_n_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_n_n_nc(cur_opcode, interp));
+
+  PC_444: /* fdiv_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_p_p(cur_opcode, interp));
+
+  PC_445: /* fdiv_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_p_i(cur_opcode, interp));
+
+  PC_446: /* fdiv_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_p_ic(cur_opcode, interp));
+
+  PC_447: /* fdiv_p_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_p_n(cur_opcode, interp));
+
+  PC_448: /* fdiv_p_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fdiv_p_p_nc(cur_opcode, interp));
+
+  PC_449: /* ceil_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ceil_n(cur_opcode, interp));
+
+  PC_450: /* ceil_i_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ceil_i_n(cur_opcode, interp));
+
+  PC_451: /* ceil_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ceil_n_n(cur_opcode, interp));
+
+  PC_452: /* floor_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_floor_n(cur_opcode, interp));
+
+  PC_453: /* floor_i_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_floor_i_n(cur_opcode, interp));
+
+  PC_454: /* floor_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_floor_n_n(cur_opcode, interp));
+
+  PC_455: /* inc_i */
+{
+    (IREG(1)++);
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_456: /* inc_n */
+{
+    (NREG(1)++);
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_457: /* inc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inc_p(cur_opcode, interp));
+
+  PC_458: /* mod_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_i_i(cur_opcode, interp));
+
+  PC_459: /* mod_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_i_ic(cur_opcode, interp));
+
+  PC_460: /* mod_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_n_n(cur_opcode, interp));
+
+  PC_461: /* mod_n_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_n_nc(cur_opcode, interp));
+
+  PC_462: /* mod_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_p(cur_opcode, interp));
+
+  PC_463: /* mod_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_i(cur_opcode, interp));
+
+  PC_464: /* mod_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_ic(cur_opcode, interp));
+
+  PC_465: /* mod_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_n(cur_opcode, interp));
+
+  PC_466: /* mod_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_nc(cur_opcode, interp));
+
+  PC_467: /* mod_i_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_i_i_i(cur_opcode, interp));
+
+  PC_468: /* mod_i_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_i_ic_i(cur_opcode, interp));
+
+  PC_469: /* mod_i_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_i_i_ic(cur_opcode, interp));
+
+  PC_470: /* mod_n_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_n_n_n(cur_opcode, interp));
+
+  PC_471: /* mod_n_nc_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_n_nc_n(cur_opcode, interp));
+
+  PC_472: /* mod_n_n_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_n_n_nc(cur_opcode, interp));
+
+  PC_473: /* mod_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_p_p(cur_opcode, interp));
+
+  PC_474: /* mod_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_p_i(cur_opcode, interp));
+
+  PC_475: /* mod_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_p_ic(cur_opcode, interp));
+
+  PC_476: /* mod_p_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_p_n(cur_opcode, interp));
+
+  PC_477: /* mod_p_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mod_p_p_nc(cur_opcode, interp));
+
+  PC_478: /* mul_i_i */
+{
+    (IREG(1) *= IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_479: /* mul_i_ic */
+{
+    (IREG(1) *= ICONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_480: /* mul_n_n */
+{
+    (NREG(1) *= NREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_481: /* mul_n_nc */
+{
+    (NREG(1) *= NCONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_482: /* mul_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_p(cur_opcode, interp));
+
+  PC_483: /* mul_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_i(cur_opcode, interp));
+
+  PC_484: /* mul_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_ic(cur_opcode, interp));
+
+  PC_485: /* mul_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_n(cur_opcode, interp));
+
+  PC_486: /* mul_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_nc(cur_opcode, interp));
+
+  PC_487: /* mul_i_i_i */
+{
+    IREG(1) = (IREG(2) * IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_488: /* mul_i_ic_i */
+{
+    IREG(1) = (ICONST(2) * IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_489: /* mul_i_i_ic */
+{
+    IREG(1) = (IREG(2) * ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_490: /* mul_n_n_n */
+{
+    NREG(1) = (NREG(2) * NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_491: /* mul_n_nc_n */
+{
+    NREG(1) = (NCONST(2) * NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_492: /* mul_n_n_nc */
+{
+    NREG(1) = (NREG(2) * NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_493: /* mul_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_p_p(cur_opcode, interp));
+
+  PC_494: /* mul_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_p_i(cur_opcode, interp));
+
+  PC_495: /* mul_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_p_ic(cur_opcode, interp));
+
+  PC_496: /* mul_p_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_p_n(cur_opcode, interp));
+
+  PC_497: /* mul_p_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_mul_p_p_nc(cur_opcode, interp));
+
+  PC_498: /* neg_i */
+{
+    IREG(1) = (-IREG(1));
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_499: /* neg_n */
+{
+    NREG(1) = (-NREG(1));
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_500: /* neg_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_neg_p(cur_opcode, interp));
+
+  PC_501: /* neg_i_i */
+{
+    IREG(1) = (-IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_502: /* neg_n_n */
+{
+    NREG(1) = (-NREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_503: /* neg_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_neg_p_p(cur_opcode, interp));
+
+  PC_504: /* sub_i_i */
+{
+    (IREG(1) -= IREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_505: /* sub_i_ic */
+{
+    (IREG(1) -= ICONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_506: /* sub_n_n */
+{
+    (NREG(1) -= NREG(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_507: /* sub_n_nc */
+{
+    (NREG(1) -= NCONST(2));
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_508: /* sub_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_p(cur_opcode, interp));
+
+  PC_509: /* sub_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_i(cur_opcode, interp));
+
+  PC_510: /* sub_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_ic(cur_opcode, interp));
+
+  PC_511: /* sub_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_n(cur_opcode, interp));
+
+  PC_512: /* sub_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_nc(cur_opcode, interp));
+
+  PC_513: /* sub_i_i_i */
+{
+    IREG(1) = (IREG(2) - IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_514: /* sub_i_ic_i */
+{
+    IREG(1) = (ICONST(2) - IREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_515: /* sub_i_i_ic */
+{
+    IREG(1) = (IREG(2) - ICONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_516: /* sub_n_n_n */
+{
+    NREG(1) = (NREG(2) - NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_517: /* sub_n_nc_n */
+{
+    NREG(1) = (NCONST(2) - NREG(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_518: /* sub_n_n_nc */
+{
+    NREG(1) = (NREG(2) - NCONST(3));
+    CG_NEXT(cur_opcode + 4);
+}
+  PC_519: /* sub_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_p_p(cur_opcode, interp));
+
+  PC_520: /* sub_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_p_i(cur_opcode, interp));
+
+  PC_521: /* sub_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_p_ic(cur_opcode, interp));
+
+  PC_522: /* sub_p_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_p_n(cur_opcode, interp));
+
+  PC_523: /* sub_p_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sub_p_p_nc(cur_opcode, interp));
+
+  PC_524: /* sqrt_n_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sqrt_n_n(cur_opcode, interp));
+
+  PC_525: /* is_inf_or_nan_i_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_inf_or_nan_i_n(cur_opcode, interp));
+
+  PC_526: /* is_inf_or_nan_i_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_inf_or_nan_i_nc(cur_opcode, interp));
+
+  PC_527: /* callmethodcc_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_callmethodcc_p_s(cur_opcode, interp));
+
+  PC_528: /* callmethodcc_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_callmethodcc_p_sc(cur_opcode, interp));
+
+  PC_529: /* callmethodcc_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_callmethodcc_p_p(cur_opcode, interp));
+
+  PC_530: /* callmethod_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_callmethod_p_s_p(cur_opcode, interp));
+
+  PC_531: /* callmethod_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_callmethod_p_sc_p(cur_opcode, interp));
+
+  PC_532: /* callmethod_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_callmethod_p_p_p(cur_opcode, interp));
+
+  PC_533: /* tailcallmethod_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_tailcallmethod_p_s(cur_opcode, interp));
+
+  PC_534: /* tailcallmethod_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_tailcallmethod_p_sc(cur_opcode, interp));
+
+  PC_535: /* tailcallmethod_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_tailcallmethod_p_p(cur_opcode, interp));
+
+  PC_536: /* addmethod_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addmethod_p_s_p(cur_opcode, interp));
+
+  PC_537: /* addmethod_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addmethod_p_sc_p(cur_opcode, interp));
+
+  PC_538: /* can_i_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_can_i_p_s(cur_opcode, interp));
+
+  PC_539: /* can_i_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_can_i_p_sc(cur_opcode, interp));
+
+  PC_540: /* does_i_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_does_i_p_s(cur_opcode, interp));
+
+  PC_541: /* does_i_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_does_i_p_sc(cur_opcode, interp));
+
+  PC_542: /* does_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_does_i_p_p(cur_opcode, interp));
+
+  PC_543: /* does_i_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_does_i_p_pc(cur_opcode, interp));
+
+  PC_544: /* isa_i_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isa_i_p_s(cur_opcode, interp));
+
+  PC_545: /* isa_i_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isa_i_p_sc(cur_opcode, interp));
+
+  PC_546: /* isa_i_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isa_i_p_p(cur_opcode, interp));
+
+  PC_547: /* isa_i_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_isa_i_p_pc(cur_opcode, interp));
+
+  PC_548: /* newclass_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_newclass_p_s(cur_opcode, interp));
+
+  PC_549: /* newclass_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_newclass_p_sc(cur_opcode, interp));
+
+  PC_550: /* newclass_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_newclass_p_p(cur_opcode, interp));
+
+  PC_551: /* newclass_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_newclass_p_pc(cur_opcode, interp));
+
+  PC_552: /* subclass_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_p(cur_opcode, interp));
+
+  PC_553: /* subclass_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_pc(cur_opcode, interp));
+
+  PC_554: /* subclass_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_p_s(cur_opcode, interp));
+
+  PC_555: /* subclass_p_pc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_pc_s(cur_opcode, interp));
+
+  PC_556: /* subclass_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_p_sc(cur_opcode, interp));
+
+  PC_557: /* subclass_p_pc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_pc_sc(cur_opcode, interp));
+
+  PC_558: /* subclass_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_p_p(cur_opcode, interp));
+
+  PC_559: /* subclass_p_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_pc_p(cur_opcode, interp));
+
+  PC_560: /* subclass_p_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_p_pc(cur_opcode, interp));
+
+  PC_561: /* subclass_p_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_pc_pc(cur_opcode, interp));
+
+  PC_562: /* subclass_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_s(cur_opcode, interp));
+
+  PC_563: /* subclass_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_sc(cur_opcode, interp));
+
+  PC_564: /* subclass_p_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_s_s(cur_opcode, interp));
+
+  PC_565: /* subclass_p_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_sc_s(cur_opcode, interp));
+
+  PC_566: /* subclass_p_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_s_sc(cur_opcode, interp));
+
+  PC_567: /* subclass_p_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_sc_sc(cur_opcode, interp));
+
+  PC_568: /* subclass_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_s_p(cur_opcode, interp));
+
+  PC_569: /* subclass_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_sc_p(cur_opcode, interp));
+
+  PC_570: /* subclass_p_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_s_pc(cur_opcode, interp));
+
+  PC_571: /* subclass_p_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_subclass_p_sc_pc(cur_opcode, interp));
+
+  PC_572: /* get_class_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_class_p_s(cur_opcode, interp));
+
+  PC_573: /* get_class_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_class_p_sc(cur_opcode, interp));
+
+  PC_574: /* get_class_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_class_p_p(cur_opcode, interp));
+
+  PC_575: /* get_class_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_class_p_pc(cur_opcode, interp));
+
+  PC_576: /* class_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_class_p_p(cur_opcode, interp));
+
+  PC_577: /* addparent_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addparent_p_p(cur_opcode, interp));
+
+  PC_578: /* removeparent_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_removeparent_p_p(cur_opcode, interp));
+
+  PC_579: /* addrole_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addrole_p_p(cur_opcode, interp));
+
+  PC_580: /* addattribute_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addattribute_p_s(cur_opcode, interp));
+
+  PC_581: /* addattribute_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_addattribute_p_sc(cur_opcode, interp));
+
+  PC_582: /* removeattribute_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_removeattribute_p_s(cur_opcode, interp));
+
+  PC_583: /* removeattribute_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_removeattribute_p_sc(cur_opcode, interp));
+
+  PC_584: /* getattribute_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getattribute_p_p_s(cur_opcode, interp));
+
+  PC_585: /* getattribute_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getattribute_p_p_sc(cur_opcode, interp));
+
+  PC_586: /* getattribute_p_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getattribute_p_p_p_s(cur_opcode, interp));
+
+  PC_587: /* getattribute_p_p_pc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getattribute_p_p_pc_s(cur_opcode, interp));
+
+  PC_588: /* getattribute_p_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getattribute_p_p_p_sc(cur_opcode, interp));
+
+  PC_589: /* getattribute_p_p_pc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getattribute_p_p_pc_sc(cur_opcode, interp));
+
+  PC_590: /* setattribute_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setattribute_p_s_p(cur_opcode, interp));
+
+  PC_591: /* setattribute_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setattribute_p_sc_p(cur_opcode, interp));
+
+  PC_592: /* setattribute_p_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setattribute_p_p_s_p(cur_opcode, interp));
+
+  PC_593: /* setattribute_p_pc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setattribute_p_pc_s_p(cur_opcode, interp));
+
+  PC_594: /* setattribute_p_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setattribute_p_p_sc_p(cur_opcode, interp));
+
+  PC_595: /* setattribute_p_pc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setattribute_p_pc_sc_p(cur_opcode, interp));
+
+  PC_596: /* inspect_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inspect_p_p(cur_opcode, interp));
+
+  PC_597: /* inspect_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inspect_p_pc(cur_opcode, interp));
+
+  PC_598: /* inspect_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inspect_p_p_s(cur_opcode, interp));
+
+  PC_599: /* inspect_p_pc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inspect_p_pc_s(cur_opcode, interp));
+
+  PC_600: /* inspect_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inspect_p_p_sc(cur_opcode, interp));
+
+  PC_601: /* inspect_p_pc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_inspect_p_pc_sc(cur_opcode, interp));
+
+  PC_602: /* new_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_s(cur_opcode, interp));
+
+  PC_603: /* new_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_sc(cur_opcode, interp));
+
+  PC_604: /* new_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_s_p(cur_opcode, interp));
+
+  PC_605: /* new_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_sc_p(cur_opcode, interp));
+
+  PC_606: /* new_p_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_s_pc(cur_opcode, interp));
+
+  PC_607: /* new_p_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_sc_pc(cur_opcode, interp));
+
+  PC_608: /* new_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_p(cur_opcode, interp));
+
+  PC_609: /* new_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_pc(cur_opcode, interp));
+
+  PC_610: /* new_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_p_p(cur_opcode, interp));
+
+  PC_611: /* new_p_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_pc_p(cur_opcode, interp));
+
+  PC_612: /* new_p_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_p_pc(cur_opcode, interp));
+
+  PC_613: /* new_p_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_pc_pc(cur_opcode, interp));
+
+  PC_614: /* root_new_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_p(cur_opcode, interp));
+
+  PC_615: /* root_new_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_pc(cur_opcode, interp));
+
+  PC_616: /* root_new_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_p_p(cur_opcode, interp));
+
+  PC_617: /* root_new_p_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_pc_p(cur_opcode, interp));
+
+  PC_618: /* root_new_p_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_p_pc(cur_opcode, interp));
+
+  PC_619: /* root_new_p_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_pc_pc(cur_opcode, interp));
+
+  PC_620: /* typeof_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_typeof_s_p(cur_opcode, interp));
+
+  PC_621: /* typeof_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_typeof_p_p(cur_opcode, interp));
+
+  PC_622: /* get_repr_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_repr_s_p(cur_opcode, interp));
+
+  PC_623: /* find_method_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_method_p_p_s(cur_opcode, interp));
+
+  PC_624: /* find_method_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_method_p_p_sc(cur_opcode, interp));
+
+  PC_625: /* defined_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_defined_i_p(cur_opcode, interp));
+
+  PC_626: /* defined_i_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_defined_i_p_ki(cur_opcode, interp));
+
+  PC_627: /* defined_i_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_defined_i_p_kic(cur_opcode, interp));
+
+  PC_628: /* defined_i_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_defined_i_p_k(cur_opcode, interp));
+
+  PC_629: /* defined_i_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_defined_i_p_kc(cur_opcode, interp));
+
+  PC_630: /* exists_i_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_exists_i_p_ki(cur_opcode, interp));
+
+  PC_631: /* exists_i_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_exists_i_p_kic(cur_opcode, interp));
+
+  PC_632: /* exists_i_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_exists_i_p_k(cur_opcode, interp));
+
+  PC_633: /* exists_i_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_exists_i_p_kc(cur_opcode, interp));
+
+  PC_634: /* delete_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_delete_p_k(cur_opcode, interp));
+
+  PC_635: /* delete_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_delete_p_kc(cur_opcode, interp));
+
+  PC_636: /* delete_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_delete_p_ki(cur_opcode, interp));
+
+  PC_637: /* delete_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_delete_p_kic(cur_opcode, interp));
+
+  PC_638: /* elements_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_elements_i_p(cur_opcode, interp));
+
+  PC_639: /* push_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_i(cur_opcode, interp));
+
+  PC_640: /* push_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_ic(cur_opcode, interp));
+
+  PC_641: /* push_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_n(cur_opcode, interp));
+
+  PC_642: /* push_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_nc(cur_opcode, interp));
+
+  PC_643: /* push_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_s(cur_opcode, interp));
+
+  PC_644: /* push_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_sc(cur_opcode, interp));
+
+  PC_645: /* push_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_push_p_p(cur_opcode, interp));
+
+  PC_646: /* pop_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_i_p(cur_opcode, interp));
+
+  PC_647: /* pop_n_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_n_p(cur_opcode, interp));
+
+  PC_648: /* pop_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_s_p(cur_opcode, interp));
+
+  PC_649: /* pop_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pop_p_p(cur_opcode, interp));
+
+  PC_650: /* unshift_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_i(cur_opcode, interp));
+
+  PC_651: /* unshift_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_ic(cur_opcode, interp));
+
+  PC_652: /* unshift_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_n(cur_opcode, interp));
+
+  PC_653: /* unshift_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_nc(cur_opcode, interp));
+
+  PC_654: /* unshift_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_s(cur_opcode, interp));
+
+  PC_655: /* unshift_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_sc(cur_opcode, interp));
+
+  PC_656: /* unshift_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unshift_p_p(cur_opcode, interp));
+
+  PC_657: /* shift_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shift_i_p(cur_opcode, interp));
+
+  PC_658: /* shift_n_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shift_n_p(cur_opcode, interp));
+
+  PC_659: /* shift_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shift_s_p(cur_opcode, interp));
+
+  PC_660: /* shift_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_shift_p_p(cur_opcode, interp));
+
+  PC_661: /* splice_p_p_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_splice_p_p_i_i(cur_opcode, interp));
+
+  PC_662: /* splice_p_p_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_splice_p_p_ic_i(cur_opcode, interp));
+
+  PC_663: /* splice_p_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_splice_p_p_i_ic(cur_opcode, interp));
+
+  PC_664: /* splice_p_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_splice_p_p_ic_ic(cur_opcode, interp));
+
+  PC_665: /* setprop_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setprop_p_s_p(cur_opcode, interp));
+
+  PC_666: /* setprop_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setprop_p_sc_p(cur_opcode, interp));
+
+  PC_667: /* getprop_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getprop_p_s_p(cur_opcode, interp));
+
+  PC_668: /* getprop_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getprop_p_sc_p(cur_opcode, interp));
+
+  PC_669: /* getprop_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getprop_p_p_s(cur_opcode, interp));
+
+  PC_670: /* getprop_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_getprop_p_p_sc(cur_opcode, interp));
+
+  PC_671: /* delprop_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_delprop_p_s(cur_opcode, interp));
+
+  PC_672: /* delprop_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_delprop_p_sc(cur_opcode, interp));
+
+  PC_673: /* prophash_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_prophash_p_p(cur_opcode, interp));
+
+  PC_674: /* freeze_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_freeze_s_p(cur_opcode, interp));
+
+  PC_675: /* thaw_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_thaw_p_s(cur_opcode, interp));
+
+  PC_676: /* thaw_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_thaw_p_sc(cur_opcode, interp));
+
+  PC_677: /* add_multi_s_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_multi_s_s_p(cur_opcode, interp));
+
+  PC_678: /* add_multi_sc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_multi_sc_s_p(cur_opcode, interp));
+
+  PC_679: /* add_multi_s_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_multi_s_sc_p(cur_opcode, interp));
+
+  PC_680: /* add_multi_sc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_add_multi_sc_sc_p(cur_opcode, interp));
+
+  PC_681: /* find_multi_p_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_multi_p_s_s(cur_opcode, interp));
+
+  PC_682: /* find_multi_p_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_multi_p_sc_s(cur_opcode, interp));
+
+  PC_683: /* find_multi_p_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_multi_p_s_sc(cur_opcode, interp));
+
+  PC_684: /* find_multi_p_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_multi_p_sc_sc(cur_opcode, interp));
+
+  PC_685: /* register_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_register_p(cur_opcode, interp));
+
+  PC_686: /* unregister_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unregister_p(cur_opcode, interp));
+
+  PC_687: /* box_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_box_p_i(cur_opcode, interp));
+
+  PC_688: /* box_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_box_p_ic(cur_opcode, interp));
+
+  PC_689: /* box_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_box_p_n(cur_opcode, interp));
+
+  PC_690: /* box_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_box_p_nc(cur_opcode, interp));
+
+  PC_691: /* box_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_box_p_s(cur_opcode, interp));
+
+  PC_692: /* box_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_box_p_sc(cur_opcode, interp));
+
+  PC_693: /* iter_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_iter_p_p(cur_opcode, interp));
+
+  PC_694: /* morph_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_morph_p_p(cur_opcode, interp));
+
+  PC_695: /* morph_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_morph_p_pc(cur_opcode, interp));
+
+  PC_696: /* clone_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_clone_s_s(cur_opcode, interp));
+
+  PC_697: /* clone_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_clone_s_sc(cur_opcode, interp));
+
+  PC_698: /* set_i_i */
+{
+    IREG(1) = IREG(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_699: /* set_i_ic */
+{
+    IREG(1) = ICONST(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_700: /* set_i_n */
+{
+    IREG(1) = (INTVAL)NREG(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_701: /* set_i_nc */
+{
+    IREG(1) = (INTVAL)NCONST(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_702: /* set_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_s(cur_opcode, interp));
+
+  PC_703: /* set_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_sc(cur_opcode, interp));
+
+  PC_704: /* set_n_n */
+{
+    NREG(1) = NREG(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_705: /* set_n_nc */
+{
+    NREG(1) = NCONST(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_706: /* set_n_i */
+{
+    NREG(1) = (FLOATVAL)IREG(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_707: /* set_n_ic */
+{
+    NREG(1) = (FLOATVAL)ICONST(2);
+    CG_NEXT(cur_opcode + 3);
+}
+  PC_708: /* set_n_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_s(cur_opcode, interp));
+
+  PC_709: /* set_n_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_sc(cur_opcode, interp));
+
+  PC_710: /* set_n_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_p(cur_opcode, interp));
+
+  PC_711: /* set_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_p(cur_opcode, interp));
+
+  PC_712: /* set_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_s(cur_opcode, interp));
+
+  PC_713: /* set_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_sc(cur_opcode, interp));
+
+  PC_714: /* set_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_i(cur_opcode, interp));
+
+  PC_715: /* set_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_ic(cur_opcode, interp));
+
+  PC_716: /* set_s_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_n(cur_opcode, interp));
+
+  PC_717: /* set_s_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_nc(cur_opcode, interp));
+
+  PC_718: /* set_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_pc(cur_opcode, interp));
+
+  PC_719: /* set_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_p(cur_opcode, interp));
+
+  PC_720: /* set_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_i(cur_opcode, interp));
+
+  PC_721: /* set_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ic(cur_opcode, interp));
+
+  PC_722: /* set_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_n(cur_opcode, interp));
+
+  PC_723: /* set_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_nc(cur_opcode, interp));
+
+  PC_724: /* set_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_s(cur_opcode, interp));
+
+  PC_725: /* set_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_sc(cur_opcode, interp));
+
+  PC_726: /* set_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_p(cur_opcode, interp));
+
+  PC_727: /* assign_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_p(cur_opcode, interp));
+
+  PC_728: /* assign_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_i(cur_opcode, interp));
+
+  PC_729: /* assign_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_ic(cur_opcode, interp));
+
+  PC_730: /* assign_p_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_n(cur_opcode, interp));
+
+  PC_731: /* assign_p_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_nc(cur_opcode, interp));
+
+  PC_732: /* assign_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_s(cur_opcode, interp));
+
+  PC_733: /* assign_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_p_sc(cur_opcode, interp));
+
+  PC_734: /* assign_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_s_s(cur_opcode, interp));
+
+  PC_735: /* assign_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_assign_s_sc(cur_opcode, interp));
+
+  PC_736: /* setref_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_setref_p_p(cur_opcode, interp));
+
+  PC_737: /* deref_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_deref_p_p(cur_opcode, interp));
+
+  PC_738: /* set_p_ki_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_i(cur_opcode, interp));
+
+  PC_739: /* set_p_kic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_i(cur_opcode, interp));
+
+  PC_740: /* set_p_ki_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_ic(cur_opcode, interp));
+
+  PC_741: /* set_p_kic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_ic(cur_opcode, interp));
+
+  PC_742: /* set_p_ki_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_n(cur_opcode, interp));
+
+  PC_743: /* set_p_kic_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_n(cur_opcode, interp));
+
+  PC_744: /* set_p_ki_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_nc(cur_opcode, interp));
+
+  PC_745: /* set_p_kic_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_nc(cur_opcode, interp));
+
+  PC_746: /* set_p_ki_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_s(cur_opcode, interp));
+
+  PC_747: /* set_p_kic_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_s(cur_opcode, interp));
+
+  PC_748: /* set_p_ki_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_sc(cur_opcode, interp));
+
+  PC_749: /* set_p_kic_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_sc(cur_opcode, interp));
+
+  PC_750: /* set_p_ki_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_ki_p(cur_opcode, interp));
+
+  PC_751: /* set_p_kic_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kic_p(cur_opcode, interp));
+
+  PC_752: /* set_i_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_p_ki(cur_opcode, interp));
+
+  PC_753: /* set_i_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_p_kic(cur_opcode, interp));
+
+  PC_754: /* set_n_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_p_ki(cur_opcode, interp));
+
+  PC_755: /* set_n_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_p_kic(cur_opcode, interp));
+
+  PC_756: /* set_s_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_p_ki(cur_opcode, interp));
+
+  PC_757: /* set_s_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_p_kic(cur_opcode, interp));
+
+  PC_758: /* set_p_p_ki */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_p_ki(cur_opcode, interp));
+
+  PC_759: /* set_p_p_kic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_p_kic(cur_opcode, interp));
+
+  PC_760: /* set_p_k_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_i(cur_opcode, interp));
+
+  PC_761: /* set_p_kc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_i(cur_opcode, interp));
+
+  PC_762: /* set_p_k_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_ic(cur_opcode, interp));
+
+  PC_763: /* set_p_kc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_ic(cur_opcode, interp));
+
+  PC_764: /* set_p_k_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_n(cur_opcode, interp));
+
+  PC_765: /* set_p_kc_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_n(cur_opcode, interp));
+
+  PC_766: /* set_p_k_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_nc(cur_opcode, interp));
+
+  PC_767: /* set_p_kc_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_nc(cur_opcode, interp));
+
+  PC_768: /* set_p_k_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_s(cur_opcode, interp));
+
+  PC_769: /* set_p_kc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_s(cur_opcode, interp));
+
+  PC_770: /* set_p_k_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_sc(cur_opcode, interp));
+
+  PC_771: /* set_p_kc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_sc(cur_opcode, interp));
+
+  PC_772: /* set_p_k_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_k_p(cur_opcode, interp));
+
+  PC_773: /* set_p_kc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_kc_p(cur_opcode, interp));
+
+  PC_774: /* set_i_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_p_k(cur_opcode, interp));
+
+  PC_775: /* set_i_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_i_p_kc(cur_opcode, interp));
+
+  PC_776: /* set_n_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_p_k(cur_opcode, interp));
+
+  PC_777: /* set_n_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_n_p_kc(cur_opcode, interp));
+
+  PC_778: /* set_s_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_p_k(cur_opcode, interp));
+
+  PC_779: /* set_s_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_s_p_kc(cur_opcode, interp));
+
+  PC_780: /* set_p_p_k */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_p_k(cur_opcode, interp));
+
+  PC_781: /* set_p_p_kc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_p_p_kc(cur_opcode, interp));
+
+  PC_782: /* clone_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_clone_p_p(cur_opcode, interp));
+
+  PC_783: /* clone_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_clone_p_p_p(cur_opcode, interp));
+
+  PC_784: /* clone_p_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_clone_p_p_pc(cur_opcode, interp));
+
+  PC_785: /* copy_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_copy_p_p(cur_opcode, interp));
+
+  PC_786: /* null_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_null_s(cur_opcode, interp));
+
+  PC_787: /* null_i */
+{
+    IREG(1) = 0;
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_788: /* null_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_null_p(cur_opcode, interp));
+
+  PC_789: /* null_n */
+{
+    NREG(1) = 0;
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_790: /* ord_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ord_i_s(cur_opcode, interp));
+
+  PC_791: /* ord_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ord_i_sc(cur_opcode, interp));
+
+  PC_792: /* ord_i_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ord_i_s_i(cur_opcode, interp));
+
+  PC_793: /* ord_i_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ord_i_sc_i(cur_opcode, interp));
+
+  PC_794: /* ord_i_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ord_i_s_ic(cur_opcode, interp));
+
+  PC_795: /* ord_i_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_ord_i_sc_ic(cur_opcode, interp));
+
+  PC_796: /* chr_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_chr_s_i(cur_opcode, interp));
+
+  PC_797: /* chr_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_chr_s_ic(cur_opcode, interp));
+
+  PC_798: /* chopn_s_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_chopn_s_s_i(cur_opcode, interp));
+
+  PC_799: /* chopn_s_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_chopn_s_sc_i(cur_opcode, interp));
+
+  PC_800: /* chopn_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_chopn_s_s_ic(cur_opcode, interp));
+
+  PC_801: /* chopn_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_chopn_s_sc_ic(cur_opcode, interp));
+
+  PC_802: /* concat_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_p_p(cur_opcode, interp));
+
+  PC_803: /* concat_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_p_s(cur_opcode, interp));
+
+  PC_804: /* concat_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_p_sc(cur_opcode, interp));
+
+  PC_805: /* concat_s_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_s_s_s(cur_opcode, interp));
+
+  PC_806: /* concat_s_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_s_sc_s(cur_opcode, interp));
+
+  PC_807: /* concat_s_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_s_s_sc(cur_opcode, interp));
+
+  PC_808: /* concat_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_p_p_s(cur_opcode, interp));
+
+  PC_809: /* concat_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_p_p_sc(cur_opcode, interp));
+
+  PC_810: /* concat_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_concat_p_p_p(cur_opcode, interp));
+
+  PC_811: /* repeat_s_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_s_s_i(cur_opcode, interp));
+
+  PC_812: /* repeat_s_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_s_sc_i(cur_opcode, interp));
+
+  PC_813: /* repeat_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_s_s_ic(cur_opcode, interp));
+
+  PC_814: /* repeat_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_s_sc_ic(cur_opcode, interp));
+
+  PC_815: /* repeat_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_p_p_i(cur_opcode, interp));
+
+  PC_816: /* repeat_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_p_p_ic(cur_opcode, interp));
+
+  PC_817: /* repeat_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_p_p_p(cur_opcode, interp));
+
+  PC_818: /* repeat_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_p_i(cur_opcode, interp));
+
+  PC_819: /* repeat_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_p_ic(cur_opcode, interp));
+
+  PC_820: /* repeat_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_repeat_p_p(cur_opcode, interp));
+
+  PC_821: /* length_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_length_i_s(cur_opcode, interp));
+
+  PC_822: /* length_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_length_i_sc(cur_opcode, interp));
+
+  PC_823: /* bytelength_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_bytelength_i_s(cur_opcode, interp));
+
+  PC_824: /* bytelength_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_bytelength_i_sc(cur_opcode, interp));
+
+  PC_825: /* pin_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pin_s(cur_opcode, interp));
+
+  PC_826: /* unpin_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_unpin_s(cur_opcode, interp));
+
+  PC_827: /* substr_s_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_s_i(cur_opcode, interp));
+
+  PC_828: /* substr_s_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_sc_i(cur_opcode, interp));
+
+  PC_829: /* substr_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_s_ic(cur_opcode, interp));
+
+  PC_830: /* substr_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_sc_ic(cur_opcode, interp));
+
+  PC_831: /* substr_s_s_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_s_i_i(cur_opcode, interp));
+
+  PC_832: /* substr_s_sc_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_sc_i_i(cur_opcode, interp));
+
+  PC_833: /* substr_s_s_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_s_ic_i(cur_opcode, interp));
+
+  PC_834: /* substr_s_sc_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_sc_ic_i(cur_opcode, interp));
+
+  PC_835: /* substr_s_s_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_s_i_ic(cur_opcode, interp));
+
+  PC_836: /* substr_s_sc_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_sc_i_ic(cur_opcode, interp));
+
+  PC_837: /* substr_s_s_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_s_ic_ic(cur_opcode, interp));
+
+  PC_838: /* substr_s_sc_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_sc_ic_ic(cur_opcode, interp));
+
+  PC_839: /* substr_s_p_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_p_i_i(cur_opcode, interp));
+
+  PC_840: /* substr_s_p_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_p_ic_i(cur_opcode, interp));
+
+  PC_841: /* substr_s_p_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_p_i_ic(cur_opcode, interp));
+
+  PC_842: /* substr_s_p_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_substr_s_p_ic_ic(cur_opcode, interp));
+
+  PC_843: /* replace_s_s_i_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_i_i_s(cur_opcode, interp));
+
+  PC_844: /* replace_s_sc_i_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_i_i_s(cur_opcode, interp));
+
+  PC_845: /* replace_s_s_ic_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_ic_i_s(cur_opcode, interp));
+
+  PC_846: /* replace_s_sc_ic_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_ic_i_s(cur_opcode, interp));
+
+  PC_847: /* replace_s_s_i_ic_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_i_ic_s(cur_opcode, interp));
+
+  PC_848: /* replace_s_sc_i_ic_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_i_ic_s(cur_opcode, interp));
+
+  PC_849: /* replace_s_s_ic_ic_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_ic_ic_s(cur_opcode, interp));
+
+  PC_850: /* replace_s_sc_ic_ic_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_ic_ic_s(cur_opcode, interp));
+
+  PC_851: /* replace_s_s_i_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_i_i_sc(cur_opcode, interp));
+
+  PC_852: /* replace_s_sc_i_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_i_i_sc(cur_opcode, interp));
+
+  PC_853: /* replace_s_s_ic_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_ic_i_sc(cur_opcode, interp));
+
+  PC_854: /* replace_s_sc_ic_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_ic_i_sc(cur_opcode, interp));
+
+  PC_855: /* replace_s_s_i_ic_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_i_ic_sc(cur_opcode, interp));
+
+  PC_856: /* replace_s_sc_i_ic_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_i_ic_sc(cur_opcode, interp));
+
+  PC_857: /* replace_s_s_ic_ic_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_s_ic_ic_sc(cur_opcode, interp));
+
+  PC_858: /* replace_s_sc_ic_ic_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_replace_s_sc_ic_ic_sc(cur_opcode, interp));
+
+  PC_859: /* index_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_s_s(cur_opcode, interp));
+
+  PC_860: /* index_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_sc_s(cur_opcode, interp));
+
+  PC_861: /* index_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_s_sc(cur_opcode, interp));
+
+  PC_862: /* index_i_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_sc_sc(cur_opcode, interp));
+
+  PC_863: /* index_i_s_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_s_s_i(cur_opcode, interp));
+
+  PC_864: /* index_i_sc_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_sc_s_i(cur_opcode, interp));
+
+  PC_865: /* index_i_s_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_s_sc_i(cur_opcode, interp));
+
+  PC_866: /* index_i_sc_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_sc_sc_i(cur_opcode, interp));
+
+  PC_867: /* index_i_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_s_s_ic(cur_opcode, interp));
+
+  PC_868: /* index_i_sc_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_sc_s_ic(cur_opcode, interp));
+
+  PC_869: /* index_i_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_s_sc_ic(cur_opcode, interp));
+
+  PC_870: /* index_i_sc_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_index_i_sc_sc_ic(cur_opcode, interp));
+
+  PC_871: /* rindex_i_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_s_s(cur_opcode, interp));
+
+  PC_872: /* rindex_i_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_sc_s(cur_opcode, interp));
+
+  PC_873: /* rindex_i_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_s_sc(cur_opcode, interp));
+
+  PC_874: /* rindex_i_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_sc_sc(cur_opcode, interp));
+
+  PC_875: /* rindex_i_s_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_s_s_i(cur_opcode, interp));
+
+  PC_876: /* rindex_i_sc_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_sc_s_i(cur_opcode, interp));
+
+  PC_877: /* rindex_i_s_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_s_sc_i(cur_opcode, interp));
+
+  PC_878: /* rindex_i_sc_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_sc_sc_i(cur_opcode, interp));
+
+  PC_879: /* rindex_i_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_s_s_ic(cur_opcode, interp));
+
+  PC_880: /* rindex_i_sc_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_sc_s_ic(cur_opcode, interp));
+
+  PC_881: /* rindex_i_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_s_sc_ic(cur_opcode, interp));
+
+  PC_882: /* rindex_i_sc_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_rindex_i_sc_sc_ic(cur_opcode, interp));
+
+  PC_883: /* sprintf_s_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sprintf_s_s_p(cur_opcode, interp));
+
+  PC_884: /* sprintf_s_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sprintf_s_sc_p(cur_opcode, interp));
+
+  PC_885: /* sprintf_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sprintf_p_p_p(cur_opcode, interp));
+
+  PC_886: /* new_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_s(cur_opcode, interp));
+
+  PC_887: /* stringinfo_i_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_stringinfo_i_s_i(cur_opcode, interp));
+
+  PC_888: /* stringinfo_i_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_stringinfo_i_sc_i(cur_opcode, interp));
+
+  PC_889: /* stringinfo_i_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_stringinfo_i_s_ic(cur_opcode, interp));
+
+  PC_890: /* stringinfo_i_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_stringinfo_i_sc_ic(cur_opcode, interp));
+
+  PC_891: /* upcase_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_upcase_s_s(cur_opcode, interp));
+
+  PC_892: /* upcase_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_upcase_s_sc(cur_opcode, interp));
+
+  PC_893: /* downcase_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_downcase_s_s(cur_opcode, interp));
+
+  PC_894: /* downcase_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_downcase_s_sc(cur_opcode, interp));
+
+  PC_895: /* titlecase_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_titlecase_s_s(cur_opcode, interp));
+
+  PC_896: /* titlecase_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_titlecase_s_sc(cur_opcode, interp));
+
+  PC_897: /* foldcase_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_foldcase_s_s(cur_opcode, interp));
+
+  PC_898: /* foldcase_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_foldcase_s_sc(cur_opcode, interp));
+
+  PC_899: /* join_s_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_join_s_s_p(cur_opcode, interp));
+
+  PC_900: /* join_s_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_join_s_sc_p(cur_opcode, interp));
+
+  PC_901: /* split_p_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_split_p_s_s(cur_opcode, interp));
+
+  PC_902: /* split_p_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_split_p_sc_s(cur_opcode, interp));
+
+  PC_903: /* split_p_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_split_p_s_sc(cur_opcode, interp));
+
+  PC_904: /* split_p_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_split_p_sc_sc(cur_opcode, interp));
+
+  PC_905: /* encoding_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_encoding_i_s(cur_opcode, interp));
+
+  PC_906: /* encoding_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_encoding_i_sc(cur_opcode, interp));
+
+  PC_907: /* encodingname_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_encodingname_s_i(cur_opcode, interp));
+
+  PC_908: /* encodingname_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_encodingname_s_ic(cur_opcode, interp));
+
+  PC_909: /* find_encoding_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_encoding_i_s(cur_opcode, interp));
+
+  PC_910: /* find_encoding_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_encoding_i_sc(cur_opcode, interp));
+
+  PC_911: /* trans_encoding_s_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trans_encoding_s_s_i(cur_opcode, interp));
+
+  PC_912: /* trans_encoding_s_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trans_encoding_s_sc_i(cur_opcode, interp));
+
+  PC_913: /* trans_encoding_s_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trans_encoding_s_s_ic(cur_opcode, interp));
+
+  PC_914: /* trans_encoding_s_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trans_encoding_s_sc_ic(cur_opcode, interp));
+
+  PC_915: /* is_cclass_i_i_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_i_s_i(cur_opcode, interp));
+
+  PC_916: /* is_cclass_i_ic_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_ic_s_i(cur_opcode, interp));
+
+  PC_917: /* is_cclass_i_i_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_i_sc_i(cur_opcode, interp));
+
+  PC_918: /* is_cclass_i_ic_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_ic_sc_i(cur_opcode, interp));
+
+  PC_919: /* is_cclass_i_i_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_i_s_ic(cur_opcode, interp));
+
+  PC_920: /* is_cclass_i_ic_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_ic_s_ic(cur_opcode, interp));
+
+  PC_921: /* is_cclass_i_i_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_i_sc_ic(cur_opcode, interp));
+
+  PC_922: /* is_cclass_i_ic_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_is_cclass_i_ic_sc_ic(cur_opcode, interp));
+
+  PC_923: /* find_cclass_i_i_s_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_s_i_i(cur_opcode, interp));
+
+  PC_924: /* find_cclass_i_ic_s_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_s_i_i(cur_opcode, interp));
+
+  PC_925: /* find_cclass_i_i_sc_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_sc_i_i(cur_opcode, interp));
+
+  PC_926: /* find_cclass_i_ic_sc_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_sc_i_i(cur_opcode, interp));
+
+  PC_927: /* find_cclass_i_i_s_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_s_ic_i(cur_opcode, interp));
+
+  PC_928: /* find_cclass_i_ic_s_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_s_ic_i(cur_opcode, interp));
+
+  PC_929: /* find_cclass_i_i_sc_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_sc_ic_i(cur_opcode, interp));
+
+  PC_930: /* find_cclass_i_ic_sc_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_sc_ic_i(cur_opcode, interp));
+
+  PC_931: /* find_cclass_i_i_s_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_s_i_ic(cur_opcode, interp));
+
+  PC_932: /* find_cclass_i_ic_s_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_s_i_ic(cur_opcode, interp));
+
+  PC_933: /* find_cclass_i_i_sc_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_sc_i_ic(cur_opcode, interp));
+
+  PC_934: /* find_cclass_i_ic_sc_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_sc_i_ic(cur_opcode, interp));
+
+  PC_935: /* find_cclass_i_i_s_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_s_ic_ic(cur_opcode, interp));
+
+  PC_936: /* find_cclass_i_ic_s_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_s_ic_ic(cur_opcode, interp));
+
+  PC_937: /* find_cclass_i_i_sc_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_i_sc_ic_ic(cur_opcode, interp));
+
+  PC_938: /* find_cclass_i_ic_sc_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_cclass_i_ic_sc_ic_ic(cur_opcode, interp));
+
+  PC_939: /* find_not_cclass_i_i_s_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_s_i_i(cur_opcode, interp));
+
+  PC_940: /* find_not_cclass_i_ic_s_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_s_i_i(cur_opcode, interp));
+
+  PC_941: /* find_not_cclass_i_i_sc_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_sc_i_i(cur_opcode, interp));
+
+  PC_942: /* find_not_cclass_i_ic_sc_i_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_sc_i_i(cur_opcode, interp));
+
+  PC_943: /* find_not_cclass_i_i_s_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_s_ic_i(cur_opcode, interp));
+
+  PC_944: /* find_not_cclass_i_ic_s_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_s_ic_i(cur_opcode, interp));
+
+  PC_945: /* find_not_cclass_i_i_sc_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_sc_ic_i(cur_opcode, interp));
+
+  PC_946: /* find_not_cclass_i_ic_sc_ic_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_sc_ic_i(cur_opcode, interp));
+
+  PC_947: /* find_not_cclass_i_i_s_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_s_i_ic(cur_opcode, interp));
+
+  PC_948: /* find_not_cclass_i_ic_s_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_s_i_ic(cur_opcode, interp));
+
+  PC_949: /* find_not_cclass_i_i_sc_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_sc_i_ic(cur_opcode, interp));
+
+  PC_950: /* find_not_cclass_i_ic_sc_i_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_sc_i_ic(cur_opcode, interp));
+
+  PC_951: /* find_not_cclass_i_i_s_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_s_ic_ic(cur_opcode, interp));
+
+  PC_952: /* find_not_cclass_i_ic_s_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_s_ic_ic(cur_opcode, interp));
+
+  PC_953: /* find_not_cclass_i_i_sc_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_i_sc_ic_ic(cur_opcode, interp));
+
+  PC_954: /* find_not_cclass_i_ic_sc_ic_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_not_cclass_i_ic_sc_ic_ic(cur_opcode, interp));
+
+  PC_955: /* escape_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_escape_s_s(cur_opcode, interp));
+
+  PC_956: /* compose_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_compose_s_s(cur_opcode, interp));
+
+  PC_957: /* compose_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_compose_s_sc(cur_opcode, interp));
+
+  PC_958: /* find_codepoint_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_codepoint_i_s(cur_opcode, interp));
+
+  PC_959: /* find_codepoint_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_codepoint_i_sc(cur_opcode, interp));
+
+  PC_960: /* spawnw_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_spawnw_i_s(cur_opcode, interp));
+
+  PC_961: /* spawnw_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_spawnw_i_sc(cur_opcode, interp));
+
+  PC_962: /* spawnw_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_spawnw_i_p(cur_opcode, interp));
+
+  PC_963: /* err_i */
+{
+    IREG(1) = errno;
+    CG_NEXT(cur_opcode + 2);
+}
+  PC_964: /* err_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_err_s(cur_opcode, interp));
+
+  PC_965: /* err_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_err_s_i(cur_opcode, interp));
+
+  PC_966: /* err_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_err_s_ic(cur_opcode, interp));
+
+  PC_967: /* time_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_time_i(cur_opcode, interp));
+
+  PC_968: /* time_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_time_n(cur_opcode, interp));
+
+  PC_969: /* sleep_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sleep_i(cur_opcode, interp));
+
+  PC_970: /* sleep_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sleep_ic(cur_opcode, interp));
+
+  PC_971: /* sleep_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sleep_n(cur_opcode, interp));
+
+  PC_972: /* sleep_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_sleep_nc(cur_opcode, interp));
+
+  PC_973: /* store_lex_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_p(cur_opcode, interp));
+
+  PC_974: /* store_lex_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_p(cur_opcode, interp));
+
+  PC_975: /* store_lex_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_s(cur_opcode, interp));
+
+  PC_976: /* store_lex_sc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_s(cur_opcode, interp));
+
+  PC_977: /* store_lex_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_sc(cur_opcode, interp));
+
+  PC_978: /* store_lex_sc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_sc(cur_opcode, interp));
+
+  PC_979: /* store_lex_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_i(cur_opcode, interp));
+
+  PC_980: /* store_lex_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_i(cur_opcode, interp));
+
+  PC_981: /* store_lex_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_ic(cur_opcode, interp));
+
+  PC_982: /* store_lex_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_ic(cur_opcode, interp));
+
+  PC_983: /* store_lex_s_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_n(cur_opcode, interp));
+
+  PC_984: /* store_lex_sc_n */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_n(cur_opcode, interp));
+
+  PC_985: /* store_lex_s_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_s_nc(cur_opcode, interp));
+
+  PC_986: /* store_lex_sc_nc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_lex_sc_nc(cur_opcode, interp));
+
+  PC_987: /* store_dynamic_lex_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_dynamic_lex_s_p(cur_opcode, interp));
+
+  PC_988: /* store_dynamic_lex_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_store_dynamic_lex_sc_p(cur_opcode, interp));
+
+  PC_989: /* find_lex_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_p_s(cur_opcode, interp));
+
+  PC_990: /* find_lex_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_p_sc(cur_opcode, interp));
+
+  PC_991: /* find_lex_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_s_s(cur_opcode, interp));
+
+  PC_992: /* find_lex_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_s_sc(cur_opcode, interp));
+
+  PC_993: /* find_lex_i_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_i_s(cur_opcode, interp));
+
+  PC_994: /* find_lex_i_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_i_sc(cur_opcode, interp));
+
+  PC_995: /* find_lex_n_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_n_s(cur_opcode, interp));
+
+  PC_996: /* find_lex_n_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_lex_n_sc(cur_opcode, interp));
+
+  PC_997: /* find_dynamic_lex_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_dynamic_lex_p_s(cur_opcode, interp));
+
+  PC_998: /* find_dynamic_lex_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_dynamic_lex_p_sc(cur_opcode, interp));
+
+  PC_999: /* find_caller_lex_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_caller_lex_p_s(cur_opcode, interp));
+
+  PC_1000: /* find_caller_lex_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_caller_lex_p_sc(cur_opcode, interp));
+
+  PC_1001: /* get_namespace_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_namespace_p(cur_opcode, interp));
+
+  PC_1002: /* get_namespace_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_namespace_p_p(cur_opcode, interp));
+
+  PC_1003: /* get_namespace_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_namespace_p_pc(cur_opcode, interp));
+
+  PC_1004: /* get_hll_namespace_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_namespace_p(cur_opcode, interp));
+
+  PC_1005: /* get_hll_namespace_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_namespace_p_p(cur_opcode, interp));
+
+  PC_1006: /* get_hll_namespace_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_namespace_p_pc(cur_opcode, interp));
+
+  PC_1007: /* get_root_namespace_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_namespace_p(cur_opcode, interp));
+
+  PC_1008: /* get_root_namespace_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_namespace_p_p(cur_opcode, interp));
+
+  PC_1009: /* get_root_namespace_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_namespace_p_pc(cur_opcode, interp));
+
+  PC_1010: /* get_global_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_global_p_s(cur_opcode, interp));
+
+  PC_1011: /* get_global_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_global_p_sc(cur_opcode, interp));
+
+  PC_1012: /* get_global_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_global_p_p_s(cur_opcode, interp));
+
+  PC_1013: /* get_global_p_pc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_global_p_pc_s(cur_opcode, interp));
+
+  PC_1014: /* get_global_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_global_p_p_sc(cur_opcode, interp));
+
+  PC_1015: /* get_global_p_pc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_global_p_pc_sc(cur_opcode, interp));
+
+  PC_1016: /* get_hll_global_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_global_p_s(cur_opcode, interp));
+
+  PC_1017: /* get_hll_global_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_global_p_sc(cur_opcode, interp));
+
+  PC_1018: /* get_hll_global_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_global_p_p_s(cur_opcode, interp));
+
+  PC_1019: /* get_hll_global_p_pc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_global_p_pc_s(cur_opcode, interp));
+
+  PC_1020: /* get_hll_global_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_global_p_p_sc(cur_opcode, interp));
+
+  PC_1021: /* get_hll_global_p_pc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_hll_global_p_pc_sc(cur_opcode, interp));
+
+  PC_1022: /* get_root_global_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_global_p_s(cur_opcode, interp));
+
+  PC_1023: /* get_root_global_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_global_p_sc(cur_opcode, interp));
+
+  PC_1024: /* get_root_global_p_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_global_p_p_s(cur_opcode, interp));
+
+  PC_1025: /* get_root_global_p_pc_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_global_p_pc_s(cur_opcode, interp));
+
+  PC_1026: /* get_root_global_p_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_global_p_p_sc(cur_opcode, interp));
+
+  PC_1027: /* get_root_global_p_pc_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_root_global_p_pc_sc(cur_opcode, interp));
+
+  PC_1028: /* set_global_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_global_s_p(cur_opcode, interp));
+
+  PC_1029: /* set_global_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_global_sc_p(cur_opcode, interp));
+
+  PC_1030: /* set_global_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_global_p_s_p(cur_opcode, interp));
+
+  PC_1031: /* set_global_pc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_global_pc_s_p(cur_opcode, interp));
+
+  PC_1032: /* set_global_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_global_p_sc_p(cur_opcode, interp));
+
+  PC_1033: /* set_global_pc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_global_pc_sc_p(cur_opcode, interp));
+
+  PC_1034: /* set_hll_global_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_hll_global_s_p(cur_opcode, interp));
+
+  PC_1035: /* set_hll_global_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_hll_global_sc_p(cur_opcode, interp));
+
+  PC_1036: /* set_hll_global_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_hll_global_p_s_p(cur_opcode, interp));
+
+  PC_1037: /* set_hll_global_pc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_hll_global_pc_s_p(cur_opcode, interp));
+
+  PC_1038: /* set_hll_global_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_hll_global_p_sc_p(cur_opcode, interp));
+
+  PC_1039: /* set_hll_global_pc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_hll_global_pc_sc_p(cur_opcode, interp));
+
+  PC_1040: /* set_root_global_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_root_global_s_p(cur_opcode, interp));
+
+  PC_1041: /* set_root_global_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_root_global_sc_p(cur_opcode, interp));
+
+  PC_1042: /* set_root_global_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_root_global_p_s_p(cur_opcode, interp));
+
+  PC_1043: /* set_root_global_pc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_root_global_pc_s_p(cur_opcode, interp));
+
+  PC_1044: /* set_root_global_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_root_global_p_sc_p(cur_opcode, interp));
+
+  PC_1045: /* set_root_global_pc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_root_global_pc_sc_p(cur_opcode, interp));
+
+  PC_1046: /* find_name_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_name_p_s(cur_opcode, interp));
+
+  PC_1047: /* find_name_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_name_p_sc(cur_opcode, interp));
+
+  PC_1048: /* find_sub_not_null_p_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_sub_not_null_p_s(cur_opcode, interp));
+
+  PC_1049: /* find_sub_not_null_p_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_find_sub_not_null_p_sc(cur_opcode, interp));
+
+  PC_1050: /* trap */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_trap(cur_opcode, interp));
+
+  PC_1051: /* set_label_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_set_label_p_ic(cur_opcode, interp));
+
+  PC_1052: /* get_label_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_label_i_p(cur_opcode, interp));
+
+  PC_1053: /* get_id_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_id_i_p(cur_opcode, interp));
+
+  PC_1054: /* get_id_i_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_id_i_pc(cur_opcode, interp));
+
+  PC_1055: /* fetch_p_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_p_p(cur_opcode, interp));
+
+  PC_1056: /* fetch_p_pc_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_p_p(cur_opcode, interp));
+
+  PC_1057: /* fetch_p_p_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_pc_p(cur_opcode, interp));
+
+  PC_1058: /* fetch_p_pc_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_pc_p(cur_opcode, interp));
+
+  PC_1059: /* fetch_p_p_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_p_pc(cur_opcode, interp));
+
+  PC_1060: /* fetch_p_pc_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_p_pc(cur_opcode, interp));
+
+  PC_1061: /* fetch_p_p_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_pc_pc(cur_opcode, interp));
+
+  PC_1062: /* fetch_p_pc_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_pc_pc(cur_opcode, interp));
+
+  PC_1063: /* fetch_p_p_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_i_p(cur_opcode, interp));
+
+  PC_1064: /* fetch_p_pc_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_i_p(cur_opcode, interp));
+
+  PC_1065: /* fetch_p_p_ic_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_ic_p(cur_opcode, interp));
+
+  PC_1066: /* fetch_p_pc_ic_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_ic_p(cur_opcode, interp));
+
+  PC_1067: /* fetch_p_p_i_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_i_pc(cur_opcode, interp));
+
+  PC_1068: /* fetch_p_pc_i_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_i_pc(cur_opcode, interp));
+
+  PC_1069: /* fetch_p_p_ic_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_ic_pc(cur_opcode, interp));
+
+  PC_1070: /* fetch_p_pc_ic_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_ic_pc(cur_opcode, interp));
+
+  PC_1071: /* fetch_p_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_s_p(cur_opcode, interp));
+
+  PC_1072: /* fetch_p_pc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_s_p(cur_opcode, interp));
+
+  PC_1073: /* fetch_p_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_sc_p(cur_opcode, interp));
+
+  PC_1074: /* fetch_p_pc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_sc_p(cur_opcode, interp));
+
+  PC_1075: /* fetch_p_p_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_s_pc(cur_opcode, interp));
+
+  PC_1076: /* fetch_p_pc_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_s_pc(cur_opcode, interp));
+
+  PC_1077: /* fetch_p_p_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_p_sc_pc(cur_opcode, interp));
+
+  PC_1078: /* fetch_p_pc_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_fetch_p_pc_sc_pc(cur_opcode, interp));
+
+  PC_1079: /* vivify_p_p_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_p_p(cur_opcode, interp));
+
+  PC_1080: /* vivify_p_pc_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_p_p(cur_opcode, interp));
+
+  PC_1081: /* vivify_p_p_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_pc_p(cur_opcode, interp));
+
+  PC_1082: /* vivify_p_pc_pc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_pc_p(cur_opcode, interp));
+
+  PC_1083: /* vivify_p_p_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_p_pc(cur_opcode, interp));
+
+  PC_1084: /* vivify_p_pc_p_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_p_pc(cur_opcode, interp));
+
+  PC_1085: /* vivify_p_p_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_pc_pc(cur_opcode, interp));
+
+  PC_1086: /* vivify_p_pc_pc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_pc_pc(cur_opcode, interp));
+
+  PC_1087: /* vivify_p_p_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_i_p(cur_opcode, interp));
+
+  PC_1088: /* vivify_p_pc_i_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_i_p(cur_opcode, interp));
+
+  PC_1089: /* vivify_p_p_ic_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_ic_p(cur_opcode, interp));
+
+  PC_1090: /* vivify_p_pc_ic_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_ic_p(cur_opcode, interp));
+
+  PC_1091: /* vivify_p_p_i_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_i_pc(cur_opcode, interp));
+
+  PC_1092: /* vivify_p_pc_i_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_i_pc(cur_opcode, interp));
+
+  PC_1093: /* vivify_p_p_ic_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_ic_pc(cur_opcode, interp));
+
+  PC_1094: /* vivify_p_pc_ic_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_ic_pc(cur_opcode, interp));
+
+  PC_1095: /* vivify_p_p_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_s_p(cur_opcode, interp));
+
+  PC_1096: /* vivify_p_pc_s_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_s_p(cur_opcode, interp));
+
+  PC_1097: /* vivify_p_p_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_sc_p(cur_opcode, interp));
+
+  PC_1098: /* vivify_p_pc_sc_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_sc_p(cur_opcode, interp));
+
+  PC_1099: /* vivify_p_p_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_s_pc(cur_opcode, interp));
+
+  PC_1100: /* vivify_p_pc_s_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_s_pc(cur_opcode, interp));
+
+  PC_1101: /* vivify_p_p_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_p_sc_pc(cur_opcode, interp));
+
+  PC_1102: /* vivify_p_pc_sc_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_vivify_p_pc_sc_pc(cur_opcode, interp));
+
+  PC_1103: /* new_p_s_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_s_i(cur_opcode, interp));
+
+  PC_1104: /* new_p_sc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_sc_i(cur_opcode, interp));
+
+  PC_1105: /* new_p_s_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_s_ic(cur_opcode, interp));
+
+  PC_1106: /* new_p_sc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_sc_ic(cur_opcode, interp));
+
+  PC_1107: /* new_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_p_i(cur_opcode, interp));
+
+  PC_1108: /* new_p_pc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_pc_i(cur_opcode, interp));
+
+  PC_1109: /* new_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_p_ic(cur_opcode, interp));
+
+  PC_1110: /* new_p_pc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_p_pc_ic(cur_opcode, interp));
+
+  PC_1111: /* root_new_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_p_i(cur_opcode, interp));
+
+  PC_1112: /* root_new_p_pc_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_pc_i(cur_opcode, interp));
+
+  PC_1113: /* root_new_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_p_ic(cur_opcode, interp));
+
+  PC_1114: /* root_new_p_pc_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_root_new_p_pc_ic(cur_opcode, interp));
+
+  PC_1115: /* get_context_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_get_context_p(cur_opcode, interp));
+
+  PC_1116: /* new_call_context_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_new_call_context_p(cur_opcode, interp));
+
+  PC_1117: /* invokecc_p_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_invokecc_p_p(cur_opcode, interp));
+
+  PC_1118: /* flatten_array_into_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_flatten_array_into_p_p_i(cur_opcode, interp));
+
+  PC_1119: /* flatten_array_into_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_flatten_array_into_p_p_ic(cur_opcode, interp));
+
+  PC_1120: /* flatten_hash_into_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_flatten_hash_into_p_p_i(cur_opcode, interp));
+
+  PC_1121: /* flatten_hash_into_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_flatten_hash_into_p_p_ic(cur_opcode, interp));
+
+  PC_1122: /* slurp_array_from_p_p_i */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_slurp_array_from_p_p_i(cur_opcode, interp));
+
+  PC_1123: /* slurp_array_from_p_p_ic */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_slurp_array_from_p_p_ic(cur_opcode, interp));
+
+  PC_1124: /* receive_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_receive_p(cur_opcode, interp));
+
+  PC_1125: /* wait_p */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_wait_p(cur_opcode, interp));
+
+  PC_1126: /* wait_pc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_wait_pc(cur_opcode, interp));
+
+  PC_1127: /* pass */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_pass(cur_opcode, interp));
+
+  PC_1128: /* disable_preemption */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_disable_preemption(cur_opcode, interp));
+
+  PC_1129: /* enable_preemption */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_enable_preemption(cur_opcode, interp));
+
+  PC_1130: /* terminate */
+{
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    CG_JUMP((opcode_t *)0);
+    CG_NEXT(cur_opcode + 1);
+}
+  PC_1131: /* intern_s_s */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_intern_s_s(cur_opcode, interp));
+
+  PC_1132: /* intern_s_sc */
+    CG_SYNC_PC();
+    CG_JUMP(Parrot_intern_s_sc(cur_opcode, interp));
+
+
+    return NULL;
+}
+
+#endif /* PARROT_HAS_CGOTO */
+
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -238,6 +238,9 @@ Destroys a C<PackFile>, and frees resources. This does not automatically free
 garbage collectable objects contained in that packfile (STRING and PMC) if
 they are referenced from other places.
 
+A mapped file is unmapped once the constant strings pointing into it are
+gone as well.
+
 Notice that this can cause problems, if a Packfile is destroyed, but some of
 its contents are not destroyed, but those contents contain indirect references
 to other things in the packfile which are destroyed. Use with caution.
@@ -252,21 +255,16 @@ Parrot_pf_destroy(PARROT_INTERP, ARGMOD(PackFile *pf))
 {
     ASSERT_ARGS(Parrot_pf_destroy)
 
-#ifdef PARROT_HAS_HEADER_SYSMMAN
-    if (pf->is_mmap_ped) {
-        DECL_CONST_CAST;
-        /* Cast the result to void to avoid a warning with
-         * some not-so-standard mmap headers
-         */
-        munmap((void *)PARROT_const_cast(opcode_t *, pf->src), pf->size);
-    }
-#endif
-
     mem_gc_free(interp, pf->header);
     pf->header = NULL;
     mem_gc_free(interp, pf->dirp);
     pf->dirp   = NULL;
     Parrot_pf_destroy_segment(interp, &pf->directory.base);
+
+    if (pf->mapping) {
+        Parrot_str_release_mapping(interp, pf->mapping);
+        pf->mapping = NULL;
+    }
     return;
 }
 
@@ -499,7 +497,7 @@ Parrot_pf_subs_by_tag(PARROT_INTERP, ARGIN(PMC * pfpmc), ARGIN(STRING * flag))
 
       done_find_bounds:
         for (i = bottom_lo; i < top_hi; i++)
-            VTABLE_push_pmc(interp, subs, ct->pmc.constants[ct->tag_map[i].const_idx]);
+            VTABLE_push_pmc(interp, subs, PF_CONST_PMC(interp, ct, ct->tag_map[i].const_idx));
     }
 
     /* Backwards compatibility. :load is equivalent to "load" tag. :init is
@@ -515,7 +513,7 @@ Parrot_pf_subs_by_tag(PARROT_INTERP, ARGIN(PMC * pfpmc), ARGIN(STRING * flag))
             Parrot_Sub_attributes *sub;
             int pragmas;
 
-            if (!VTABLE_isa(interp, sub_pmc, SUB))
+            if (!sub_pmc || !VTABLE_isa(interp, sub_pmc, SUB))
                 continue;
             PMC_get_sub(interp, sub_pmc, sub);
             pragmas = PObj_get_FLAGS(sub_pmc) & SUB_FLAG_PF_MASK & ~SUB_FLAG_IS_OUTER;
@@ -631,7 +629,8 @@ Parrot_pf_all_tagged_pmcs(PARROT_INTERP, ARGIN(PMC * pfpmc))
                 VTABLE_set_pmc_keyed_str(interp, taghash, cur_tag_str, cur_tag_list);
                 last_seen = cur_tag;
             }
-            VTABLE_push_pmc(interp, cur_tag_list, ct->pmc.constants[ct->tag_map[i].const_idx]);
+            VTABLE_push_pmc(interp, cur_tag_list,
+                    PF_CONST_PMC(interp, ct, ct->tag_map[i].const_idx));
         }
     }
     return taghash;
@@ -665,7 +664,7 @@ Parrot_pf_all_subs(PARROT_INTERP, ARGIN(PMC *pfpmc))
         STRING * const SUB = CONST_STRING(interp, "Sub");
         for (i = 0; i < ct->pmc.const_count; ++i) {
             PMC * const x = ct->pmc.constants[i];
-            if (VTABLE_isa(interp, x, SUB))
+            if (x && VTABLE_isa(interp, x, SUB))
                 VTABLE_push_pmc(interp, array, x);
         }
         return array;
@@ -998,7 +997,8 @@ pf_do_sub_pragmas(PARROT_INTERP, ARGIN(PMC *pfpmc), pbc_action_enum_t action)
         STRING * const SUB = CONST_STRING(interp, "Sub");
         PMC * const sub_pmc = ct->pmc.constants[i];
 
-        if (VTABLE_isa(interp, sub_pmc, SUB)) {
+        /* frozen constants are never Subs */
+        if (sub_pmc && VTABLE_isa(interp, sub_pmc, SUB)) {
             Parrot_Sub_attributes *sub;
 
             PMC_get_sub(interp, sub_pmc, sub);
@@ -1280,17 +1280,13 @@ Parrot_pf_unpack(PARROT_INTERP, ARGMOD(PackFile *self),
     cursor = pf_segment_unpack(interp, &self->directory.base, cursor);
     Parrot_unblock_GC_mark(interp);
 
-#ifdef PARROT_HAS_HEADER_SYSMMAN
-    if (self->is_mmap_ped
+    /* nothing points into a mapping which had to be converted */
+    if (self->mapping
     && (self->need_endianize || self->need_wordsize)) {
-        DECL_CONST_CAST;
-        /* Cast the result to void to avoid a warning with
-         * some not-so-standard mmap headers
-         */
-        munmap((void *)PARROT_const_cast(opcode_t *, self->src), self->size);
+        Parrot_str_release_mapping(interp, self->mapping);
+        self->mapping     = NULL;
         self->is_mmap_ped = 0;
     }
-#endif
 
     return cursor - packed;
 }
@@ -2135,7 +2131,7 @@ Parrot_pf_annotations_lookup(PARROT_INTERP, ARGIN(PackFile_Annotations *self),
           case PF_ANNOTATION_KEY_TYPE_STR:
             return Parrot_pmc_box_string(interp, self->code->const_table->str.constants[val]);
           case PF_ANNOTATION_KEY_TYPE_PMC:
-            return self->code->const_table->pmc.constants[val];
+            return PF_CONST_PMC(interp, self->code->const_table, val);
           default:
             Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "unexpected annotation type found");
             return PMCNULL;
@@ -2773,22 +2769,22 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
              document it here.
     */
 
-#ifndef PARROT_HAS_HEADER_SYSMAN
+#ifndef PARROT_HAS_HEADER_SYSMMAN
 
     program_code = read_pbc_file_bytes_handle(interp, io, program_size);
 
 #else
 
     program_code = (char *)mmap(NULL, (size_t)program_size,
-                    PROT_READ, MAP_SHARED, io, (off_t)0);
+                    PROT_READ, MAP_PRIVATE, io, (off_t)0);
 
     /* If mmap fails, fall back and try to read the file from the handle
        directly.
     */
     if (program_code == (void *)MAP_FAILED) {
         Parrot_warn(interp, PARROT_WARNINGS_IO_FLAG,
-                "Can't mmap file %s, code %i.\n", fullname, errno);
-        program_code = read_pbc_file_bytes_handle(interp, fullname, io, program_size);
+                "Can't mmap file %Ss, code %i.\n", fullname, errno);
+        program_code = read_pbc_file_bytes_handle(interp, io, program_size);
     }
     else
         is_mapped = 1;
@@ -2798,6 +2794,9 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
     pf = Parrot_pf_new(interp, is_mapped);
     pf->options = 0;
 
+    if (is_mapped)
+        pf->mapping = Parrot_str_new_mapping(interp, program_code, (size_t)program_size);
+
     /* XXX -Wcast-align Need to check alignment for RISC, or memcpy */
     if (!Parrot_pf_unpack(interp, pf, (opcode_t *)program_code, (size_t)program_size))
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
@@ -2841,7 +2840,7 @@ set_current_sub(PARROT_INTERP)
      */
     for (i = 0; i < ct->pmc.const_count; i++) {
         PMC * const sub_pmc = ct->pmc.constants[i];
-        if (VTABLE_isa(interp, sub_pmc, SUB)) {
+        if (sub_pmc && VTABLE_isa(interp, sub_pmc, SUB)) {
             Parrot_Sub_attributes *sub;
 
             PMC_get_sub(interp, sub_pmc, sub);
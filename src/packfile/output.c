@@ -249,6 +249,8 @@ Parrot_pf_ConstTable_pack_size(PARROT_INTERP, ARGMOD(PackFile_Segment *seg))
     PackFile_ConstTable* const self = (PackFile_ConstTable *) seg;
     size_t size = 3;    /* const_counts */
 
+    Parrot_pf_ConstTable_thaw_all(interp, self);
+
     size += self->num.const_count * PF_size_number();
 
     for (i = 0; i < self->str.const_count; i++)
@@ -317,6 +319,8 @@ Parrot_pf_ConstTable_pack(PARROT_INTERP,
     PackFile_ConstTable * const self = (PackFile_ConstTable *)seg;
     opcode_t i;
 
+    Parrot_pf_ConstTable_thaw_all(interp, self);
+
     *cursor++ = self->num.const_count;
     *cursor++ = self->str.const_count;
     *cursor++ = self->pmc.const_count;
@@ -253,6 +253,16 @@ PARROT_WARN_UNUSED_RESULT
 static opcode_t fetch_op_le_8(ARGIN(const unsigned char *b))
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * fetch_string(PARROT_INTERP,
+    ARGIN_NULLOK(PackFile *pf),
+    ARGIN(const opcode_t **cursor),
+    ARGMOD_NULLOK(Parrot_File_Mapping *map))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*map);
+
 #define ASSERT_ARGS_cvt_num12_num16 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(dest) \
     , PARROT_ASSERT_ARG(src))
@@ -337,6 +347,9 @@ static opcode_t fetch_op_le_8(ARGIN(const unsigned char *b))
        PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_fetch_op_le_8 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_fetch_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cursor))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -1427,6 +1440,54 @@ STRING *
 PF_fetch_string(PARROT_INTERP, ARGIN_NULLOK(PackFile *pf), ARGIN(const opcode_t **cursor))
 {
     ASSERT_ARGS(PF_fetch_string)
+    return fetch_string(interp, pf, cursor, NULL);
+}
+
+/*
+
+=item C<STRING * PF_fetch_mapped_string(PARROT_INTERP, PackFile *pf, const
+opcode_t **cursor)>
+
+Like C<PF_fetch_string>, but if C<pf> is a mapped file in native format, the
+C<STRING> points straight into the mapping instead of copying its contents.
+The C<STRING> keeps the mapping alive until it is freed or copied out with
+C<Parrot_str_unmap>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING *
+PF_fetch_mapped_string(PARROT_INTERP, ARGIN(PackFile *pf), ARGIN(const opcode_t **cursor))
+{
+    ASSERT_ARGS(PF_fetch_mapped_string)
+    Parrot_File_Mapping * const map =
+            pf->need_endianize || pf->need_wordsize ? NULL : pf->mapping;
+
+    return fetch_string(interp, pf, cursor, map);
+}
+
+/*
+
+=item C<static STRING * fetch_string(PARROT_INTERP, PackFile *pf, const opcode_t
+**cursor, Parrot_File_Mapping *map)>
+
+Fetches a C<STRING> from bytecode. If C<map> is not NULL, the C<STRING>
+points into it.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+fetch_string(PARROT_INTERP, ARGIN_NULLOK(PackFile *pf), ARGIN(const opcode_t **cursor),
+        ARGMOD_NULLOK(Parrot_File_Mapping *map))
+{
+    ASSERT_ARGS(fetch_string)
     STRING   *s;
     UINTVAL   flags;
     UINTVAL   encoding_nr;
@@ -1450,7 +1511,12 @@ PF_fetch_string(PARROT_INTERP, ARGIN_NULLOK(PackFile *pf), ARGIN(const opcode_t
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
                     "Invalid encoding number '%d' specified", encoding_nr);
 
-    if (size || (encoding != CONST_STRING(interp, "")->encoding))
+    if (size && map) {
+        s = Parrot_str_new_init(interp, (const char *)*cursor, size,
+                encoding, flags | PObj_external_FLAG);
+        Parrot_str_attach_mapping(interp, s, map);
+    }
+    else if (size || (encoding != CONST_STRING(interp, "")->encoding))
         s = Parrot_str_new_init(interp, (const char *)*cursor, size,
                 encoding, flags);
     else
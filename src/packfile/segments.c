@@ -17,6 +17,7 @@ Functions in this file represent behaviors for different PackFile segments.
 
 #include "parrot/parrot.h"
 #include "pf_private.h"
+#include "parrot/imageio.h"
 #include "pmc/pmc_parrotlibrary.h"
 #include "segments.str"
 
@@ -210,6 +211,26 @@ static const opcode_t * directory_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*segp);
 
+PARROT_WARN_UNUSED_RESULT
+static size_t frozen_image_size(
+    ARGIN(const PackFile *pf),
+    ARGIN(const opcode_t *cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int is_deferrable_constant(
+    ARGIN(const PackFile *pf),
+    ARGIN(const opcode_t *cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void keep_frozen_constants(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
 static void make_code_pointers(ARGMOD(PackFile_Segment *seg))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*seg);
@@ -262,6 +283,12 @@ static void pf_register_funcs(
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*pf);
 
+static void release_frozen_constants(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
 static void segment_init(
     ARGOUT(PackFile_Segment *self),
     ARGIN(PackFile *pf),
@@ -280,6 +307,14 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*dir);
 
+PARROT_CANNOT_RETURN_NULL
+static PMC * thaw_frozen_constant(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct),
+    INTVAL idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
 #define ASSERT_ARGS_annotations_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(seg))
@@ -361,6 +396,15 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(segp) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_frozen_image_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_is_deferrable_constant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_keep_frozen_constants __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
 #define ASSERT_ARGS_make_code_pointers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(seg))
 #define ASSERT_ARGS_pf_debug_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -383,6 +427,9 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
     , PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_pf_register_funcs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pf))
+#define ASSERT_ARGS_release_frozen_constants __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
 #define ASSERT_ARGS_segment_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(pf) \
@@ -391,6 +438,9 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_sort_segs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(dir))
+#define ASSERT_ARGS_thaw_frozen_constant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -603,6 +653,13 @@ const_clear(PARROT_INTERP, ARGMOD(PackFile_ConstTable *self))
     }
 
     if (self->str.constants) {
+        opcode_t i;
+
+        /* the strings outlive the table, but not the file mapping */
+        for (i = 0; i < self->str.const_count; ++i)
+            if (!STRING_IS_NULL(self->str.constants[i]))
+                Parrot_str_unmap(interp, self->str.constants[i]);
+
         mem_gc_free(interp, self->str.constants);
         self->str.constants = NULL;
     }
@@ -622,6 +679,9 @@ const_clear(PARROT_INTERP, ARGMOD(PackFile_ConstTable *self))
         self->ntags = 0;
     }
 
+    if (self->frozen)
+        release_frozen_constants(interp, self);
+
     return;
 }
 
@@ -636,6 +696,10 @@ Unpacks a PackFile ConstTable from a block of memory. The format is:
   opcode_t const_count
   *  constants
 
+Keys and call signatures among the PMC constants are left frozen until their
+first use, see C<Parrot_pf_ConstTable_thaw_pmc()>. Everything else is thawed
+here, Subs because they have to be stored into their namespaces.
+
 Returns cursor if everything is OK, else zero (0).
 
 =cut
@@ -685,16 +749,40 @@ const_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
         self->num.constants[i] = PF_fetch_number(pf, &cursor);
 
     for (i = 0; i < self->str.const_count; i++)
-        self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
+        self->str.constants[i] = PF_fetch_mapped_string(interp, pf, &cursor);
+
+    /* threads share the constants, so they must not be thawed later on */
+    if (self->pmc.const_count && !interp->thread_data) {
+        PackFile_FrozenConstants * const frozen =
+                mem_gc_allocate_zeroed_typed(interp, PackFile_FrozenConstants);
+        frozen->images  = mem_gc_allocate_n_zeroed_typed(interp,
+                                    self->pmc.const_count, const opcode_t *);
+        frozen->loading = 1;
+        frozen->interp  = interp;
+        self->frozen    = frozen;
+    }
 
-    for (i = 0; i < self->pmc.const_count; i++)
-        self->pmc.constants[i] = const_unpack_pmc(interp, self, &cursor);
+    for (i = 0; i < self->pmc.const_count; i++) {
+        if (self->frozen && is_deferrable_constant(pf, cursor)) {
+            self->frozen->images[i] = cursor;
+            self->frozen->count++;
+            cursor = (const opcode_t *)((const char *)cursor + frozen_image_size(pf, cursor));
+        }
+        else
+            self->pmc.constants[i] = const_unpack_pmc(interp, self, &cursor);
+    }
 
     for (i = 0; i < self->pmc.const_count; i++) {
+        PMC *pmc;
+
+        /* still frozen */
+        if (!self->pmc.constants[i])
+            continue;
+
         /* XXX unpack returned the lists of all objects in the object graph
          * must dereference the first object into the constant slot */
-        PMC      * const pmc  = self->pmc.constants[i]
-                              = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
+        pmc = self->pmc.constants[i]
+            = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
 
         PObj_is_shared_SET(pmc); /* packfile constants will be shared among threads */
 
@@ -704,6 +792,9 @@ const_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
             Parrot_ns_store_sub(interp, pmc);
     }
 
+    if (self->frozen)
+        keep_frozen_constants(interp, self);
+
     self->ntags = PF_fetch_opcode(pf, &cursor);
     self->tag_map = mem_gc_allocate_n_zeroed_typed(interp, self->ntags, PackFile_ConstTagPair);
     for (i = 0; i < self->ntags; i++) {
@@ -792,6 +883,310 @@ const_unpack_pmc(PARROT_INTERP, ARGIN(PackFile_ConstTable *constt),
 }
 
 
+/*
+
+=item C<static int is_deferrable_constant(const PackFile *pf, const opcode_t
+*cursor)>
+
+Returns true if the frozen PMC constant at C<cursor> is a Key or a call
+signature. Their images hold no references to other constants, so they can
+be thawed at any time.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_deferrable_constant(ARGIN(const PackFile *pf), ARGIN(const opcode_t *cursor))
+{
+    ASSERT_ARGS(is_deferrable_constant)
+    const size_t          wordsize = pf->header->wordsize;
+    const size_t          size     = PF_fetch_opcode(pf, &cursor);
+    const unsigned char * const image = (const unsigned char *)cursor;
+    INTVAL                type;
+
+    if (size < 2 * wordsize
+    ||  PackID_get_FLAGS(pf->fetch_iv(image)) != enum_PackID_normal)
+        return 0;
+
+    type = pf->fetch_iv(image + wordsize);
+
+    return type == enum_class_Key || type == enum_class_FixedIntegerArray;
+}
+
+
+/*
+
+=item C<static size_t frozen_image_size(const PackFile *pf, const opcode_t
+*cursor)>
+
+Returns the size in bytes of the frozen PMC constant at C<cursor>, including
+its length word and padding.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static size_t
+frozen_image_size(ARGIN(const PackFile *pf), ARGIN(const opcode_t *cursor))
+{
+    ASSERT_ARGS(frozen_image_size)
+    const size_t wordsize = pf->header->wordsize;
+    const size_t size     = PF_fetch_opcode(pf, &cursor);
+
+    return wordsize + (size + wordsize - 1) / wordsize * wordsize;
+}
+
+
+/*
+
+=item C<static void keep_frozen_constants(PARROT_INTERP, PackFile_ConstTable
+*ct)>
+
+Finishes unpacking C<ct>. Its still frozen PMC constants are copied, unless
+they sit in a mapped file that lives as long as the table. The table is then
+registered with the interpreter.
+
+=cut
+
+*/
+
+static void
+keep_frozen_constants(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct))
+{
+    ASSERT_ARGS(keep_frozen_constants)
+    PackFile_FrozenConstants * const frozen = ct->frozen;
+    const PackFile           * const pf     = ct->base.pf;
+    opcode_t                         i;
+
+    frozen->loading = 0;
+
+    if (!frozen->count) {
+        release_frozen_constants(interp, ct);
+        return;
+    }
+
+    if (!pf->is_mmap_ped || pf->need_endianize || pf->need_wordsize) {
+        size_t  total = 0;
+        char   *data;
+
+        for (i = 0; i < ct->pmc.const_count; i++)
+            if (frozen->images[i])
+                total += frozen_image_size(pf, frozen->images[i]);
+
+        frozen->data = mem_gc_allocate_n_typed(interp,
+                (total + sizeof (opcode_t) - 1) / sizeof (opcode_t), opcode_t);
+        data         = (char *)frozen->data;
+
+        for (i = 0; i < ct->pmc.const_count; i++) {
+            if (frozen->images[i]) {
+                const size_t size = frozen_image_size(pf, frozen->images[i]);
+                memcpy(data, frozen->images[i], size);
+                frozen->images[i] = (const opcode_t *)data;
+                data += size;
+            }
+        }
+    }
+
+    frozen->next                = interp->frozen_const_tables;
+    interp->frozen_const_tables = ct;
+}
+
+
+/*
+
+=item C<static void release_frozen_constants(PARROT_INTERP, PackFile_ConstTable
+*ct)>
+
+Unregisters C<ct> from the interpreter owning its frozen PMC constants and
+frees what is left of them.
+
+=cut
+
+*/
+
+static void
+release_frozen_constants(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct))
+{
+    ASSERT_ARGS(release_frozen_constants)
+    PackFile_FrozenConstants * const frozen = ct->frozen;
+    PackFile_ConstTable     **link          = &frozen->interp->frozen_const_tables;
+
+    while (*link && *link != ct)
+        link = &(*link)->frozen->next;
+
+    if (*link)
+        *link = frozen->next;
+
+    if (frozen->data)
+        mem_gc_free(interp, frozen->data);
+
+    mem_gc_free(interp, frozen->images);
+    mem_gc_free(interp, frozen);
+    ct->frozen = NULL;
+}
+
+
+/*
+
+=item C<static PMC * thaw_frozen_constant(PARROT_INTERP, PackFile_ConstTable
+*ct, INTVAL idx)>
+
+Thaws the frozen PMC constant C<idx> of C<ct> and returns the list of objects
+in its graph. While C<ct> is being unpacked, the list goes into the constant
+slot like all others; afterwards the slot gets the constant itself.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+thaw_frozen_constant(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct), INTVAL idx)
+{
+    ASSERT_ARGS(thaw_frozen_constant)
+    PackFile_FrozenConstants * const frozen = ct->frozen;
+    const opcode_t                  *cursor = frozen->images[idx];
+    PMC                      * const list   = const_unpack_pmc(interp, ct, &cursor);
+
+    frozen->images[idx] = NULL;
+    frozen->count--;
+
+    if (frozen->loading)
+        ct->pmc.constants[idx] = list;
+    else {
+        PMC * const pmc = VTABLE_get_pmc_keyed_int(interp, list, 0);
+
+        PObj_is_shared_SET(pmc); /* packfile constants will be shared among threads */
+        ct->pmc.constants[idx] = pmc;
+
+        if (!frozen->count)
+            release_frozen_constants(interp, ct);
+    }
+
+    return list;
+}
+
+
+/*
+
+=item C<PMC * Parrot_pf_ConstTable_thaw_pmc(PARROT_INTERP, PackFile_ConstTable
+*ct, INTVAL idx)>
+
+Returns the PMC constant C<idx> of C<ct>, thawing it first if it is still
+frozen. The constant is created by the interpreter that loaded the table.
+Use C<PF_CONST_PMC> to only call this for empty slots.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_pf_ConstTable_thaw_pmc(SHIM_INTERP, ARGMOD(PackFile_ConstTable *ct), INTVAL idx)
+{
+    ASSERT_ARGS(Parrot_pf_ConstTable_thaw_pmc)
+    PackFile_FrozenConstants * const frozen = ct->frozen;
+
+    if (frozen && !frozen->loading && frozen->images[idx]) {
+        Interp   * const owner = frozen->interp;
+        PackFile * const pf    = ct->base.pf;
+
+        Parrot_block_GC_mark(owner);
+        thaw_frozen_constant(owner, ct, idx);
+        Parrot_unblock_GC_mark(owner);
+
+        if (pf->view)
+            PARROT_GC_WRITE_BARRIER(owner, pf->view);
+    }
+
+    return ct->pmc.constants[idx];
+}
+
+
+/*
+
+=item C<PMC * Parrot_pf_ConstTable_thaw_backref(PARROT_INTERP,
+PackFile_ConstTable *ct, INTVAL constno, INTVAL idx)>
+
+Resolves a reference from a frozen image to object C<idx> in the graph of the
+PMC constant C<constno> of C<ct>, thawing that constant if needed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_pf_ConstTable_thaw_backref(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct),
+        INTVAL constno, INTVAL idx)
+{
+    ASSERT_ARGS(Parrot_pf_ConstTable_thaw_backref)
+    PackFile_FrozenConstants * const frozen = ct->frozen;
+
+    if (constno < 0 || constno >= ct->pmc.const_count)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Reference to PMC constant %d out of range", (int)constno);
+
+    if (frozen && frozen->images[constno]) {
+        PMC * const list = thaw_frozen_constant(interp, ct, constno);
+        return VTABLE_get_pmc_keyed_int(interp, list, idx);
+    }
+
+    /* every slot holds the list of objects of its graph while unpacking */
+    if (!frozen || frozen->loading)
+        return VTABLE_get_pmc_keyed_int(interp, ct->pmc.constants[constno], idx);
+
+    if (idx)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+                "Reference into thawed PMC constant %d", (int)constno);
+
+    return ct->pmc.constants[constno];
+}
+
+
+/*
+
+=item C<void Parrot_pf_ConstTable_thaw_all(PARROT_INTERP, PackFile_ConstTable
+*ct)>
+
+Thaws all PMC constants of C<ct> that are still frozen.
+
+=item C<void Parrot_pf_thaw_frozen_constants(PARROT_INTERP)>
+
+Thaws the frozen PMC constants of every table loaded by C<interp>. Interpreters
+sharing its code, such as threads, can then use the constants directly.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pf_ConstTable_thaw_all(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct))
+{
+    ASSERT_ARGS(Parrot_pf_ConstTable_thaw_all)
+    opcode_t i;
+
+    for (i = 0; ct->frozen && i < ct->pmc.const_count; i++)
+        (void)Parrot_pf_ConstTable_thaw_pmc(interp, ct, i);
+}
+
+PARROT_EXPORT
+void
+Parrot_pf_thaw_frozen_constants(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pf_thaw_frozen_constants)
+
+    while (interp->frozen_const_tables)
+        Parrot_pf_ConstTable_thaw_all(interp, interp->frozen_const_tables);
+}
+
+
 /*
 
 =item C<static PackFile_Segment * annotations_new(PARROT_INTERP)>
@@ -2140,6 +2535,9 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     if (byte_code->libdeps)
         mem_gc_free(interp, byte_code->libdeps);
 
+    if (byte_code->cgoto_code)
+        mem_gc_free(interp, byte_code->cgoto_code);
+
     if (byte_code->annotations)
         annotations_destroy(interp, (PackFile_Segment *)byte_code->annotations);
 
@@ -2150,6 +2548,9 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     byte_code->op_info_table   = NULL;
     byte_code->op_mapping.libs = NULL;
     byte_code->libdeps         = NULL;
+    byte_code->cgoto_code      = NULL;
+    byte_code->cgoto_size      = 0;
+    byte_code->cgoto_translate = NULL;
 }
 
 
@@ -63,6 +63,10 @@ This code implements POSIX and WIN32 socket functions for Parrot.
 #    include <netdb.h>
 #  endif /* PARROT_HAS_HEADER_NETDB */
 
+#  ifdef PARROT_HAS_HEADER_SYSEPOLL
+#    include <sys/epoll.h>
+#  endif /* PARROT_HAS_HEADER_SYSEPOLL */
+
 #endif /* _WIN32 */
 
 #include "parrot/parrot.h"
@@ -116,6 +120,31 @@ typedef socklen_t Parrot_Socklen_t;
 typedef int Parrot_Socklen_t;
 #endif
 
+#if defined(PARROT_HAS_HEADER_SYSEPOLL) && !defined(_WIN32)
+#  define PIO_REACTOR_EPOLL
+#endif
+
+/* Most ready handles taken from the kernel per wait */
+#define PIO_REACTOR_MAX_EVENTS 32
+
+/*
+ * A set of handles waited on together.  Every handle added is reported once,
+ * when it becomes ready, and must be added again to wait for it once more.
+ */
+
+struct Parrot_io_reactor {
+    int        epoll_fd;        /* with epoll, and the events taken per wait */
+#ifdef PIO_REACTOR_EPOLL
+    struct epoll_event events[PIO_REACTOR_MAX_EVENTS];
+#endif
+    PIOHANDLE *handles;         /* with select, the handles waited on ... */
+    INTVAL    *which;           /* ... and the events for each */
+    INTVAL     count;
+    INTVAL     alloced;
+    fd_set     sets[3];         /* with select, read, write and error sets */
+    int        wake_fds[2];     /* a byte written to wake_fds[1] ends a wait */
+};
+
 /*
  * Mapping between PIO_PF_* constants and system-specific PF_* constants.
  *
@@ -741,6 +770,12 @@ Parrot_io_internal_poll(PARROT_INTERP, PIOHANDLE os_handle, int which, int sec,
     int n;
     PIOSOCKET sock = (PIOSOCKET)os_handle;
 
+#ifndef _WIN32
+    if (sock >= FD_SETSIZE)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Can't poll handle %d beyond FD_SETSIZE", (int)sock);
+#endif
+
     t.tv_sec = sec;
     t.tv_usec = usec;
     FD_ZERO(&r); FD_ZERO(&w); FD_ZERO(&e);
@@ -789,6 +824,327 @@ Parrot_io_internal_close_socket(SHIM_INTERP, PIOHANDLE handle)
 
 /*
 
+=item C<Parrot_io_reactor * Parrot_io_internal_reactor_new(PARROT_INTERP)>
+
+Creates a reactor, a set of handles which can be waited on together.  Uses
+epoll where available and C<select> otherwise.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+Parrot_io_reactor *
+Parrot_io_internal_reactor_new(PARROT_INTERP)
+{
+    Parrot_io_reactor * const reactor = mem_internal_allocate_zeroed_typed(Parrot_io_reactor);
+
+#ifndef _WIN32
+    if (pipe(reactor->wake_fds) < 0) {
+        const int err = errno;
+        mem_internal_free(reactor);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "pipe failed: %Ss", Parrot_platform_strerror(interp, err));
+    }
+    fcntl(reactor->wake_fds[0], F_SETFL, O_NONBLOCK);
+    fcntl(reactor->wake_fds[1], F_SETFL, O_NONBLOCK);
+#endif
+
+#if !defined(PIO_REACTOR_EPOLL) && !defined(_WIN32)
+    /* select can't wait for the wake-up pipe beyond FD_SETSIZE */
+    if (reactor->wake_fds[0] >= FD_SETSIZE) {
+        const int fd = reactor->wake_fds[0];
+        close(reactor->wake_fds[0]);
+        close(reactor->wake_fds[1]);
+        mem_internal_free(reactor);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Can't wait for handle %d beyond FD_SETSIZE", fd);
+    }
+#endif
+
+#ifdef PIO_REACTOR_EPOLL
+    reactor->epoll_fd = epoll_create(PIO_REACTOR_MAX_EVENTS);
+    if (reactor->epoll_fd >= 0) {
+        struct epoll_event ev;
+        ev.events  = EPOLLIN;
+        ev.data.fd = reactor->wake_fds[0];
+        if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, reactor->wake_fds[0], &ev) < 0) {
+            close(reactor->epoll_fd);
+            reactor->epoll_fd = -1;
+        }
+    }
+    if (reactor->epoll_fd < 0) {
+        const int err = errno;
+        close(reactor->wake_fds[0]);
+        close(reactor->wake_fds[1]);
+        mem_internal_free(reactor);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "epoll failed: %Ss", Parrot_platform_strerror(interp, err));
+    }
+#endif
+
+    return reactor;
+}
+
+/*
+
+=item C<void Parrot_io_internal_reactor_destroy(Parrot_io_reactor *reactor)>
+
+Closes C<reactor> and frees its memory.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_reactor_destroy(ARGFREE(Parrot_io_reactor *reactor))
+{
+#ifdef PIO_REACTOR_EPOLL
+    close(reactor->epoll_fd);
+#else
+    mem_internal_free(reactor->handles);
+    mem_internal_free(reactor->which);
+#endif
+#ifndef _WIN32
+    close(reactor->wake_fds[0]);
+    close(reactor->wake_fds[1]);
+#endif
+    mem_internal_free(reactor);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_internal_reactor_add(PARROT_INTERP, Parrot_io_reactor
+*reactor, PIOHANDLE handle, INTVAL which)>
+
+Waits for C<handle> in C<reactor> until it is ready for the events in
+C<which>, the same bitmask as for C<Parrot_io_internal_poll>.  Returns 1
+without waiting if the handle is always ready, like a plain file, and 0
+otherwise.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_reactor_add(PARROT_INTERP, ARGMOD(Parrot_io_reactor *reactor),
+        PIOHANDLE handle, INTVAL which)
+{
+#ifdef PIO_REACTOR_EPOLL
+    struct epoll_event ev;
+    ev.events   = EPOLLONESHOT;
+    ev.events  |= which & 1 ? EPOLLIN  : 0;
+    ev.events  |= which & 2 ? EPOLLOUT : 0;
+    ev.events  |= which & 4 ? EPOLLPRI : 0;
+    ev.data.u64 = 0;
+    ev.data.fd  = (int)handle;
+
+    /* Handles stay in the epoll set after firing, so try re-arming first */
+    if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_MOD, (int)handle, &ev) == 0)
+        return 0;
+    if (errno == ENOENT
+    &&  epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, (int)handle, &ev) == 0)
+        return 0;
+    if (errno == EPERM)
+        return 1;
+
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "epoll_ctl failed: %Ss", Parrot_platform_strerror(interp, errno));
+#else
+#  ifndef _WIN32
+    if (handle >= FD_SETSIZE)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Can't wait for handle %d beyond FD_SETSIZE", (int)handle);
+#  endif
+
+    if (reactor->count == reactor->alloced) {
+        reactor->alloced = reactor->alloced ? reactor->alloced * 2 : 16;
+        mem_internal_realloc_n_typed(reactor->handles, reactor->alloced, PIOHANDLE);
+        mem_internal_realloc_n_typed(reactor->which,   reactor->alloced, INTVAL);
+    }
+    reactor->handles[reactor->count] = handle;
+    reactor->which[reactor->count]   = which;
+    ++reactor->count;
+#endif
+
+    return 0;
+}
+
+/*
+
+=item C<void Parrot_io_internal_reactor_remove(PARROT_INTERP, Parrot_io_reactor
+*reactor, PIOHANDLE handle)>
+
+Stops waiting for C<handle> in C<reactor>.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_reactor_remove(SHIM_INTERP, ARGMOD(Parrot_io_reactor *reactor),
+        PIOHANDLE handle)
+{
+#ifdef PIO_REACTOR_EPOLL
+    /* kernels before 2.6.9 insist on an event, even though it is ignored */
+    struct epoll_event ev;
+    ev.events   = 0;
+    ev.data.u64 = 0;
+    epoll_ctl(reactor->epoll_fd, EPOLL_CTL_DEL, (int)handle, &ev);
+#else
+    INTVAL i;
+    for (i = 0; i < reactor->count; ++i) {
+        if (reactor->handles[i] == handle) {
+            --reactor->count;
+            reactor->handles[i] = reactor->handles[reactor->count];
+            reactor->which[i]   = reactor->which[reactor->count];
+            break;
+        }
+    }
+#endif
+}
+
+/*
+
+=item C<INTVAL Parrot_io_internal_reactor_wait(PARROT_INTERP, Parrot_io_reactor
+*reactor, PIOHANDLE *ready, INTVAL max, FLOATVAL timeout)>
+
+Waits up to C<timeout> seconds for handles in C<reactor> to become ready, or
+until C<Parrot_io_internal_reactor_wake> is called.  A negative C<timeout>
+waits without a limit.  Stores up to C<max> ready handles in C<ready> and
+returns their number.  The returned handles are no longer waited for.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_reactor_wait(PARROT_INTERP, ARGMOD(Parrot_io_reactor *reactor),
+        ARGOUT(PIOHANDLE *ready), INTVAL max, FLOATVAL timeout)
+{
+    INTVAL count = 0;
+#ifndef _WIN32
+    int    woken = 0;
+#endif
+#ifdef PIO_REACTOR_EPOLL
+    struct epoll_event * const events = reactor->events;
+    /* round up, so a wait for an alarm doesn't end just before it is due */
+    const int ms = timeout < 0.0 ? -1 : (int)(timeout * 1000.0 + 0.999);
+    int i, n;
+
+    if (max > PIO_REACTOR_MAX_EVENTS)
+        max = PIO_REACTOR_MAX_EVENTS;
+
+    n = epoll_wait(reactor->epoll_fd, events, (int)max, ms);
+    if (n < 0) {
+        if (errno == EINTR)
+            return 0;
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "epoll_wait failed: %Ss", Parrot_platform_strerror(interp, errno));
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (events[i].data.fd == reactor->wake_fds[0])
+            woken = 1;
+        else
+            ready[count++] = (PIOHANDLE)events[i].data.fd;
+    }
+#else
+    fd_set * const r = &reactor->sets[0];
+    fd_set * const w = &reactor->sets[1];
+    fd_set * const e = &reactor->sets[2];
+    struct timeval t, *tp = NULL;
+    PIOSOCKET max_fd = 0;
+    INTVAL i;
+    int n;
+
+    FD_ZERO(r); FD_ZERO(w); FD_ZERO(e);
+#  ifdef _WIN32
+    /* Nothing can interrupt the wait, so look at new tasks now and then */
+    if (timeout < 0.0 || timeout > 0.01)
+        timeout = 0.01;
+    if (!reactor->count) {
+        Sleep((DWORD)(timeout * 1000.0));
+        return 0;
+    }
+#  else
+    FD_SET(reactor->wake_fds[0], r);
+    max_fd = reactor->wake_fds[0];
+#  endif
+    for (i = 0; i < reactor->count; ++i) {
+        const PIOSOCKET sock = (PIOSOCKET)reactor->handles[i];
+        if (reactor->which[i] & 1) FD_SET(sock, r);
+        if (reactor->which[i] & 2) FD_SET(sock, w);
+        if (reactor->which[i] & 4) FD_SET(sock, e);
+        if (sock > max_fd)
+            max_fd = sock;
+    }
+    if (timeout >= 0.0) {
+        t.tv_sec  = (long)timeout;
+        t.tv_usec = (long)((timeout - t.tv_sec) * 1000000.0);
+        tp = &t;
+    }
+
+    n = select(max_fd + 1, r, w, e, tp);
+    if (n < 0) {
+        if (PIO_SOCK_ERRNO == PIO_SOCK_EINTR)
+            return 0;
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "select failed: %Ss",
+                Parrot_platform_strerror(interp, PIO_SOCK_ERRNO));
+    }
+
+#  ifndef _WIN32
+    woken = FD_ISSET(reactor->wake_fds[0], r);
+#  endif
+    for (i = 0; i < reactor->count && count < max; ++i) {
+        const PIOSOCKET sock = (PIOSOCKET)reactor->handles[i];
+        if (FD_ISSET(sock, r) || FD_ISSET(sock, w) || FD_ISSET(sock, e)) {
+            ready[count++] = reactor->handles[i];
+            --reactor->count;
+            reactor->handles[i] = reactor->handles[reactor->count];
+            reactor->which[i]   = reactor->which[reactor->count];
+            --i;
+        }
+    }
+#endif
+
+#ifndef _WIN32
+    if (woken) {
+        char buf[64];
+        while (read(reactor->wake_fds[0], buf, sizeof (buf)) > 0)
+            ;
+    }
+#endif
+
+    return count;
+}
+
+/*
+
+=item C<void Parrot_io_internal_reactor_wake(Parrot_io_reactor *reactor)>
+
+Ends a wait in C<reactor> from another thread.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_reactor_wake(ARGMOD(Parrot_io_reactor *reactor))
+{
+#ifndef _WIN32
+    /* If the pipe is full, there is a wake-up pending anyway */
+    const char c = 0;
+    const ssize_t written = write(reactor->wake_fds[1], &c, 1);
+    UNUSED(written)
+#else
+    UNUSED(reactor)
+#endif
+}
+
+/*
+
 =back
 
 =head1 SEE ALSO
@@ -346,7 +346,7 @@ Parrot_pmc_reuse_noinit(PARROT_INTERP, ARGMOD(PMC *pmc), INTVAL new_type)
     ASSERT_ARGS(Parrot_pmc_reuse_noinit)
 
     if (pmc->vtable->base_type != new_type) {
-        const Parrot_UInt gc_flags = pmc->flags & PObj_GC_all_FLAGS;
+        const Parrot_UInt gc_flags = pmc->flags & (PObj_GC_all_FLAGS | PObj_live_FLAG);
         VTABLE * const new_vtable  = interp->vtables[new_type];
 
         /* Singleton/const PMCs/types are not eligible */
@@ -357,6 +357,7 @@ Parrot_pmc_reuse_noinit(PARROT_INTERP, ARGMOD(PMC *pmc), INTVAL new_type)
 
         /*
          * We can reuse PMC from older generation. Preserve and soil it.
+         * Keep the live bit too, an incremental GC may be marking it.
          *
          * FIXME It's abstraction leak. And it's really strange idea of reusing
          * PMCs...
@@ -400,14 +401,17 @@ Parrot_pmc_reuse_by_class(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(PMC *class_), U
     const INTVAL   new_type   = PARROT_CLASS(class_)->id;
 
     if (pmc->vtable->base_type != new_type) {
-        VTABLE * const new_vtable = interp->vtables[new_type];
+        const Parrot_UInt gc_flags = pmc->flags & (PObj_GC_all_FLAGS | PObj_live_FLAG);
+        VTABLE * const new_vtable  = interp->vtables[new_type];
 
         /* Singleton/const PMCs/types are not eligible */
         check_pmc_reuse_flags(interp, pmc->vtable->flags, new_vtable->flags);
 
         Parrot_pmc_destroy(interp, pmc);
 
-        PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG | flags);
+        /* Preserve the GC state, see Parrot_pmc_reuse_noinit */
+        PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG | gc_flags | flags);
+        PARROT_GC_WRITE_BARRIER(interp, pmc);
 
         /* Set the right vtable */
         pmc->vtable = new_vtable;
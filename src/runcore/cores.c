@@ -188,6 +188,13 @@ The caveat of course is that the predereferenced computed goto core is only
 available with compilers that support computed goto, such as GCC. Parrot
 will not have access to this core if it is built with a different compiler.
 
+Parrot's C<cgoto> core is built this way. Its dispatch function is generated
+by ops2c into F<src/ops/core_ops_cg.c>. The label addresses for a code segment
+are filled in lazily, the first time the op at a given offset runs, and ops
+from dynamic oplibs are called through the segment's function table. Unlike
+the fast core it only stores the current pc into the context before ops which
+call out of the op body, i.e. ops which may throw, invoke or allocate.
+
 =head2 Tracing Core
 
 Essentially a slow core with added debugging output per op.
@@ -243,6 +250,7 @@ next opcode, or examine and manipulate data from the executing program.
 
 #include "parrot/oplib/ops.h"
 #include "parrot/oplib/core_ops.h"
+#include "parrot/oplib/core_ops_cg.h"
 #include "parrot/dynext.h"
 
 #include "pmc/pmc_sub.h"
@@ -253,6 +261,14 @@ next opcode, or examine and manipulate data from the executing program.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_cgoto_core(PARROT_INTERP,
+    Parrot_runcore_t *runcore,
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static opcode_t * runops_debugger_core(PARROT_INTERP,
@@ -300,6 +316,9 @@ static opcode_t * runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_runops_cgoto_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_runops_debugger_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
@@ -383,6 +402,37 @@ Parrot_runcore_fast_init(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<void Parrot_runcore_cgoto_init(PARROT_INTERP)>
+
+Registers the direct-threaded computed goto runcore with Parrot.  Only call
+this when C<PARROT_HAS_CGOTO> is set.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_cgoto_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "cgoto");
+    coredata->id               = PARROT_CGOTO_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_cgoto_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = NULL;
+    coredata->flags            = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
 /*
 
 =item C<void Parrot_runcore_exec_init(PARROT_INTERP)>
@@ -499,6 +549,39 @@ runops_fast_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t
 }
 
 
+/*
+
+=item C<static opcode_t * runops_cgoto_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, dispatching through the generated computed goto core.  Like the
+fast core this performs no bounds checking, profiling, or tracing.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_cgoto_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_cgoto_core)
+
+#if PARROT_HAS_CGOTO
+    return core_cg_runops(interp, pc);
+#else
+    while (pc) {
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+        DO_OP(pc, interp);
+    }
+
+    return pc;
+#endif
+}
+
+
 #ifdef code_start
 #  undef code_start
 #endif
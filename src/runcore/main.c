@@ -68,6 +68,9 @@ Parrot_runcore_init(PARROT_INTERP)
 
     Parrot_runcore_slow_init(interp);
     Parrot_runcore_fast_init(interp);
+#if PARROT_HAS_CGOTO
+    Parrot_runcore_cgoto_init(interp);
+#endif
 
     Parrot_runcore_subprof_init(interp);
     /* Parrot_runcore_exec_init(interp); */
@@ -400,7 +403,8 @@ Replace func table with one that does event checking for all opcodes.
 NOTE: C<enable_event_checking()> is called async by the event handler
 thread. All action done from here has to be async safe.
 
-XXX This is only implemented for the function core at present.
+XXX This is only implemented for the function table cores and the computed
+goto core at present.
 
 =cut
 
@@ -438,6 +442,14 @@ Parrot_runcore_enable_event_checking(PARROT_INTERP)
 
     /* put evc table in place */
     cs->op_func_table   = interp->evc_func_table;
+
+    /* unbind the ops of the computed goto core, so it sees the swapped table */
+    if (cs->cgoto_code) {
+        size_t i;
+
+        for (i = 0; i < cs->cgoto_size; ++i)
+            cs->cgoto_code[i] = cs->cgoto_translate;
+    }
 }
 
 
@@ -37,9 +37,16 @@ exceptions, async I/O, and concurrent tasks (threads).
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void io_task_ready(PARROT_INTERP, ARGIN(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static int Parrot_cx_preemption_enabled(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+#define ASSERT_ARGS_io_task_ready __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(task))
 #define ASSERT_ARGS_Parrot_cx_preemption_enabled __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -132,10 +139,11 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
     ASSERT_ARGS(Parrot_cx_outer_runloop)
     PMC * const scheduler = interp->scheduler;
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    INTVAL alarm_count, foreign_count, i;
+    INTVAL alarm_count, foreign_count, io_count, i;
 
     /* Main loop. Continue to loop so long as we have any tasks, any alarms,
-       or any foreign tasks to execute. If we have none of these things, exit. */
+       any foreign tasks to execute or any tasks waiting for handles. If we
+       have none of these things, exit. */
     do {
         /* If we have tasks in the scheduler, run them in a loop until there
            are no more. */
@@ -148,8 +156,9 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
 
             Parrot_cx_next_task(interp, scheduler);
 
-            /* add expired alarms to the task queue */
+            /* add expired alarms and tasks with ready handles to the task queue */
             Parrot_cx_check_alarms(interp, interp->scheduler);
+            Parrot_cx_check_io(interp, interp->scheduler, 0.0);
         }
 
         /* Loop over all foreign tasks in the scheduler. If the foreign task
@@ -166,16 +175,20 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
             UNLOCK(PARROT_TASK(task)->waiters_lock);
         }
 
-        /* If we have no scheduled tasks, but we do have an alarm or foreign
-           task, we can wait for one of those before we start executing things
-           again. */
+        /* If we have no scheduled tasks, but we do have an alarm, foreign
+           task or task waiting for a handle, we can wait for one of those
+           before we start executing things again. */
         alarm_count = VTABLE_get_integer(interp, sched->alarms);
-        if (VTABLE_get_integer(interp, scheduler) == 0 && (alarm_count > 0 || foreign_count > 0)) {
-            /* Nothing to do except to wait for the next alarm to expire */
+        io_count    = Parrot_cx_io_waiting(interp);
+        if (VTABLE_get_integer(interp, scheduler) == 0
+        && (alarm_count > 0 || foreign_count > 0 || io_count > 0)) {
+            /* Nothing to do except to wait for the next alarm to expire or
+               a handle to become ready */
             Parrot_thread_wait_for_notification(interp);
             Parrot_cx_check_alarms(interp, interp->scheduler);
         }
-    } while (alarm_count || foreign_count || VTABLE_get_integer(interp, scheduler) > 0);
+    } while (alarm_count || foreign_count || io_count
+          || VTABLE_get_integer(interp, scheduler) > 0);
 }
 
 /*
@@ -236,6 +249,7 @@ Parrot_cx_next_task(PARROT_INTERP, ARGIN(PMC *scheduler))
 =item C<opcode_t* Parrot_cx_check_scheduler(PARROT_INTERP, opcode_t *next)>
 
 Does the scheduler need to wake up and do anything? If so, do that now.
+Also gives an incremental collection of the GC its next slice.
 
 =cut
 
@@ -248,6 +262,9 @@ Parrot_cx_check_scheduler(PARROT_INTERP, ARGIN(opcode_t *next))
     ASSERT_ARGS(Parrot_cx_check_scheduler)
     PMC * const scheduler = interp->scheduler;
 
+    /* Let an incremental GC go on marking */
+    Parrot_gc_mark_slice(interp);
+
     /* If we have any outstanding alarms, or if we have been requested to
        wake up, run the scheduler. */
     if (Parrot_alarm_check(&(interp->last_alarm))
@@ -441,40 +458,21 @@ Parrot_cx_schedule_task(PARROT_INTERP, ARGIN(PMC *task_or_sub))
             "Can only schedule Tasks and Subs");
 
 #ifdef PARROT_HAS_THREADS
-    /* Search for a thread that is free. If we have a free thread, schedule
-       the task there. Otherwise, find the thread with the fewest tasks in its
-       queue and schedule it there. */
+    /* Start a new thread while there are free slots, then push the task onto
+       our own deque.  Threads which run out of work steal from there. */
     index = Parrot_thread_get_free_threads_array_index(NULL);
-    if (index > -1) { /* start a new thread */
+    if (index > -1) {
         PMC * const thread = Parrot_thread_create(interp,
                                                   enum_class_ParrotInterpreter,
                                                   PARROT_CLONE_DEFAULT);
         Interp * const thread_interp = (Interp *)VTABLE_get_pointer(interp, thread);
-        Parrot_thread_schedule_task(interp, thread_interp, task);
+        Parrot_thread_schedule_task(interp, task);
         Parrot_thread_insert_thread(interp, thread_interp, index);
         Parrot_thread_run(interp, thread, task, NULL);
     }
     else {
-        /* find the thread with the fewest tasks */
-        Interp ** const threads_array = Parrot_thread_get_threads_array(interp);
-        int numthreads = Parrot_get_num_threads(interp);
-        Interp * candidate = NULL;
-        int i, min_tasks = INT_MAX;
-
-        for (i = 1; i < numthreads; i++)
-            if (threads_array[i]) {
-                int const tasks = VTABLE_get_integer(threads_array[i], threads_array[i]->scheduler);
-                if (tasks < min_tasks) {
-                    min_tasks = tasks;
-                    candidate = threads_array[i];
-                }
-            }
-        if (candidate == NULL)
-            Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
-                "Could not find a free thread");
-
-        Parrot_thread_schedule_task(interp, candidate, task);
-        Parrot_thread_notify_thread(candidate);
+        Parrot_thread_schedule_task(interp, task);
+        Parrot_thread_notify_idle_thread(interp);
 
         /* going from single to multi tasking? */
         if (VTABLE_get_integer(interp, interp->scheduler) == 1)
@@ -530,6 +528,112 @@ Parrot_cx_schedule_immediate(PARROT_INTERP, ARGIN(PMC *task_or_sub))
 
 /*
 
+=item C<PMC * Parrot_cx_schedule_io(PARROT_INTERP, PMC *handle, INTVAL which,
+PMC *task_or_sub)>
+
+Parks a task until C<handle> is ready for the events in C<which>, 1 for
+reading, 2 for writing and 4 for exceptions, as for C<Socket.poll>.  The
+interpreter goes on running other tasks meanwhile; the outer runloop queues
+the task once the handle is ready.  A Sub is called with the handle.
+Without a C<task_or_sub>, parks a new
+Task without code, which is done once the handle is ready, so that other
+tasks can C<wait> for it.  Only one task at a time may wait for a handle.
+Returns the parked task.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_cx_schedule_io(PARROT_INTERP, ARGIN(PMC *handle), INTVAL which,
+        ARGIN_NULLOK(PMC *task_or_sub))
+{
+    ASSERT_ARGS(Parrot_cx_schedule_io)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+    PIOHANDLE os_handle;
+    PMC *task;
+
+    if (PMC_IS_NULL(task_or_sub))
+        task = Parrot_pmc_new(interp, enum_class_Task);
+    else if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Task")))
+        task = task_or_sub;
+    else if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Sub"))) {
+        task = Parrot_pmc_new(interp, enum_class_Task);
+        PARROT_TASK(task)->code = task_or_sub;
+        PARROT_TASK(task)->data = handle;
+        PARROT_GC_WRITE_BARRIER(interp, task);
+    }
+    else
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+            "Can only schedule Tasks and Subs");
+
+    if (Parrot_io_is_closed(interp, handle))
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_PIO_ERROR,
+            "Can't wait for a closed handle");
+
+    /* Buffered data can be read right away */
+    if (which & 1) {
+        IO_BUFFER * const buffer = IO_GET_READ_BUFFER(interp, handle);
+        if (buffer && Parrot_io_buffer_content_size(interp, buffer) > 0) {
+            io_task_ready(interp, task);
+            return task;
+        }
+    }
+
+    os_handle = Parrot_io_get_os_handle(interp, handle);
+
+    if (PMC_IS_NULL(sched->io_waiters)) {
+        sched->io_waiters = Parrot_pmc_new(interp, enum_class_Hash);
+        VTABLE_set_integer_native(interp, sched->io_waiters, Hash_key_type_int);
+        PARROT_GC_WRITE_BARRIER(interp, interp->scheduler);
+    }
+    else if (!PMC_IS_NULL(VTABLE_get_pmc_keyed_int(interp, sched->io_waiters,
+            (INTVAL)os_handle)))
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+            "Another task is already waiting for this handle");
+
+    if (!sched->reactor)
+        sched->reactor = Parrot_io_internal_reactor_new(interp);
+
+    if (Parrot_io_internal_reactor_add(interp, sched->reactor, os_handle, which))
+        io_task_ready(interp, task);
+    else
+        VTABLE_set_pmc_keyed_int(interp, sched->io_waiters, (INTVAL)os_handle, task);
+
+    return task;
+}
+
+/*
+
+=item C<void Parrot_cx_cancel_io(PARROT_INTERP, PMC *handle)>
+
+Stops waiting for C<handle>, which is about to be closed.  The task waiting
+for it is queued nonetheless, and finds the handle closed.
+
+=cut
+
+*/
+
+void
+Parrot_cx_cancel_io(PARROT_INTERP, ARGIN(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_cx_cancel_io)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+    const PIOHANDLE os_handle = Parrot_io_get_os_handle(interp, handle);
+    PMC * const task = VTABLE_get_pmc_keyed_int(interp, sched->io_waiters,
+                            (INTVAL)os_handle);
+
+    if (!PMC_IS_NULL(task)) {
+        VTABLE_delete_keyed_int(interp, sched->io_waiters, (INTVAL)os_handle);
+        Parrot_io_internal_reactor_remove(interp, sched->reactor, os_handle);
+        io_task_ready(interp, task);
+    }
+}
+
+/*
+
 =item C<PMC* Parrot_cx_current_task(PARROT_INTERP)>
 
 Returns the task that is currently running.
@@ -649,6 +753,73 @@ Parrot_cx_check_alarms(PARROT_INTERP, ARGIN(PMC *scheduler))
 
 /*
 
+=item C<INTVAL Parrot_cx_io_waiting(PARROT_INTERP)>
+
+Returns the number of tasks waiting for handles to become ready.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_cx_io_waiting(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_cx_io_waiting)
+    PMC * const io_waiters = PARROT_SCHEDULER(interp->scheduler)->io_waiters;
+
+    return PMC_IS_NULL(io_waiters) ? 0 : VTABLE_elements(interp, io_waiters);
+}
+
+/*
+
+=item C<void Parrot_cx_check_io(PARROT_INTERP, PMC *scheduler, FLOATVAL
+timeout)>
+
+Waits up to C<timeout> seconds for the handles of tasks parked by
+C<Parrot_cx_schedule_io> and adds the tasks whose handles are ready to the
+task queue.  A negative C<timeout> waits until a handle is ready, the next
+alarm is due or another thread calls C<Parrot_thread_notify_thread>.
+
+=cut
+
+*/
+
+void
+Parrot_cx_check_io(PARROT_INTERP, ARGIN(PMC *scheduler), FLOATVAL timeout)
+{
+    ASSERT_ARGS(Parrot_cx_check_io)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PIOHANDLE ready[32];
+    INTVAL i, count;
+
+    if (PMC_IS_NULL(sched->io_waiters) || !VTABLE_elements(interp, sched->io_waiters))
+        return;
+
+    if (timeout < 0.0 && VTABLE_get_integer(interp, sched->alarms) > 0) {
+        PMC * const alarm = VTABLE_shift_pmc(interp, sched->alarms);
+        timeout = VTABLE_get_number(interp, alarm) - Parrot_floatval_time();
+        VTABLE_unshift_pmc(interp, sched->alarms, alarm);
+        if (timeout < 0.0)
+            timeout = 0.0;
+    }
+
+    count = Parrot_io_internal_reactor_wait(interp, sched->reactor, ready,
+                sizeof (ready) / sizeof (*ready), timeout);
+
+    for (i = 0; i < count; ++i) {
+        const INTVAL key = (INTVAL)ready[i];
+        PMC * const task = VTABLE_get_pmc_keyed_int(interp, sched->io_waiters, key);
+
+        if (!PMC_IS_NULL(task)) {
+            VTABLE_delete_keyed_int(interp, sched->io_waiters, key);
+            io_task_ready(interp, task);
+        }
+    }
+}
+
+/*
+
 =back
 
 =head2 Opcode Functions
@@ -758,6 +929,39 @@ Parrot_cx_preemption_enabled(PARROT_INTERP)
 
 /*
 
+=item C<static void io_task_ready(PARROT_INTERP, PMC *task)>
+
+Queues a task whose handle is ready.  A Task without code only stands for
+the handle being ready, so it is done now and its waiters are queued instead.
+
+=cut
+
+*/
+
+static void
+io_task_ready(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(io_task_ready)
+    Parrot_Task_attributes * const tdata = PARROT_TASK(task);
+    INTVAL i, n = 0;
+
+    if (!PMC_IS_NULL(tdata->code)) {
+        VTABLE_push_pmc(interp, interp->scheduler, task);
+        return;
+    }
+
+    LOCK(tdata->waiters_lock);
+    tdata->killed = 1;
+    if (!PMC_IS_NULL(tdata->waiters))
+        n = VTABLE_elements(interp, tdata->waiters);
+    for (i = 0; i < n; ++i)
+        VTABLE_push_pmc(interp, interp->scheduler,
+            VTABLE_get_pmc_keyed_int(interp, tdata->waiters, i));
+    UNLOCK(tdata->waiters_lock);
+}
+
+/*
+
 =back
 
 =head1 SEE ALSO
@@ -43,6 +43,11 @@ STRING *STRINGNULL;
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_CAN_RETURN_NULL
+static Parrot_File_Mapping * find_mapping(PARROT_INTERP,
+    ARGIN_NULLOK(const char *p))
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 static INTVAL string_max_bytes(PARROT_INTERP,
@@ -74,6 +79,8 @@ static void throw_illegal_escape_char(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_find_mapping __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_string_max_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_string_rep_compatible __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -151,6 +158,11 @@ Parrot_str_init(PARROT_INTERP)
         interp->hash_seed = Parrot_get_entropy(interp);
     }
 
+    /* Interned strings belong to the interpreter that collects them */
+    interp->interned_strings = Parrot_hash_create(interp,
+                                        enum_type_STRING,
+                                        Hash_key_type_STRING);
+
     /* initialize the constant string table */
     if (interp->parent_interpreter) {
         interp->const_cstring_table =
@@ -208,6 +220,15 @@ Parrot_str_finish(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_str_finish)
 
+    Parrot_hash_destroy(interp, interp->interned_strings);
+    interp->interned_strings = NULL;
+
+    /* Nothing points into file mappings anymore */
+    while (interp->mapped_files) {
+        interp->mapped_files->refs = 1;
+        Parrot_str_release_mapping(interp, interp->mapped_files);
+    }
+
     /* all are shared between interpreters */
     if (!interp->parent_interpreter) {
         mem_internal_free(interp->const_cstring_table);
@@ -428,6 +449,9 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     /* Set the string copy flag */
     PObj_is_string_copy_SET(d);
 
+    /* Only the original is in the intern table */
+    PObj_interned_CLEAR(d);
+
     is_movable = PObj_is_movable_TESTALL(s);
 
     /* Now check that buffer allocated from pool and affected by compacting */
@@ -439,6 +463,23 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 
     PARROT_ASSERT(is_movable == PObj_is_movable_TESTALL(d));
 
+    /* A copy pointing into a file mapping keeps it mapped as well. Mappings
+       of other interpreters can go away any time, and constant copies are
+       never freed, so these get their data copied instead. */
+    if (PObj_mapped_TEST(d)) {
+        Parrot_File_Mapping * const map = PObj_constant_TEST(d)
+                ? NULL
+                : find_mapping(interp, (char *)Buffer_bufstart(d));
+
+        if (map)
+            ++map->refs;
+        else {
+            PObj_get_FLAGS(d) &= ~(PObj_external_FLAG | PObj_mapped_FLAG);
+            Parrot_gc_allocate_string_storage(interp, d, s->bufused);
+            memcpy(d->strstart, s->strstart, s->bufused);
+        }
+    }
+
     return d;
 }
 
@@ -453,6 +494,11 @@ string's encoding and/or type to match those of the first string. If
 either string is C<NULL>, then a copy of the non-C<NULL> string is
 returned. If both strings are C<NULL>, return C<STRINGNULL>.
 
+The result shares the buffer of C<a> if there is room after C<a> in it, or
+the buffer of C<b> if there is room in front of C<b>. A new buffer gets
+room to spare at the end being added to, so building a string by repeated
+appending or prepending takes linear time.
+
 =cut
 
 */
@@ -525,16 +571,50 @@ Parrot_str_concat(PARROT_INTERP, ARGIN_NULLOK(const STRING *a),
         dest->encoding = enc;
         dest->hashval = 0;
     }
+    else if (PObj_is_growable_TESTALL(b)
+    &&  (size_t)(b->strstart - (char *)Buffer_bufstart(b)) >= a->bufused) {
+        /* String b is growable and there's enough space in front of it */
+        DECL_CONST_CAST;
+
+        dest = Parrot_str_copy(interp, b);
+
+        /* Switch string copy flags */
+        PObj_is_string_copy_SET(PARROT_const_cast(STRING *, b));
+        PObj_is_string_copy_CLEAR(dest);
+
+        /* Prepend a */
+        dest->strstart -= a->bufused;
+        memcpy(dest->strstart, a->strstart, a->bufused);
+
+        dest->encoding = enc;
+        dest->hashval = 0;
+    }
     else {
+        const UINTVAL spare = total_length >> 1;
+        size_t headroom = 0;
+
         if (4 * b->bufused < a->bufused) {
             /* Preallocate more memory if we're appending a short string to
-               a long string */
-            total_length += total_length >> 1;
+               a long string. Keep room in front too if a has been growing
+               at the front. */
+            if (PObj_is_growable_TESTALL(a)
+            &&  a->strstart > (char *)Buffer_bufstart(a))
+                headroom = spare;
+            total_length += spare;
+        }
+        else if (4 * a->bufused < b->bufused) {
+            /* Likewise in front, if we're prepending a short string to a
+               long string */
+            if (PObj_is_growable_TESTALL(b)
+            &&  b->strstart + b->bufused < (char *)Buffer_bufstart(b) + Buffer_buflen(b))
+                total_length += spare;
+            headroom = spare;
         }
 
-        dest = Parrot_str_new_noinit(interp, total_length);
+        dest = Parrot_str_new_noinit(interp, total_length + headroom);
         PARROT_ASSERT(enc);
         dest->encoding = enc;
+        dest->strstart += headroom;
 
         /* Copy A first */
         memcpy(dest->strstart, a->strstart, a->bufused);
@@ -653,6 +733,206 @@ Parrot_str_new_constant(PARROT_INTERP, ARGIN(const char *buffer))
 
 /*
 
+=item C<STRING * Parrot_str_intern(PARROT_INTERP, STRING *s)>
+
+Returns the interned STRING equal to C<s>. If there is none yet, C<s> becomes
+it, or a constant copy of C<s> if the GC doesn't manage its buffer. Equal
+interned STRINGs are the same STRING and their hash value is computed on
+interning, so comparing and hashing them is cheap. Use it for names looked up
+over and over, like method and attribute names.
+
+The intern table doesn't keep its STRINGs alive. The GC removes them from it
+when it frees them, see C<Parrot_str_unintern>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+STRING *
+Parrot_str_intern(PARROT_INTERP, ARGIN_NULLOK(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_intern)
+    Hash   * const table = interp->interned_strings;
+    STRING *interned;
+
+    if (STRING_IS_NULL(s))
+        return STRINGNULL;
+
+    if (PObj_interned_TEST(s))
+        return s;
+
+    interned = (STRING *)Parrot_hash_get(interp, table, s);
+
+    if (interned)
+        return interned;
+
+    /* The GC only tells the table about STRINGs with buffers of its own */
+    if (!PObj_constant_TEST(s)
+    && !(Buffer_bufstart(s) && PObj_is_movable_TESTALL(s)))
+        s = Parrot_str_new_init(interp, s->strstart, s->bufused,
+                s->encoding, PObj_constant_FLAG);
+
+    PObj_interned_SET(s);
+    Parrot_hash_put(interp, table, s, s);
+
+    return s;
+}
+
+/*
+
+=item C<void Parrot_str_unintern(PARROT_INTERP, STRING *s)>
+
+Removes the interned STRING C<s> from the intern table. Called by the GC when
+it frees C<s>.
+
+=cut
+
+*/
+
+void
+Parrot_str_unintern(PARROT_INTERP, ARGIN(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_unintern)
+    Hash * const table = interp->interned_strings;
+
+    /* Constant STRINGs can be interned by other interpreters too */
+    if (table && Parrot_hash_get(interp, table, s) == s)
+        Parrot_hash_delete(interp, table, s);
+}
+
+/*
+
+=item C<Parrot_File_Mapping * Parrot_str_new_mapping(PARROT_INTERP, char *start,
+size_t size)>
+
+Registers the file mapping of C<size> bytes at C<start>, so STRINGs can point
+straight into it. The caller holds the first reference to the mapping and
+drops it with C<Parrot_str_release_mapping>. Every STRING pointing into the
+mapping holds another one, so the mapping is unmapped when both its owner and
+the last of these STRINGs are gone.
+
+=item C<void Parrot_str_attach_mapping(PARROT_INTERP, STRING *s,
+Parrot_File_Mapping *map)>
+
+Makes C<s>, whose buffer was pointed into C<map>, an external STRING holding a
+reference to C<map>. Copies of C<s> hold a reference of their own.
+
+=item C<void Parrot_str_detach_mapping(PARROT_INTERP, STRING *s)>
+
+Drops the reference the STRING C<s> holds to the mapping it points into.
+Called by the GC when it frees C<s>, and before C<s> gets a buffer of its own.
+
+=item C<void Parrot_str_release_mapping(PARROT_INTERP, Parrot_File_Mapping
+*map)>
+
+Drops a reference to C<map>, and unmaps it if it was the last one.
+
+=item C<void Parrot_str_unmap(PARROT_INTERP, STRING *s)>
+
+Gives C<s>, if it points into a file mapping, a buffer of its own, so the
+mapping can go away while C<s> lives on.
+
+=item C<static Parrot_File_Mapping * find_mapping(PARROT_INTERP, const char *p)>
+
+Returns the mapping of this interpreter C<p> points into, or C<NULL>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+Parrot_File_Mapping *
+Parrot_str_new_mapping(PARROT_INTERP, ARGIN(char *start), size_t size)
+{
+    ASSERT_ARGS(Parrot_str_new_mapping)
+    Parrot_File_Mapping * const map = mem_gc_allocate_typed(interp, Parrot_File_Mapping);
+
+    map->start = start;
+    map->size  = size;
+    map->refs  = 1;
+    map->next  = interp->mapped_files;
+    interp->mapped_files = map;
+
+    return map;
+}
+
+void
+Parrot_str_attach_mapping(PARROT_INTERP, ARGMOD(STRING *s), ARGMOD(Parrot_File_Mapping *map))
+{
+    ASSERT_ARGS(Parrot_str_attach_mapping)
+    UNUSED(interp);
+    PARROT_ASSERT(s->strstart >= map->start
+               && s->strstart + s->bufused <= map->start + map->size);
+
+    PObj_get_FLAGS(s) |= PObj_external_FLAG | PObj_mapped_FLAG;
+    ++map->refs;
+}
+
+void
+Parrot_str_detach_mapping(PARROT_INTERP, ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_detach_mapping)
+    Parrot_File_Mapping * const map = find_mapping(interp, (char *)Buffer_bufstart(s));
+
+    PObj_mapped_CLEAR(s);
+    if (map)
+        Parrot_str_release_mapping(interp, map);
+}
+
+void
+Parrot_str_release_mapping(PARROT_INTERP, ARGFREE(Parrot_File_Mapping *map))
+{
+    ASSERT_ARGS(Parrot_str_release_mapping)
+    Parrot_File_Mapping **prev = &interp->mapped_files;
+
+    if (--map->refs)
+        return;
+
+    while (*prev != map)
+        prev = &(*prev)->next;
+    *prev = map->next;
+
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    munmap(map->start, map->size);
+#endif
+    mem_gc_free(interp, map);
+}
+
+void
+Parrot_str_unmap(PARROT_INTERP, ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_unmap)
+
+    if (PObj_mapped_TEST(s)) {
+        STRING mapped = *s;
+
+        PObj_get_FLAGS(s) &= ~(PObj_external_FLAG | PObj_mapped_FLAG);
+        Parrot_gc_allocate_string_storage(interp, s, mapped.bufused);
+        memcpy(s->strstart, mapped.strstart, mapped.bufused);
+        s->bufused = mapped.bufused;
+        Parrot_str_detach_mapping(interp, &mapped);
+    }
+}
+
+PARROT_CAN_RETURN_NULL
+static Parrot_File_Mapping *
+find_mapping(PARROT_INTERP, ARGIN_NULLOK(const char *p))
+{
+    ASSERT_ARGS(find_mapping)
+    Parrot_File_Mapping *map;
+
+    for (map = interp->mapped_files; map; map = map->next)
+        if (p >= map->start && p < map->start + map->size)
+            return map;
+
+    return NULL;
+}
+
+/*
+
 =item C<STRING * Parrot_str_new_init(PARROT_INTERP, const char *buffer, UINTVAL
 len, const STR_VTABLE *encoding, UINTVAL flags)>
 
@@ -1478,6 +1758,10 @@ Parrot_str_equal(PARROT_INTERP, ARGIN_NULLOK(const STRING *s1), ARGIN_NULLOK(con
 {
     ASSERT_ARGS(Parrot_str_equal)
 
+    /* Always true for equal interned STRINGs */
+    if (s1 == s2)
+        return 1;
+
     if (s1 == NULL)
         s1 = STRINGNULL;
 
@@ -2338,12 +2622,13 @@ void
 Parrot_str_pin(SHIM_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_str_pin)
-    const size_t size = Buffer_buflen(s);
+    const size_t size   = Buffer_buflen(s);
+    const size_t offset = s->strstart - (char *)Buffer_bufstart(s);
     char * const memory = (char *)mem_internal_allocate(size);
 
     memcpy(memory, Buffer_bufstart(s), size);
     Buffer_bufstart(s) = memory;
-    s->strstart        = memory;
+    s->strstart        = memory + offset;
 
     /* Mark the memory as both from the system and immobile */
     PObj_sysmem_SET(s);
@@ -2366,14 +2651,15 @@ Parrot_str_unpin(PARROT_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_str_unpin)
     void  *memory;
-    size_t size;
+    size_t size, offset;
 
     /* If this string is not marked using system memory,
      * we just don't do this */
     if (!PObj_sysmem_TEST(s))
         return;
 
-    size = Buffer_buflen(s);
+    size   = Buffer_buflen(s);
+    offset = s->strstart - (char *)Buffer_bufstart(s);
 
     /* We need a handle on the fixed memory so we can get rid of it later */
     memory = Buffer_bufstart(s);
@@ -2388,6 +2674,7 @@ Parrot_str_unpin(PARROT_INTERP, ARGMOD(STRING *s))
     Parrot_gc_allocate_string_storage(interp, s, size);
     Parrot_unblock_GC_sweep(interp);
     memcpy(Buffer_bufstart(s), memory, size);
+    s->strstart = (char *)Buffer_bufstart(s) + offset;
 
     /* Mark the memory as neither immobile nor system allocated */
     PObj_sysmem_CLEAR(s);
@@ -169,14 +169,11 @@ static void
 ascii_scan(PARROT_INTERP, ARGMOD(STRING *src))
 {
     ASSERT_ARGS(ascii_scan)
-    unsigned char *p = (unsigned char *)src->strstart;
-    UINTVAL i;
 
-    for (i = 0; i < src->bufused; ++i) {
-        if (p[i] >= 0x80)
-            Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_STRING_REPRESENTATION,
-                "Invalid character in ASCII string");
-    }
+    if (src->bufused
+    &&  encoding_ascii_run(src->strstart, src->bufused) != src->bufused)
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_STRING_REPRESENTATION,
+            "Invalid character in ASCII string");
 
     src->strlen = src->bufused;
 }
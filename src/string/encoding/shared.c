@@ -328,6 +328,43 @@ encoding_rindex(PARROT_INTERP, ARGIN(const STRING *src),
 }
 
 
+/*
+
+=item C<UINTVAL encoding_ascii_run(const char *buf, UINTVAL len)>
+
+Returns the number of ASCII bytes at the start of the C<len> bytes at
+C<buf>.  Tests a word at a time, so long runs of ASCII text are cheap to
+count.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+UINTVAL
+encoding_ascii_run(ARGIN(const char *buf), UINTVAL len)
+{
+    ASSERT_ARGS(encoding_ascii_run)
+    /* 0x8080...80, the high bit of every byte in a word */
+    const UINTVAL high_bits = ((UINTVAL)-1 / 0xFF) * 0x80;
+    const unsigned char * const p = (const unsigned char *)buf;
+    UINTVAL i = 0;
+
+    for (; i + sizeof (UINTVAL) <= len; i += sizeof (UINTVAL)) {
+        UINTVAL word;
+        memcpy(&word, p + i, sizeof (UINTVAL));
+        if (word & high_bits)
+            break;
+    }
+
+    while (i < len && p[i] < 0x80)
+        ++i;
+
+    return i;
+}
+
+
 /*
 
 =item C<size_t encoding_hash(PARROT_INTERP, const STRING *src, size_t hashval)>
@@ -346,16 +383,37 @@ encoding_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
     DECL_CONST_CAST;
     STRING * const s = PARROT_const_cast(STRING *, src);
     String_iter iter;
+    Parrot_hash_state state;
+
+    /* One byte per codepoint only happens for ASCII in UTF-8, where the
+     * bytes are the codepoints */
+    if (s->bufused == s->strlen) {
+        s->hashval = hashval = Parrot_hash_buffer(
+                (const unsigned char *)s->strstart, s->bufused, hashval);
+        return hashval;
+    }
 
     STRING_ITER_INIT(interp, &iter);
+    Parrot_hash_state_init(&state, hashval, 0);
 
     while (iter.charpos < s->strlen) {
         const UINTVAL c = STRING_iter_get_and_advance(interp, s, &iter);
-        hashval += hashval << 5;
-        hashval += c;
+
+        if (c > 255) {
+            /* start over, hashing the key as wide */
+            STRING_ITER_INIT(interp, &iter);
+            Parrot_hash_state_init(&state, hashval, 1);
+
+            while (iter.charpos < s->strlen)
+                Parrot_hash_state_add_codepoint(&state,
+                        STRING_iter_get_and_advance(interp, s, &iter));
+            break;
+        }
+
+        Parrot_hash_state_add_codepoint(&state, c);
     }
 
-    s->hashval = hashval;
+    s->hashval = hashval = Parrot_hash_state_finish(&state);
 
     return hashval;
 }
@@ -14,6 +14,11 @@
 /* HEADERIZER BEGIN: src/string/encoding/shared.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+UINTVAL encoding_ascii_run(ARGIN(const char *buf), UINTVAL len)
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 INTVAL encoding_compare(PARROT_INTERP,
     ARGIN(const STRING *lhs),
@@ -280,6 +285,8 @@ PARROT_DOES_NOT_RETURN
 STRING* unicode_upcase_first(PARROT_INTERP, const STRING *src)
         __attribute__nonnull__(1);
 
+#define ASSERT_ARGS_encoding_ascii_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buf))
 #define ASSERT_ARGS_encoding_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lhs) \
@@ -396,13 +396,20 @@ ucs4_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
     STRING * const  s   = PARROT_const_cast(STRING *, src);
     const utf32_t  *ptr = (utf32_t *)s->strstart;
     UINTVAL         len = s->strlen;
+    UINTVAL        i;
+    Parrot_hash_state state;
 
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *(ptr++);
-    }
+    /* a codepoint above 255 makes the key wide */
+    for (i = 0; i < len; ++i)
+        if (ptr[i] > 255)
+            break;
+
+    Parrot_hash_state_init(&state, hashval, i < len);
+
+    while (len--)
+        Parrot_hash_state_add_codepoint(&state, *(ptr++));
 
-    s->hashval = hashval;
+    s->hashval = hashval = Parrot_hash_state_finish(&state);
 
     return hashval;
 }
@@ -276,6 +276,20 @@ utf8_partial_scan(PARROT_INTERP, ARGIN(const char *buf),
     for (i = 0; i < len && chars < max_chars; ++i) {
         c = p[i];
 
+        if (delim < 0 && UNICODE_IS_INVARIANT(c)) {
+            /* Count a run of ASCII characters a word at a time */
+            UINTVAL run = len - i;
+
+            if (run > (UINTVAL)(max_chars - chars))
+                run = max_chars - chars;
+
+            run    = encoding_ascii_run((const char *)p + i, run);
+            i     += run - 1;
+            chars += run;
+            c      = p[i];
+            continue;
+        }
+
         if (UTF8_IS_START(c)) {
             UINTVAL len2 = UTF8SKIP(c);
             UINTVAL count;
@@ -34,6 +34,13 @@ Threads are created by creating new C<ParrotInterpreter> objects.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static int Parrot_thread_acquire_task(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void Parrot_thread_init_task_deque(ARGOUT(Task_deque *deque))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*deque);
+
 PARROT_CAN_RETURN_NULL
 static PMC * Parrot_thread_make_local_args_copy(PARROT_INTERP,
     ARGIN(Parrot_Interp source),
@@ -44,17 +51,48 @@ static PMC * Parrot_thread_make_local_args_copy(PARROT_INTERP,
 PARROT_CAN_RETURN_NULL
 static void* Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg));
 
+PARROT_CAN_RETURN_NULL
+static PMC * Parrot_thread_pop_task(ARGMOD(Task_deque *deque))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*deque);
+
+static void Parrot_thread_push_task(
+    ARGMOD(Task_deque *deque),
+    ARGIN(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*deque);
+
+PARROT_CAN_RETURN_NULL
+static PMC * Parrot_thread_steal_task(ARGMOD(Task_deque *deque))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*deque);
+
+#define ASSERT_ARGS_Parrot_thread_acquire_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_thread_init_task_deque __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque))
 #define ASSERT_ARGS_Parrot_thread_make_local_args_copy \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(source))
 #define ASSERT_ARGS_Parrot_thread_outer_runloop __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_thread_pop_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque))
+#define ASSERT_ARGS_Parrot_thread_push_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque) \
+    , PARROT_ASSERT_ARG(task))
+#define ASSERT_ARGS_Parrot_thread_steal_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
 static Interp * threads_array[MAX_THREADS];
 static int      num_threads = -1;
 
+/* initial number of slots of a Task_deque */
+#define TASK_DEQUE_INITIAL_SIZE 64
+
 /*
 
 =item C<PMC * Parrot_thread_create(PARROT_INTERP, INTVAL type, INTVAL
@@ -82,9 +120,14 @@ Parrot_thread_create(PARROT_INTERP, SHIM(INTVAL type), INTVAL clone_flags)
     MUTEX_INIT(new_interp->thread_data->interp_lock);
     new_interp->thread_data->tid = 0;
     new_interp->thread_data->main_interp = interp;
+    Parrot_thread_init_task_deque(&new_interp->thread_data->tasks);
+    PARROT_ATOMIC_INT_INIT(new_interp->thread_data->idle);
     Interp_flags_SET(new_interp, PARROT_IS_THREAD);
 
-    new_interp->wake_up = 0;
+    PARROT_ATOMIC_INT_INIT(new_interp->wake_up);
+    PARROT_ATOMIC_INT_INIT(new_interp->asleep);
+    PARROT_ATOMIC_INT_SET(new_interp->wake_up, 0);
+    PARROT_ATOMIC_INT_SET(new_interp->asleep, 0);
     COND_INIT(new_interp->sleep_cond);
     MUTEX_INIT(new_interp->sleep_mutex);
 
@@ -93,6 +136,8 @@ Parrot_thread_create(PARROT_INTERP, SHIM(INTVAL type), INTVAL clone_flags)
         interp->thread_data->tid = 0;
         interp->thread_data->main_interp = interp;
         MUTEX_INIT(interp->thread_data->interp_lock);
+        Parrot_thread_init_task_deque(&interp->thread_data->tasks);
+        PARROT_ATOMIC_INT_INIT(interp->thread_data->idle);
     }
 
     return new_interp_pmc;
@@ -251,37 +296,277 @@ Parrot_thread_create_local_task(PARROT_INTERP, ARGIN(Parrot_Interp const thread_
             Parrot_thread_maybe_create_proxy(interp, thread_interp, data));
     }
 
+    return local_task;
+}
+
+/*
+
+=item C<void Parrot_thread_schedule_task(PARROT_INTERP, PMC *task)>
+
+Schedule a task to be run by one of the threads.  The task is pushed onto the
+deque of the scheduling interpreter.  If that is a thread, it runs the task
+itself once it has nothing else to do; otherwise an idle thread steals the
+task and migrates it with C<Parrot_thread_create_local_task()>.
+
+=cut
+
+*/
+
+void
+Parrot_thread_schedule_task(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_thread_schedule_task)
+
     /* put the task in a list for GC and for the main thread to know there's still active tasks */
     VTABLE_push_pmc(interp, PARROT_SCHEDULER(interp->scheduler)->foreign_tasks, task);
 
-    return local_task;
+    Parrot_thread_push_task(&interp->thread_data->tasks, task);
 }
 
 /*
 
-=item C<void Parrot_thread_schedule_task(PARROT_INTERP, Interp *thread_interp,
-PMC *task)>
+=item C<void Parrot_thread_notify_idle_thread(PARROT_INTERP)>
 
-Schedule a task with the thread's scheduler.
+Wake up one of the threads waiting for tasks to steal, if there is any.
+Busy threads look for tasks to steal as soon as they run out of work.
 
 =cut
 
 */
 
 void
-Parrot_thread_schedule_task(PARROT_INTERP, ARGIN(Interp *thread_interp), ARGIN(PMC *task))
+Parrot_thread_notify_idle_thread(SHIM_INTERP)
 {
-    ASSERT_ARGS(Parrot_thread_schedule_task)
+    ASSERT_ARGS(Parrot_thread_notify_idle_thread)
+    int i;
+
+    for (i = 0; i < num_threads; i++) {
+        Interp * const thread = threads_array[i];
+        int claimed = 0;
+
+        if (thread && thread->thread_data)
+            PARROT_ATOMIC_INT_CAS(claimed, thread->thread_data->idle, 1, 0);
+
+        if (claimed) {
+            Parrot_thread_notify_thread(thread);
+            return;
+        }
+    }
+}
+
+/*
 
-    /* don't run GC from the wrong thread since GC involves stack walking and we
-     * don't want the foreign GC to find our objects */
-    Parrot_block_GC_mark_locked(thread_interp);
+=item C<static void Parrot_thread_init_task_deque(Task_deque *deque)>
 
-    VTABLE_push_pmc(thread_interp, thread_interp->scheduler,
-        Parrot_thread_create_local_task(interp, thread_interp, task));
-    Parrot_thread_notify_thread(thread_interp);
+Initialize an empty deque.
 
-    Parrot_unblock_GC_mark_locked(thread_interp);
+=cut
+
+*/
+
+static void
+Parrot_thread_init_task_deque(ARGOUT(Task_deque *deque))
+{
+    ASSERT_ARGS(Parrot_thread_init_task_deque)
+    Task_deque_buffer * const buffer = mem_internal_allocate_typed(Task_deque_buffer);
+
+    buffer->prev  = NULL;
+    buffer->mask  = TASK_DEQUE_INITIAL_SIZE - 1;
+    buffer->items = mem_internal_allocate_n_zeroed_typed(TASK_DEQUE_INITIAL_SIZE, PMC *);
+
+    PARROT_ATOMIC_INT_INIT(deque->top);
+    PARROT_ATOMIC_INT_INIT(deque->bottom);
+    PARROT_ATOMIC_PTR_INIT(deque->buffer);
+    PARROT_ATOMIC_INT_SET(deque->top, 0);
+    PARROT_ATOMIC_INT_SET(deque->bottom, 0);
+    PARROT_ATOMIC_PTR_SET(deque->buffer, buffer);
+}
+
+/*
+
+=item C<static void Parrot_thread_push_task(Task_deque *deque, PMC *task)>
+
+Push a task onto the bottom of the interpreter's own deque, doubling its
+buffer when it is full.  Only the owning interpreter may call this.
+
+=cut
+
+*/
+
+static void
+Parrot_thread_push_task(ARGMOD(Task_deque *deque), ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_thread_push_task)
+    Task_deque_buffer *buffer;
+    void              *ptr;
+    INTVAL             top, bottom;
+
+    PARROT_ATOMIC_INT_GET(bottom, deque->bottom);
+    PARROT_ATOMIC_INT_GET(top, deque->top);
+    PARROT_ATOMIC_PTR_GET(ptr, deque->buffer);
+    buffer = (Task_deque_buffer *)ptr;
+
+    if (bottom - top > buffer->mask) {
+        Task_deque_buffer * const grown = mem_internal_allocate_typed(Task_deque_buffer);
+        INTVAL i;
+        int    published;
+
+        grown->prev  = buffer;
+        grown->mask  = buffer->mask * 2 + 1;
+        grown->items = mem_internal_allocate_n_zeroed_typed(grown->mask + 1, PMC *);
+
+        for (i = top; i < bottom; ++i)
+            grown->items[i & grown->mask] = buffer->items[i & buffer->mask];
+
+        /* CAS for the memory barrier; nobody else replaces the buffer */
+        PARROT_ATOMIC_PTR_CAS(published, deque->buffer, ptr, grown);
+        PARROT_ASSERT(published);
+        UNUSED(published)
+        buffer = grown;
+    }
+
+    buffer->items[bottom & buffer->mask] = task;
+
+    /* publishes the task to thieves */
+    PARROT_ATOMIC_INT_INC(bottom, deque->bottom);
+}
+
+/*
+
+=item C<static PMC * Parrot_thread_pop_task(Task_deque *deque)>
+
+Pop the most recently pushed task off the bottom of the interpreter's own
+deque.  Returns NULL if it is empty.  Only the owning interpreter may call
+this.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static PMC *
+Parrot_thread_pop_task(ARGMOD(Task_deque *deque))
+{
+    ASSERT_ARGS(Parrot_thread_pop_task)
+    Task_deque_buffer *buffer;
+    void              *ptr;
+    PMC               *task = NULL;
+    INTVAL             top, bottom;
+
+    /* claim the bottom slot before looking at top, so a thief can't take it
+     * unnoticed; the atomic decrement is a full barrier */
+    PARROT_ATOMIC_INT_DEC(bottom, deque->bottom);
+    PARROT_ATOMIC_INT_GET(top, deque->top);
+
+    if (top <= bottom) {
+        PARROT_ATOMIC_PTR_GET(ptr, deque->buffer);
+        buffer = (Task_deque_buffer *)ptr;
+        task   = buffer->items[bottom & buffer->mask];
+
+        if (top == bottom) {
+            /* the last task: race the thieves for it */
+            int won;
+            PARROT_ATOMIC_INT_CAS(won, deque->top, top, top + 1);
+            if (!won)
+                task = NULL;
+            PARROT_ATOMIC_INT_SET(deque->bottom, bottom + 1);
+        }
+    }
+    else
+        PARROT_ATOMIC_INT_SET(deque->bottom, bottom + 1);
+
+    return task;
+}
+
+/*
+
+=item C<static PMC * Parrot_thread_steal_task(Task_deque *deque)>
+
+Steal the oldest task from the top of another interpreter's deque.  Returns
+NULL if it is empty or another thread was faster.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static PMC *
+Parrot_thread_steal_task(ARGMOD(Task_deque *deque))
+{
+    ASSERT_ARGS(Parrot_thread_steal_task)
+    INTVAL top, bottom;
+
+    PARROT_ATOMIC_INT_GET(top, deque->top);
+    PARROT_ATOMIC_INT_GET(bottom, deque->bottom);
+
+    if (top < bottom) {
+        Task_deque_buffer *buffer;
+        void              *ptr;
+        PMC               *task;
+        int                won;
+
+        PARROT_ATOMIC_PTR_GET(ptr, deque->buffer);
+        buffer = (Task_deque_buffer *)ptr;
+        task   = buffer->items[top & buffer->mask];
+
+        PARROT_ATOMIC_INT_CAS(won, deque->top, top, top + 1);
+        if (won)
+            return task;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static int Parrot_thread_acquire_task(PARROT_INTERP)>
+
+Find a task for an idle thread and put it into its scheduler.  Tasks from the
+thread's own deque are taken first, newest first.  Otherwise a task is stolen
+from the main interpreter or another thread and migrated to this one, with
+the GC of both interpreters blocked.  Returns 0 if no task was found.
+
+=cut
+
+*/
+
+static int
+Parrot_thread_acquire_task(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_thread_acquire_task)
+    Thread_data * const thread_data = interp->thread_data;
+    PMC                *task        = Parrot_thread_pop_task(&thread_data->tasks);
+    int                 i;
+
+    if (task) {
+        VTABLE_push_pmc(interp, interp->scheduler, task);
+        return 1;
+    }
+
+    /* start after our own slot, so thieves don't all pick the same victim;
+     * slot 0 is the main interpreter */
+    for (i = 1; i < num_threads; i++) {
+        Interp * const victim = threads_array[(thread_data->tid + i) % num_threads];
+
+        if (victim == NULL || victim->thread_data == NULL)
+            continue;
+
+        task = Parrot_thread_steal_task(&victim->thread_data->tasks);
+        if (task) {
+            /* The victim keeps running while we copy its task. Keep its GC
+             * from freeing or moving what we read, and ours from finding
+             * its objects on our stack */
+            Parrot_block_GC_mark_locked(victim);
+            Parrot_block_GC_mark(interp);
+            VTABLE_push_pmc(interp, interp->scheduler,
+                Parrot_thread_create_local_task(victim, interp, task));
+            Parrot_unblock_GC_mark(interp);
+            Parrot_unblock_GC_mark_locked(victim);
+            return 1;
+        }
+    }
+
+    return 0;
 }
 
 /*
@@ -305,14 +590,15 @@ Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg))
 
     PMC * const scheduler = interp->scheduler;
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    INTVAL foreign_count, i;
+    INTVAL foreign_count, i, idle;
     int lo_var_ptr;
 
     /* need to set it here because argument passing can trigger GC */
     interp->lo_var_ptr = &lo_var_ptr;
 
     do {
-        while (VTABLE_get_integer(interp, scheduler) > 0) {
+        while (VTABLE_get_integer(interp, scheduler) > 0
+        ||     Parrot_thread_acquire_task(interp)) {
             /* there can be no active runloops at this point, so it should be save
              * to start counting at 0 again. This way the continuation in the next
              * task will find a runloop with id 1 when encountering an exception */
@@ -333,12 +619,18 @@ Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg))
                 UNLOCK(PARROT_TASK(task)->waiters_lock);
             }
 
-            /* add expired alarms to the task queue */
+            /* add expired alarms and tasks with ready handles to the task queue */
             Parrot_cx_check_alarms(interp, interp->scheduler);
+            Parrot_cx_check_io(interp, interp->scheduler, 0.0);
         }
 
-        /* Nothing to do except to wait for the next alarm to expire */
-        Parrot_thread_wait_for_notification(interp);
+        /* Nothing to do except to wait for a new task or the next alarm to
+         * expire.  Look for a task once more after announcing we're idle, as
+         * whoever scheduled one meanwhile may not have seen us. */
+        PARROT_ATOMIC_INT_INC(idle, interp->thread_data->idle);
+        if (!Parrot_thread_acquire_task(interp))
+            Parrot_thread_wait_for_notification(interp);
+        PARROT_ATOMIC_INT_SET(interp->thread_data->idle, 0);
         Parrot_cx_check_alarms(interp, interp->scheduler);
     } while (1);
 
@@ -349,7 +641,8 @@ Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg))
 
 =item C<void Parrot_thread_wait_for_notification(PARROT_INTERP)>
 
-Sleep till notified by another thread or a signal.
+Sleep till notified by another thread or a signal, or until a handle which
+a task waits for becomes ready.
 
 =cut
 
@@ -361,13 +654,38 @@ Parrot_thread_wait_for_notification(PARROT_INTERP)
     ASSERT_ARGS(Parrot_thread_wait_for_notification)
 
 #ifdef PARROT_HAS_THREADS
+    INTVAL woken, asleep;
+
+    /* Tasks wait for handles, so sleep in the reactor, which
+     * Parrot_thread_notify_thread wakes as well */
+    if (Parrot_cx_io_waiting(interp)) {
+        PARROT_ATOMIC_INT_INC(asleep, interp->asleep);
+        PARROT_ATOMIC_INT_GET(woken, interp->wake_up);
+        Parrot_cx_check_io(interp, interp->scheduler, woken ? 0.0 : -1.0);
+        PARROT_ATOMIC_INT_SET(interp->wake_up, 0);
+        PARROT_ATOMIC_INT_DEC(asleep, interp->asleep);
+        return;
+    }
+
     LOCK(interp->sleep_mutex);
-    while (interp->wake_up == 0)
+
+    /* announce we're going to sleep before looking at wake_up, see
+     * Parrot_thread_notify_thread; the atomic increment is a full barrier */
+    PARROT_ATOMIC_INT_INC(asleep, interp->asleep);
+    PARROT_ATOMIC_INT_GET(woken, interp->wake_up);
+    while (woken == 0) {
         COND_WAIT(interp->sleep_cond, interp->sleep_mutex);
-    interp->wake_up = 0;
+        PARROT_ATOMIC_INT_GET(woken, interp->wake_up);
+    }
+    PARROT_ATOMIC_INT_SET(interp->wake_up, 0);
+    PARROT_ATOMIC_INT_DEC(asleep, interp->asleep);
+
     UNLOCK(interp->sleep_mutex);
 #else
-    Parrot_alarm_wait_for_next_alarm(interp);
+    if (Parrot_cx_io_waiting(interp))
+        Parrot_cx_check_io(interp, interp->scheduler, -1.0);
+    else
+        Parrot_alarm_wait_for_next_alarm(interp);
 #endif
 }
 
@@ -375,7 +693,9 @@ Parrot_thread_wait_for_notification(PARROT_INTERP)
 
 =item C<void Parrot_thread_notify_thread(PARROT_INTERP)>
 
-Poke the thread in case it's sleeping (waiting for a new task)
+Poke the thread in case it's sleeping (waiting for a new task).  The mutex
+and condition variable are only used if the thread actually sleeps; a running
+thread just finds C<wake_up> set the next time it wants to wait.
 
 =cut
 
@@ -385,10 +705,24 @@ void
 Parrot_thread_notify_thread(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_thread_notify_thread)
-    LOCK(interp->sleep_mutex);
-    interp->wake_up = 1;
-    COND_SIGNAL(interp->sleep_cond);
-    UNLOCK(interp->sleep_mutex);
+    INTVAL asleep;
+
+    /* the atomic increment is a full barrier, so either we see the thread
+     * asleep or it sees wake_up set before waiting */
+    PARROT_ATOMIC_INT_INC(asleep, interp->wake_up);
+    PARROT_ATOMIC_INT_GET(asleep, interp->asleep);
+
+    if (asleep) {
+        /* the thread created its reactor before going to sleep in it */
+        Parrot_io_reactor * const reactor = PARROT_SCHEDULER(interp->scheduler)->reactor;
+
+        LOCK(interp->sleep_mutex);
+        COND_SIGNAL(interp->sleep_cond);
+        UNLOCK(interp->sleep_mutex);
+
+        if (reactor)
+            Parrot_io_internal_reactor_wake(reactor);
+    }
 }
 
 /*
@@ -657,6 +991,8 @@ Parrot_thread_insert_thread(SHIM_INTERP, ARGIN(Interp* thread), int index)
 {
     ASSERT_ARGS(Parrot_thread_insert_thread)
 
+    if (thread->thread_data)
+        thread->thread_data->tid = index;
     threads_array[index] = thread;
 }
 
@@ -672,7 +1008,7 @@ This function must be called before C<Parrot_thread_init_threads_array()>;
 
 It returns the actual number of num_threads, which might -1 be if
 numthreads is invalid, e.g. it exceeds the hard-coded constant
-MAX_THREADS (16), or if Parrot_set_num_threads() was called too late
+MAX_THREADS (32), or if Parrot_set_num_threads() was called too late
 and threads were already initialized.
 
 =cut
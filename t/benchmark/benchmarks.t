@@ -124,6 +124,10 @@ FixedPMCArray:\s\d+(\.\d+)?s\n
         Copying\sa\stotal\sof\s\d+\sbytes\n
         There\sare\s\d+\sactive\sBuffer\sstructs\n
         There\sare\s\d+\stotal\sBuffer\sstructs\n$/x,
+    q{gc_waves_latency.pir} => qr/^\d+\.\d+\sseconds\.\n
+        A\stotal\sof\s\d+\sGC\sruns\swere\smade\n
+        (\s+[<>]=?\s\d+m?u?s:\s\d+\n){7}
+        Slowest\sstep:\s\d+\.\d+\sseconds\n$/x,
     q{gc_waves_sizeable_data.pasm} => qr/^\d+(\.\d+)?\sseconds\.\n
         A\stotal\sof\s\d+\sbytes\swere\sallocated\n
         A\stotal\sof\s\d+\sGC\sruns\swere\smade\n
@@ -138,6 +142,11 @@ FixedPMCArray:\s\d+(\.\d+)?s\n
         Copying\sa\stotal\sof\s\d+\sbytes\n
         There\sare\s\d+\sactive\sBuffer\sstructs\n
         There\sare\s\d+\stotal\sBuffer\sstructs\n$/x,
+    q{hash_keys.pir} => qr/^(\s*\d+\sbytes:\s\d+\slookups\/s\n){6}$/x,
+    q{hash_access.pir} => qr/^STRING\skeys\n
+        (\s+\w+\s+\d+\.\d+s\n){5}
+        INTVAL\skeys\n
+        (\s+\w+\s+\d+\.\d+s\n){5}$/x,
 #omitted because they're slow and doesn't exercise anything novel
 #    q{mops.pasm} => qr/^Iterations:\s\s\s\s10000000\n
 #        Estimated\sops:\s20000000\n
@@ -6,9 +6,10 @@ use warnings;
 use lib qw(lib);
 
 use Test::More;
+use File::Temp qw(tempdir);
 use Parrot::Config;
 use Parrot::Test;
-plan tests => 7;
+plan tests => 8;
 
 =head1 NAME
 
@@ -174,6 +175,45 @@ CODE
 loaded
 OUTPUT
 
+{
+    my @dirs = map { tempdir( CLEANUP => 1 ) } 1 .. 2;
+    for my $dir (@dirs) {
+        open my $fh, '>', "$dir/libcache.pir" or die "couldn't write PIR: $!";
+        print $fh ".sub 'libcache'\n.end\n";
+        close $fh;
+        system('./parrot', '-o', "$dir/libcache.pbc", "$dir/libcache.pir")
+            and die "couldn't compile PIR";
+    }
+
+    pir_output_is( <<"CODE", <<'OUTPUT', "located libraries follow edits to the search path" );
+.include 'iglobals.pasm'
+.include 'libpaths.pasm'
+
+.sub main :main
+    .local pmc interp, lib_paths, paths
+    getinterp interp
+    lib_paths = interp[.IGLOBALS_LIB_PATHS]
+    paths = lib_paths[.PARROT_LIB_PATH_LIBRARY]
+
+    unshift paths, '$dirs[0]'
+    \$P0 = load_bytecode 'libcache.pbc'
+    \$S0 = \$P0
+    \$I0 = index \$S0, '$dirs[0]'
+    say \$I0
+
+    \$S1 = shift paths
+    unshift paths, '$dirs[1]'
+    \$P0 = load_bytecode 'libcache.pbc'
+    \$S0 = \$P0
+    \$I0 = index \$S0, '$dirs[1]'
+    say \$I0
+.end
+CODE
+0
+0
+OUTPUT
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
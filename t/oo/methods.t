@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2007-2012, Parrot Foundation.
+# Copyright (C) 2007-2015, Parrot Foundation.
 
 =head1 NAME
 
@@ -22,13 +22,15 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     create_library()
 
-    plan(6)
+    plan(9)
 
     loading_methods_from_file()
     loading_methods_from_eval()
     overridden_find_method()
 
     overridden_core_pmc()
+    call_site_with_many_classes()
+    call_site_after_method_change()
 
     try_delete_library()
 
@@ -141,6 +143,93 @@ END
 .sub 'foo' :method
     .return(1)
 .end
+.namespace []
+
+.sub 'call_site_with_many_classes'
+    .local pmc objs
+    .local string names
+    objs = new 'ResizablePMCArray'
+    $P0 = newclass 'Site0'
+    $P1 = new $P0
+    push objs, $P1
+    $I0 = 1
+  make_class:
+    $S0 = $I0
+    $S0 = concat 'Site', $S0
+    $P0 = subclass $P0, $S0
+    $P1 = new $P0
+    push objs, $P1
+    inc $I0
+    if $I0 < 6 goto make_class
+
+    # Twice through six classes, all from one call site
+    names = ''
+    $I0 = 0
+  call:
+    $I1 = $I0 % 6
+    $P1 = objs[$I1]
+    $S0 = $P1.'who'()
+    names .= $S0
+    inc $I0
+    if $I0 < 12 goto call
+    is(names, '012345012345', 'a call site finds the method of each class')
+.end
+
+.namespace ['Site0']
+.sub 'who' :method
+    .return('0')
+.end
+.namespace ['Site1']
+.sub 'who' :method
+    .return('1')
+.end
+.namespace ['Site2']
+.sub 'who' :method
+    .return('2')
+.end
+.namespace ['Site3']
+.sub 'who' :method
+    .return('3')
+.end
+.namespace ['Site4']
+.sub 'who' :method
+    .return('4')
+.end
+.namespace ['Site5']
+.sub 'who' :method
+    .return('5')
+.end
+.namespace []
+
+.sub 'call_answer'
+    .param pmc obj
+    $I0 = obj.'answer'()
+    .return($I0)
+.end
+
+.sub 'call_site_after_method_change'
+    $P0 = new 'FixedBooleanArray'
+    $I0 = call_answer($P0)
+    is($I0, 41, 'call site caches a method of a core PMC')
+
+    $S0 = <<'END'
+        .namespace ['FixedBooleanArray']
+        .sub 'answer' :method
+            .return(42)
+        .end
+END
+    $P1 = compreg 'PIR'
+    $P1($S0)
+
+    $I0 = call_answer($P0)
+    is($I0, 42, 'call site sees the method replaced in the namespace')
+.end
+
+.namespace ['FixedBooleanArray']
+.sub 'answer' :method
+    .return(41)
+.end
+.namespace []
 
 # Local Variables:
 #   mode: pir
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 104;
+use Parrot::Test tests => 105;
 
 =head1 NAME
 
@@ -2231,6 +2231,21 @@ CODE
 /too many/
 OUTPUT
 
+pir_error_output_like( <<'CODE', <<'OUTPUT', "argc mismatch - unexpected named after positional" );
+.sub main :main
+        foo (1, 'x'=>2)
+        print "ok\n"
+.end
+
+.sub foo
+        .param int a
+        print a
+        print "\n"
+.end
+CODE
+/too many named arguments: 1 passed, 0 used/
+OUTPUT
+
 pir_error_output_like( <<'CODE', <<'OUTPUT', "argc mismatch - duplicate named" );
 .sub main :main
     .include "errors.pasm"
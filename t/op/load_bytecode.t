@@ -5,7 +5,8 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 3;
+use Parrot::Test tests => 4;
+use Parrot::Test::Util 'create_tempfile';
 
 =head1 NAME
 
@@ -45,6 +46,47 @@ CODE
 /"load_bytecode" couldn't find file 'no_file_by_this_name'/
 OUTPUT
 
+{
+    my ($fh, $pir_filename) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    (undef, my $pbc_filename) = create_tempfile( SUFFIX => '.pbc', UNLINK => 1 );
+    print $fh <<'LIB';
+.sub 'keyed'
+    .param pmc hash
+    .param int n :optional
+    $P0 = new ['ResizablePMCArray']
+    push $P0, n
+    $I0 = hash['a';'b']
+    push $P0, $I0
+    $S0 = hash['c']
+    push $P0, $S0
+    .return ($P0)
+.end
+LIB
+    close $fh;
+    system(qw[./parrot -o], $pbc_filename, $pir_filename)
+        and die "couldn't compile PIR";
+
+    pir_output_is( sprintf(<<'CODE', $pbc_filename), <<'OUTPUT', "keys and signatures of loaded bytecode" );
+.sub main :main
+    load_bytecode '%s'
+    $P0 = new ['Hash']
+    $P1 = new ['Hash']
+    $P1['b'] = 42
+    $P0['a'] = $P1
+    $P0['c'] = 'ok'
+    $P2 = 'keyed'($P0, 7)
+    $S0 = join ' ', $P2
+    say $S0
+    $P2 = 'keyed'($P0)
+    $S0 = join ' ', $P2
+    say $S0
+.end
+CODE
+7 42 ok
+0 42 ok
+OUTPUT
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -115,6 +115,8 @@ Tests Parrot string registers and operations.
     cow_with_chopn_leaving_original_untouched()
     check_that_bug_bug_16874_was_fixed()
     stress_concat()
+    concat_shares_buffer_at_either_end()
+    intern_equal_strings()
     ord_and_substring_see_bug_17035()
 
     test_sprintf()
@@ -1184,6 +1186,76 @@ WHILE:
     ok(1, 'stress concat test')
 .end
 
+.sub concat_shares_buffer_at_either_end
+    .local string s, kept, a, b
+    s = 'middle'
+    $I0 = 0
+  grow:
+    s = concat 'x', s
+    s = concat s, 'y'
+    inc $I0
+    if $I0 < 100 goto grow
+    $S0 = repeat 'x', 100
+    $S1 = repeat 'y', 100
+    $S0 = concat $S0, 'middle'
+    $S0 = concat $S0, $S1
+    is( s, $S0, 'concat grows a string at both ends' )
+
+    # Only the newest string may use the room left in the buffer
+    kept = s
+    a = concat '<', s
+    b = concat '[', s
+    $S2 = substr a, 0, 2
+    $S3 = substr b, 0, 2
+    is( $S2, '<x', 'concat onto the front of a shared buffer' )
+    is( $S3, '[x', 'concat onto the front of a shared buffer again' )
+    a = concat a, '>'
+    b = concat b, ']'
+    $S2 = substr a, -2
+    $S3 = substr b, -2
+    is( $S2, 'y>', 'concat onto the end of a shared buffer' )
+    is( $S3, 'y]', 'concat onto the end of a shared buffer again' )
+    is( kept, $S0, 'concat leaves the shared strings alone' )
+.end
+
+.sub intern_equal_strings
+    $S0 = 'meth'
+    $S0 .= 'od'
+    $S1 = 'me'
+    $S1 .= 'thod'
+    $I0 = issame $S0, $S1
+    is( $I0, 0, 'equal strings built at runtime are different strings' )
+
+    $S2 = intern $S0
+    $S3 = intern $S1
+    $I0 = issame $S2, $S3
+    is( $I0, 1, 'intern gives equal strings the same string' )
+    is( $S3, 'method', 'intern keeps the value' )
+
+    $S4 = intern 'method'
+    $I0 = issame $S4, $S2
+    is( $I0, 1, 'intern of a constant finds the same string' )
+
+    # Dead interned strings leave the table, live ones stay
+    $I1 = 0
+  churn:
+    $S5 = $I1
+    $S5 = concat 'name_', $S5
+    $S5 = intern $S5
+    inc $I1
+    if $I1 < 10000 goto churn
+    sweep 1
+    $S5 = 'name_'
+    $S5 .= '42'
+    $S6 = intern $S5
+    is( $S6, 'name_42', 'intern after the GC freed interned strings' )
+    $S5 = 'meth'
+    $S5 .= 'od'
+    $S5 = intern $S5
+    $I0 = issame $S5, $S2
+    is( $I0, 1, 'intern finds a live interned string after the GC' )
+.end
+
 .sub ord_and_substring_see_bug_17035
     set $S0, "abcdef"
     substr $S1, $S0, 2, 3
@@ -17,7 +17,7 @@ Tests the Continuation PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(9)
+    plan(11)
 
     test_new()
     invoke_with_init()
@@ -25,6 +25,7 @@ Tests the Continuation PMC.
     returns_tt1528()
     experimental_caller()
     get_pointer_and_string()
+    reenter_returned_sub()
 .end
 
 .sub test_new
@@ -173,6 +174,42 @@ end:
    dummy:
 .end
 
+.sub 'save_return_cc'
+    .param pmc saved
+    $P0 = getinterp
+    $P1 = $P0['context']
+    $P2 = getattribute $P1, 'current_cont'
+    saved[0] = $P2
+.end
+
+.sub 'leave_early'
+    .param pmc saved
+    .param pmc runs
+    .local int count
+    .local string name
+    count = 41
+    name  = 'kept'
+    'save_return_cc'(saved)
+    inc count
+    inc runs
+    .return (count, name)
+.end
+
+.sub reenter_returned_sub
+    .local pmc saved, runs, cont
+    saved = new ['ResizablePMCArray']
+    runs  = new ['Integer']
+    ($I0, $S0) = 'leave_early'(saved, runs)
+    if runs < 3 goto again
+    is($I0, 44, "registers of a re-entered context survive its return")
+    is($S0, 'kept', "string registers too")
+    .return ()
+  again:
+    sweep 1
+    cont = saved[0]
+    cont()
+.end
+
 # end of tests.
 
 # Local Variables:
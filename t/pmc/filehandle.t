@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 35;
+use Parrot::Test tests => 37;
 use Parrot::Test::Util 'create_tempfile';
 
 =head1 NAME
@@ -637,6 +637,52 @@ ok 2 - $S2 = $P1.readline() # read iso-8859-1 string
 ok 3 # utf8 encoding
 OUT
 
+pir_output_is( <<"CODE", <<'OUT', 'readline - utf8 characters split by the buffer' );
+.sub 'test' :main
+    .local string line, expected
+    .local int i
+
+    # 3-byte characters, so the buffer ends in the middle of some of them
+    expected = repeat utf8:"\\u20ac", 1000
+    expected = concat expected, "\\n"
+
+    \$P0 = new ['FileHandle']
+    \$P0.'encoding'('utf8')
+    \$P0.'open'('$temp_file', 'w')
+    \$P0.'print'(expected)
+    \$P0.'print'(expected)
+    \$P0.'print'(expected)
+    \$P0.'close'()
+
+    \$P1 = new ['FileHandle']
+    \$P1.'encoding'('utf8')
+    \$P1.'open'('$temp_file')
+    i = 0
+  loop:
+    line = \$P1.'readline'()
+    if line == expected goto next
+    print 'not '
+  next:
+    inc i
+    print 'ok '
+    print i
+    say ' - line read whole'
+    if i < 3 goto loop
+
+    line = \$P1.'readline'()
+    \$P1.'close'()
+    if line == '' goto ok_4
+    print 'not '
+  ok_4:
+    say 'ok 4 - nothing left'
+.end
+CODE
+ok 1 - line read whole
+ok 2 - line read whole
+ok 3 - line read whole
+ok 4 - nothing left
+OUT
+
 
 (undef, $temp_file) = create_tempfile( UNLINK => 1 );
 
@@ -1066,6 +1112,74 @@ ok 2 - read/seek eof
 ok 3 - read/seek tell
 OUT
 
+pir_output_is( <<"CODE", <<'OUT', 'read through a memory mapping' );
+.sub test :main
+    .local pmc fh, bytes
+    .local string line, rest, str
+    .local int pos
+
+    fh = new 'FileHandle'
+    fh.'open'('$temp_file', 'w')
+    fh.'print'("first line\\nsecond line\\nthird line\\n")
+    fh.'close'()
+
+    fh.'open'('$temp_file', 'rm')
+    line = fh.'readline'()
+    print line
+    pos = fh.'tell'()
+    say pos
+    bytes = fh.'read_bytes'(6)
+    str = bytes.'get_string'('ascii')
+    say str
+    rest = fh.'readall'()
+    print rest
+
+    fh.'seek'(0, 11)
+    line = fh.'readline'()
+    print line
+    fh.'seek'(2, -11)
+    line = fh.'readline'()
+    print line
+    line = fh.'readline'()
+    \$I0 = length line
+    say \$I0
+    fh.'close'()
+
+    # Strings read from the mapping outlive the handle
+    sweep 1
+    print rest
+    say str
+
+    fh.'open'('$temp_file', 'r')
+    line = fh.'readline'()
+    print line
+    fh.'close'()
+
+    # Empty files cannot be mapped and are read normally
+    fh.'open'('$temp_file', 'w')
+    fh.'close'()
+    fh.'open'('$temp_file', 'rm')
+    rest = fh.'readall'()
+    \$I0 = length rest
+    say \$I0
+    fh.'close'()
+.end
+CODE
+first line
+11
+second
+ line
+third line
+second line
+third line
+0
+ line
+third line
+second
+first line
+0
+OUT
+
 # The code path we want to test here is a bit hard to trigger
 pir_output_is( <<"CODE", <<'OUT', 'partial multibyte char in buffer' );
 .sub test :main
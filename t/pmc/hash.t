@@ -68,8 +68,12 @@ well.
     broken_delete()
     unicode_keys_register_rt_39249()
     unicode_keys_literal_rt_39249()
+    keys_in_other_encodings()
+    wide_and_narrow_keys()
 
     integer_keys()
+    integer_keys_iterate_in_insertion_order()
+    delete_and_reinsert_many_keys()
     value_types_convertion()
     elements_in_hash()
     equality_tests()
@@ -1334,6 +1338,62 @@ postit_end:
   is( $S1, 'ok', 'literal unicode key lookup via var' )
 .end
 
+# Equal strings must hash equally whatever their encoding.
+.sub keys_in_other_encodings
+    .local pmc hash
+    hash = new ['Hash']
+
+    $S0 = 'a key which spans several words'
+    hash[$S0] = 'ascii'
+    $S1 = iso-8859-1:"caf\x{e9} au lait, longer than a word"
+    hash[$S1] = 'latin1'
+    $S2 = utf8:"\u7777\u7778\u7779 and some more text"
+    hash[$S2] = 'utf8'
+
+    check_key_encoding(hash, $S0, 'utf8', 'ascii')
+    check_key_encoding(hash, $S0, 'utf16', 'ascii')
+    check_key_encoding(hash, $S0, 'ucs2', 'ascii')
+    check_key_encoding(hash, $S0, 'ucs4', 'ascii')
+    check_key_encoding(hash, $S1, 'utf8', 'latin1')
+    check_key_encoding(hash, $S1, 'utf16', 'latin1')
+    check_key_encoding(hash, $S1, 'ucs4', 'latin1')
+    check_key_encoding(hash, $S2, 'utf16', 'utf8')
+    check_key_encoding(hash, $S2, 'ucs2', 'utf8')
+    check_key_encoding(hash, $S2, 'ucs4', 'utf8')
+.end
+
+.sub wide_and_narrow_keys
+    .local pmc hash
+    hash = new ['Hash']
+
+    # a wide codepoint and the four bytes spelling it
+    $S0 = utf8:"\u0100"
+    $S1 = iso-8859-1:"\x{0}\x{1}\x{0}\x{0}"
+    hash[$S0] = 'wide'
+    hash[$S1] = 'narrow'
+
+    $I0 = elements hash
+    is( $I0, 2, 'wide key and its bytes are different keys' )
+    $S2 = hash[$S0]
+    is( $S2, 'wide', 'wide key found' )
+    $S2 = hash[$S1]
+    is( $S2, 'narrow', 'narrow key with the same bytes found' )
+.end
+
+.sub check_key_encoding
+    .param pmc hash
+    .param string key
+    .param string encoding
+    .param string expected
+
+    $I0 = find_encoding encoding
+    key = trans_encoding key, $I0
+    $S0 = hash[key]
+    $S1 = concat expected, ' key found as '
+    $S1 .= encoding
+    is( $S0, expected, $S1 )
+.end
+
 # Switch to use integer keys instead of strings.
 .sub integer_keys
     .include "hash_key_type.pasm"
@@ -1363,6 +1423,74 @@ postit_end:
     is($S0, '', 'Item with key 0 deleted')
 .end
 
+.sub integer_keys_iterate_in_insertion_order
+    .local pmc hash, it
+    hash = new ['Hash']
+    hash = .Hash_key_type_int
+
+    hash[7]  = 'a'
+    hash[0]  = 'b'
+    hash[-1] = 'c'
+    hash[3]  = 'd'
+
+    $S0 = ''
+    it  = iter hash
+  loop:
+    unless it goto done
+    $P0 = shift it
+    $S1 = $P0
+    $S0 = concat $S0, $S1
+    $S0 = concat $S0, ' '
+    goto loop
+  done:
+    is($S0, '7 0 -1 3 ', 'integer keys, including 0, iterate in insertion order')
+.end
+
+.sub delete_and_reinsert_many_keys
+    .local pmc hash
+    .local int i, round, n, all_found
+    hash = new ['Hash']
+    hash = .Hash_key_type_int
+
+    i = 0
+  fill:
+    hash[i] = i
+    inc i
+    if i < 1000 goto fill
+
+    # delete and reinsert half of the keys, leaving many deleted slots
+    round = 0
+  churn:
+    i = round
+  churn_delete:
+    delete hash[i]
+    i += 2
+    if i < 1000 goto churn_delete
+    i = round
+  churn_insert:
+    hash[i] = i
+    i += 2
+    if i < 1000 goto churn_insert
+    inc round
+    if round < 20 goto churn
+
+    all_found = 1
+    i         = 0
+  check:
+    n = hash[i]
+    if n == i goto next
+    all_found = 0
+  next:
+    inc i
+    if i < 1000 goto check
+
+    ok(all_found, 'all keys found after deleting and reinserting many times')
+    n = elements hash
+    is(n, 1000, '... and the number of elements is right')
+    $I0 = exists hash[1000]
+    nok($I0, '... and a missing key is still missing')
+.end
+
 # Check that we can set various value types and they properly converted
 .sub value_types_convertion
     .local pmc hash
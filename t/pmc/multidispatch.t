@@ -8,7 +8,7 @@ use lib qw( . lib ../lib ../../lib );
 use Test::More;
 use Parrot::Test::Util 'create_tempfile';
 
-use Parrot::Test tests => 47;
+use Parrot::Test tests => 49;
 
 =head1 NAME
 
@@ -1538,6 +1538,127 @@ Scalar!
 Scalar!
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', 'MMD cache keeps type pairs apart' );
+.sub main :main
+    .local pmc int_subs, float_subs
+    .local int i
+
+    int_subs   = new ['ResizablePMCArray']
+    float_subs = new ['ResizablePMCArray']
+    i = 0
+  make_classes:
+    $S0 = i
+    $S1 = concat 'CacheInt', $S0
+    $P0 = subclass 'Integer', $S1
+    $P0 = new $S1
+    $P0 = 3
+    push int_subs, $P0
+    $S1 = concat 'CacheFloat', $S0
+    $P0 = subclass 'Float', $S1
+    $P0 = new $S1
+    $P0 = 0.5
+    push float_subs, $P0
+    inc i
+    if i < 8 goto make_classes
+
+    # the first pass fills the cache, the second one hits it
+    sum_pairs(int_subs, float_subs)
+    sum_pairs(int_subs, float_subs)
+.end
+
+.sub sum_pairs
+    .param pmc int_subs
+    .param pmc float_subs
+    .local pmc int_arg, float_arg, total
+    .local int i
+
+    int_arg   = new ['Integer']
+    int_arg   = 2
+    float_arg = new ['Float']
+    float_arg = 0.25
+    total     = new ['Float']
+    i = 0
+  loop:
+    $P0 = int_subs[i]
+    $P1 = $P0 + int_arg
+    total += $P1
+    $P1 = $P0 + float_arg
+    total += $P1
+    $P0 = float_subs[i]
+    $P1 = int_arg + $P0
+    total += $P1
+    $P1 = float_arg + $P0
+    total += $P1
+    inc i
+    if i < 8 goto loop
+    say total
+.end
+CODE
+92
+92
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'multis sharing a long signature, one replaced' );
+.sub main :main
+    .local pmc first, second, replaced
+    first    = get_global 'first_v1'
+    second   = get_global 'second_v1'
+    replaced = get_global 'first_v2'
+    add_multi 'pair_first', 'Integer,String', first
+    add_multi 'pair_second', 'Integer,String', second
+
+    'call'('pair_first')
+    'call'('pair_second')
+
+    $P0 = new ['MultiSub']
+    set_root_global ['MULTI'], 'pair_first', $P0
+    add_multi 'pair_first', 'Integer,String', replaced
+
+    'call'('pair_first')
+    'call'('pair_second')
+.end
+
+.sub 'call'
+    .param string name
+    .local pmc multi, i, s
+    multi = get_root_global ['MULTI'], name
+    i = new ['Integer']
+    i = 7
+    s = new ['String']
+    s = 'x'
+    multi(i, s)
+.end
+
+.sub first_v1
+    .param pmc i
+    .param pmc s
+    print 'first v1 '
+    print i
+    say s
+.end
+
+.sub first_v2
+    .param pmc i
+    .param pmc s
+    print 'first v2 '
+    print i
+    say s
+.end
+
+.sub second_v1
+    .param pmc i
+    .param pmc s
+    print 'second v1 '
+    print i
+    say s
+.end
+CODE
+first v1 7x
+second v1 7x
+first v2 7x
+second v1 7x
+OUTPUT
+
 
 # Local Variables:
 #   mode: cperl
@@ -17,11 +17,13 @@ Tests the ParrotInterpreter PMC.
 =cut
 
 .include 'except_types.pasm'
+.include 'iglobals.pasm'
+.include 'socket.pasm'
 
 .sub main :main
 .include 'test_more.pir'
 
-    plan(14)
+    plan(17)
     test_new()      # 1 test
     test_hll_map()  # 3 tests
     test_hll_map_invalid()  # 1 tests
@@ -29,6 +31,7 @@ Tests the ParrotInterpreter PMC.
 # Need for testing
 .annotate 'foo', 'bar'
     test_inspect()  # 9 tests
+    test_schedule_io()  # 3 tests
 .end
 
 .sub test_new
@@ -140,6 +143,69 @@ Tests the ParrotInterpreter PMC.
 
 .end
 
+.sub 'parrot_version_pipe'
+    .local pmc interp, conf, pipe
+    .local string cmd, aux
+    interp = getinterp
+    conf = interp[.IGLOBALS_CONFIG_HASH]
+    cmd = '"'
+    aux = conf['build_dir']
+    cmd .= aux
+    aux = conf['slash']
+    cmd .= aux
+    aux = conf['test_prog']
+    cmd .= aux
+    aux = conf['exe']
+    cmd .= aux
+    cmd .= '" --version'
+    pipe = new ['FileHandle']
+    pipe.'open'(cmd, 'rp')
+    .return (pipe)
+.end
+
+.sub 'test_schedule_io'
+    .local pmc interp, pipe, ready, sock
+    interp = getinterp
+
+    pipe  = parrot_version_pipe()
+    ready = interp.'schedule_io'(pipe, 1)
+    wait ready
+    $S0 = pipe.'readall'()
+    pipe.'close'()
+    $I0 = index $S0, 'This is Parrot'
+    $I0 = $I0 >= 0
+    ok($I0, 'schedule_io without a task waits for a pipe')
+
+    pipe  = parrot_version_pipe()
+    $P0   = get_global 'read_version'
+    ready = interp.'schedule_io'(pipe, 1, $P0)
+    wait ready
+    $P0 = get_global 'version'
+    $S0 = $P0
+    $I0 = index $S0, 'This is Parrot'
+    $I0 = $I0 >= 0
+    ok($I0, 'schedule_io runs a sub once the pipe is readable')
+
+    # nobody connects, so only closing the socket ends the wait
+    sock = new ['Socket']
+    sock.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    $P0 = sock.'sockaddr'('localhost', 0)
+    sock.'bind'($P0)
+    sock.'listen'(1)
+    ready = interp.'schedule_io'(sock, 1)
+    sock.'close'()
+    wait ready
+    ok(1, 'closing a handle ends the wait for it')
+.end
+
+.sub 'read_version'
+    .param pmc pipe
+    $S0 = pipe.'readall'()
+    pipe.'close'()
+    $P0 = box $S0
+    set_global 'version', $P0
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -9,14 +9,15 @@
     # Use say instead inside tasks
     .include 'test_more.pir'
 
-    plan(8)
+    plan(9)
 
     ok(1, "initialized")
 
     tasks_run()
     task_send_recv()
+    tasks_schedule_tasks()
 
-    print "ok 7 #SKIP task.kill - no reliable test yet [GH #907]\n"
+    print "ok 8 #SKIP task.kill - no reliable test yet [GH #907]\n"
     goto post_kill
 
     $S0 = sysinfo .SYSINFO_PARROT_OS
@@ -25,7 +26,7 @@
     task_kill()
     goto post_kill
   skip_kill:
-    print "ok 7 #SKIP task.kill - no signals on Windows yet\n"
+    print "ok 8 #SKIP task.kill - no signals on Windows yet\n"
   post_kill:
     preempt_and_exit()
 .end
@@ -105,6 +106,38 @@ ok:
     say "ok 6 Got existing message"
 .end
 
+.sub tasks_schedule_tasks
+    $P0 = get_global 'spawner'
+    $P1 = new 'Task', $P0
+    schedule $P1
+    wait $P1
+.end
+
+.sub spawner
+    .local pmc tasks, code, task
+    tasks = new 'ResizablePMCArray'
+    code  = get_global 'spawned'
+    $I0 = 0
+  spawn:
+    task = new 'Task', code
+    schedule task
+    push tasks, task
+    inc $I0
+    if $I0 < 10 goto spawn
+  join:
+    task = shift tasks
+    wait task
+    if tasks goto join
+    say "ok 7 tasks scheduled by a task ran"
+.end
+
+.sub spawned
+    $I0 = 0
+  loop:
+    inc $I0
+    if $I0 < 1000 goto loop
+.end
+
 .sub task_kill
     .local pmc task, code
     code = get_global 'task_to_kill'
@@ -122,9 +155,9 @@ ok:
 .end
 
 .sub task_to_kill
-    print "ok 7 task_to_kill running\n"
+    print "ok 8 task_to_kill running\n"
     sleep 0.2
-    say "not ok 8 task_to_kill wasn't killed"
+    say "not ok 9 task_to_kill wasn't killed"
 .end
 
 .sub preempt_and_exit
@@ -136,7 +169,7 @@ again:
 .end
 
 .sub exit0
-    say "ok 8 pre-empt and exit"
+    say "ok 9 pre-empt and exit"
     exit 0
 .end
 
@@ -0,0 +1,82 @@
+#!perl
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+t/run/cgoto.t - run op tests under the cgoto runcore
+
+=head1 SYNOPSIS
+
+    % prove t/run/cgoto.t
+
+=head1 DESCRIPTION
+
+Runs a few of the PIR op test files under C<-R cgoto>. Most ops are labels
+inside the computed goto core, while others still go through the function
+table, so these cover both kinds of dispatch. Also checks which core
+C<-R cgoto> selects: the cgoto core when it was built, and the fast core
+otherwise. C<make testg> runs the whole runcore suite under this core.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( lib . ../lib ../../lib );
+
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 11;
+use Parrot::Test::Util 'create_tempfile';
+use TAP::Parser;
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+
+my @op_tests = map { "t/op/$_.t" } qw(
+    arithmetics
+    box
+    cmp-nonbranch
+    comp
+    copy
+    ifunless
+    integer
+    literal
+    number
+    string
+);
+
+for my $file (@op_tests) {
+    my $parser = TAP::Parser->new( { exec => [ $PARROT, '-R', 'cgoto', $file ] } );
+    $parser->run;
+
+    ok( !$parser->has_problems && $parser->tests_run, "$file under -R cgoto" )
+        or diag join "\n", map { "failed: $_" } $parser->failed;
+}
+
+my ( $fh, $pir_file ) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+print $fh <<'END_PIR';
+.include 'interpinfo.pasm'
+.include 'interpcores.pasm'
+.sub main :main
+    $I0 = interpinfo .INTERPINFO_CURRENT_RUNCORE
+    if $I0 == .PARROT_CGOTO_CORE goto cgoto
+    if $I0 == .PARROT_FAST_CORE goto fast
+    say 'other'
+    .return ()
+  cgoto:
+    say 'cgoto'
+    .return ()
+  fast:
+    say 'fast'
+.end
+END_PIR
+close $fh;
+
+my $expected = $PConfig{HAS_CGOTO} ? "cgoto\n" : "fast\n";
+is( qx{"$PARROT" -R cgoto "$pir_file"}, $expected, '-R cgoto selects the expected core' );
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
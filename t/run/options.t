@@ -21,7 +21,7 @@ use lib qw( lib . ../lib ../../lib );
 
 use Test::More;
 use Parrot::Config;
-use Parrot::Test tests => 40;
+use Parrot::Test tests => 52;
 use File::Temp 0.13 qw/tempfile/;
 use File::Spec;
 
@@ -81,7 +81,7 @@ TODO: {
 my $cmd;
 
 ## this test assumes these cores work on all platforms (a safe assumption)
-for my $val (qw/ slow fast bounds trace /) {
+for my $val (qw/ slow fast cgoto bounds trace /) {
     for my $opt ( '-R ', '--runcore ', '--runcore=' ) {
         $cmd = qq{"$PARROT" $opt$val "$second_pir_file" $redir};
         is( qx{$cmd}, "second\n", "<$opt$val> option)" ) or diag $cmd;
@@ -140,6 +140,141 @@ sub numthreads_tests {
 
 numthreads_tests();
 
+sub gc_threads_tests {
+    my $output = qx{$PARROT 2>&1 --gc-threads 0};
+    like($output, qr/number of GC threads must be between 1 and 64/,
+        '--gc-threads 0 gives an error');
+
+    $output = qx{$PARROT 2>&1 --gc-threads 65};
+    like($output, qr/number of GC threads must be between 1 and 64/,
+        '--gc-threads 65 gives an error');
+
+    $output = qx{$PARROT 2>&1 --gc-threads -2};
+    like($output, qr/invalid number of GC threads/, '--gc-threads -2 gives an error');
+
+    # Marks a few thousand Hashes with several threads and checks their contents
+    my ( $fh, $filename ) = tempfile( UNLINK => 1, SUFFIX => '.pir' );
+    print $fh <<'END_PIR';
+.include 'interpinfo.pasm'
+.sub main :main
+    .local pmc root, hash
+    root = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    hash = new ['Hash']
+    hash['key'] = $I0
+    $P0 = new ['FixedPMCArray']
+    $P0 = 1
+    $P0[0] = root
+    hash['up'] = $P0
+    push root, hash
+    inc $I0
+    if $I0 < 5000 goto fill
+
+    sweep 1
+    sweep 1
+
+    $I0 = 0
+  check:
+    hash = root[$I0]
+    $I1 = hash['key']
+    if $I1 != $I0 goto fail
+    inc $I0
+    if $I0 < 5000 goto check
+
+    $I0 = interpinfo .INTERPINFO_GC_MARK_THREADS
+    print 'marked with '
+    say $I0
+    .return ()
+  fail:
+    say 'lost objects'
+.end
+END_PIR
+    close $fh;
+
+    $output = qx{$PARROT 2>&1 --gc gms --gc-threads 4 "$filename"};
+    like($output, qr/^marked with [14]$/, '--gc-threads 4 marks live objects');
+
+    $output = qx{$PARROT 2>&1 --gc gms "$filename"};
+    is($output, "marked with 1\n", 'marking uses one thread by default');
+}
+
+gc_threads_tests();
+
+sub gc_max_pause_tests {
+    my $output = qx{$PARROT 2>&1 --gc-max-pause 0};
+    like($output, qr/GC pause must be between 1 and 1000000 usec/,
+        '--gc-max-pause 0 gives an error');
+
+    $output = qx{$PARROT 2>&1 --gc-max-pause 1000001};
+    like($output, qr/GC pause must be between 1 and 1000000 usec/,
+        '--gc-max-pause 1000001 gives an error');
+
+    $output = qx{$PARROT 2>&1 --gc-max-pause -2};
+    like($output, qr/invalid GC pause/, '--gc-max-pause -2 gives an error');
+
+    # Stores new objects in old ones while collections mark in slices
+    my ( $fh, $filename ) = tempfile( UNLINK => 1, SUFFIX => '.pir' );
+    print $fh <<'END_PIR';
+.include 'interpinfo.pasm'
+.sub main :main
+    .local pmc root, hash
+    root = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    hash = new ['Hash']
+    hash['key'] = $I0
+    push root, hash
+    inc $I0
+    if $I0 < 1000 goto fill
+
+    $I0 = 0
+  churn:
+    $I1 = $I0 % 1000
+    hash = root[$I1]
+    $P0 = new ['Integer']
+    $P0 = $I0
+    hash['new'] = $P0
+    $P1 = new ['FixedPMCArray']
+    inc $I0
+    $I2 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    if $I2 >= 3 goto check
+    if $I0 < 5000000 goto churn
+
+  check:
+    sweep 1
+    $I0 = 0
+  check_hash:
+    hash = root[$I0]
+    $I1 = hash['key']
+    if $I1 != $I0 goto fail
+    $I1 = exists hash['new']
+    unless $I1 goto next_hash
+    $P0 = hash['new']
+    $I1 = $P0
+    $I1 %= 1000
+    if $I1 != $I0 goto fail
+  next_hash:
+    inc $I0
+    if $I0 < 1000 goto check_hash
+
+    $I0 = interpinfo .INTERPINFO_GC_MARK_SLICES
+    unless $I0 goto done
+    say 'marked in slices'
+  done:
+    .return ()
+  fail:
+    say 'lost objects'
+.end
+END_PIR
+    close $fh;
+
+    $output = qx{$PARROT 2>&1 --gc gms --gc-max-pause 100 --gc-nursery-size 0.5 "$filename"};
+    is($output, "marked in slices\n", '--gc-max-pause 100 keeps live objects');
+}
+
+gc_max_pause_tests();
+
 # Test --leak-test. See issue GH #765
 is( qx{$PARROT --leak-test "$first_pir_file"}, "first\n", '--leak-test' );
 
@@ -1,5 +1,5 @@
 #!perl
-# Copyright (C) 2010, Parrot Foundation.
+# Copyright (C) 2010-2015, Parrot Foundation.
 
 use strict;
 use warnings;
@@ -26,7 +26,7 @@ Tests string API support.
 
 # generic tests
 
-plan tests => 1;
+plan tests => 4;
 
 c_output_is( <<'CODE', <<'OUTPUT', "wchar import / export" );
 
@@ -75,6 +75,137 @@ export a wchar string from a Parrot_string
 import a binary string into a Parrot_string
 OUTPUT
 
+c_output_is( <<'CODE', <<'OUTPUT', "intern" );
+
+#include <parrot/parrot.h>
+#include <parrot/api.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+    Parrot_PMC pmc = Parrot_pmc_new(interp, enum_class_ParrotInterpreter);
+
+    Parrot_String a, b, ia, ib;
+
+    Parrot_api_string_import_ascii(pmc, "some_name", &a);
+    Parrot_api_string_import_ascii(pmc, "some_name", &b);
+
+    if (a != b)
+        puts("imported strings are different");
+
+    Parrot_api_string_intern(pmc, a, &ia);
+    Parrot_api_string_intern(pmc, b, &ib);
+
+    if (ia == ib)
+        puts("interned strings are the same");
+
+    if (strcmp(Parrot_str_to_cstring(interp, ib), "some_name") == 0)
+        puts("interned string keeps the value");
+
+    Parrot_pmc_destroy(interp, pmc);
+
+    return EXIT_SUCCESS;
+}
+CODE
+imported strings are different
+interned strings are the same
+interned string keeps the value
+OUTPUT
+
+c_output_is( <<'CODE', <<'OUTPUT', "method cache keeps no names alive" );
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+static int
+count_entries(Parrot_Interp interp)
+{
+    Caches * const mc = interp->caches;
+    UINTVAL        type, bits;
+    int            n = 0;
+
+    for (type = 0; type < mc->mc_size; ++type) {
+        if (!mc->idx[type])
+            continue;
+        for (bits = 0; bits < 0x200; ++bits) {
+            Meth_cache_entry *e;
+            for (e = mc->idx[type][bits]; e; e = e->next)
+                ++n;
+        }
+    }
+
+    return n;
+}
+
+int main(int argc, char* argv[])
+{
+    Parrot_Interp  interp = Parrot_interp_new(NULL);
+    Parrot_PMC     pmc    = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    Parrot_String  name;
+
+    name = Parrot_str_new(interp, "generated_name", 0);
+    (void)Parrot_find_method_with_cache(interp, pmc, name);
+    printf("runtime name: %d\n", count_entries(interp));
+
+    name = Parrot_str_intern(interp, name);
+    (void)Parrot_find_method_with_cache(interp, pmc, name);
+    printf("interned name: %d\n", count_entries(interp));
+
+    (void)Parrot_find_method_with_cache(interp, pmc,
+            Parrot_str_new(interp, "generated_name", 0));
+    printf("equal runtime name: %d\n", count_entries(interp));
+
+    Parrot_gc_free_string_header(interp, name);
+    printf("interned name freed: %d\n", count_entries(interp));
+
+    (void)Parrot_find_method_with_cache(interp, pmc,
+            Parrot_str_new_constant(interp, "constant_name"));
+    printf("constant name: %d\n", count_entries(interp));
+
+    Parrot_interp_destroy(interp);
+
+    return EXIT_SUCCESS;
+}
+CODE
+runtime name: 0
+interned name: 1
+equal runtime name: 1
+interned name freed: 0
+constant name: 1
+OUTPUT
+
+c_output_is( <<'CODE', <<'OUTPUT', "hash values of wide and narrow strings" );
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Parrot_Interp interp = Parrot_interp_new(NULL);
+
+    /* U+0100 as UTF-8 and UCS-4, and its codepoint's four bytes as Latin-1 */
+    STRING * const wide   = Parrot_str_chr(interp, 0x100);
+    STRING * const wide4  = Parrot_str_change_encoding(interp, wide,
+                                Parrot_ucs4_encoding_ptr->num);
+    STRING * const narrow = Parrot_str_new_init(interp, "\0\1\0\0", 4,
+                                Parrot_latin1_encoding_ptr, 0);
+
+    if (Parrot_str_to_hashval(interp, wide) != Parrot_str_to_hashval(interp, narrow))
+        puts("wide and narrow strings hash differently");
+
+    if (Parrot_str_to_hashval(interp, wide) == Parrot_str_to_hashval(interp, wide4))
+        puts("equal wide strings hash the same");
+
+    Parrot_interp_destroy(interp);
+
+    return EXIT_SUCCESS;
+}
+CODE
+wide and narrow strings hash differently
+equal wide strings hash the same
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -16,7 +16,7 @@ my $parrot_config = "parrot_config" . $PConfig{o};
 
 plan skip_all => 'src/parrot_config.o does not exist' unless -e catfile("src", $parrot_config);
 
-plan tests => 19;
+plan tests => 20;
 
 =head1 NAME
 
@@ -724,6 +724,44 @@ CODE
 Result is 300.
 OUTPUT
 
+c_output_is( <<"CODE", <<'OUTPUT', 'call sub from C through a signature handle' );
+#include <parrot/parrot.h>
+#include <parrot/extend.h>
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_Int      result;
+    Parrot_PMC      sub, pbc;
+    PackFile* pf;
+    Pcc_signature  *sig;
+    int             i;
+    Parrot_Interp   interp = Parrot_interp_new(NULL);
+
+    if (interp) {
+        Parrot_String   temp_pbc_str = Parrot_str_new(interp, "$temp_pbc", 0);
+        pf   = Parrot_pf_read_pbc_file(interp, temp_pbc_str);
+        pbc  = Parrot_pf_get_packfile_pmc(interp, pf, STRINGNULL);
+        Parrot_pf_set_current_packfile(interp, pbc);
+
+        sub = Parrot_ns_find_current_namespace_global( interp,
+                  Parrot_str_new_constant( interp, "add" ) );
+        sig = Parrot_pcc_signature_new(interp, "II->I");
+        for (i = 1; i <= 3; i++) {
+            Parrot_pcc_invoke_sub_from_signature(interp, sub, sig, i, 100, &result);
+            printf( "Result is %d.\\n", result );
+        }
+        Parrot_pcc_signature_destroy(interp, sig);
+        Parrot_interp_destroy(interp);
+    }
+    return 0;
+}
+CODE
+Result is 101.
+Result is 102.
+Result is 103.
+OUTPUT
+
 c_output_is( <<'CODE', <<'OUTPUT', 'multiple Parrot_interp_new/Parrot_x_exit cycles');
 
 #include <stdio.h>
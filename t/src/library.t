@@ -0,0 +1,160 @@
+#!perl
+# Copyright (C) 2015, Parrot Foundation.
+
+use strict;
+use warnings;
+
+use lib qw(. lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test;
+use Parrot::Config;
+use File::Spec::Functions;
+use File::Temp qw(tempdir);
+
+my $parrot_config = "parrot_config" . $PConfig{o};
+
+plan skip_all => 'src/parrot_config.o does not exist' unless -e catfile("src", $parrot_config);
+
+=head1 NAME
+
+t/src/library.t - locating runtime files
+
+=head1 SYNOPSIS
+
+    % prove t/src/library.t
+
+=head1 DESCRIPTION
+
+Counts the files probed and the directories listed by
+C<Parrot_locate_runtime_file_str> when the same files are located again, and
+after the search paths change. Checks that a file created after it was
+missing is found.
+
+=cut
+
+plan tests => 3;
+
+my $locate = <<'CODE';
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+static STRING *
+locate(Interp *interp, const char *what, const char *name)
+{
+    Lib_lookup_cache * const cache    = interp->lib_lookups;
+    const UINTVAL            stats    = cache->n_stats;
+    const UINTVAL            readdirs = cache->n_readdirs;
+    STRING * const           path     = Parrot_locate_runtime_file_str(interp,
+                                            Parrot_str_new(interp, name, 0),
+                                            PARROT_RUNTIME_FT_PBC);
+
+    printf("%s: %s, %d stats, %d readdirs\n", what, path ? "found" : "missing",
+            (int)(cache->n_stats - stats), (int)(cache->n_readdirs - readdirs));
+    return path;
+}
+CODE
+
+c_output_like( $locate . <<'CODE', <<'OUTPUT', "located files are remembered" );
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+
+    interp->lib_lookups->index_dirs = 0;
+    Parrot_lib_add_path_from_cstring(interp, "t/src/no_such_dir/", PARROT_LIB_PATH_LIBRARY);
+    Parrot_lib_add_path_from_cstring(interp, "runtime/parrot/library/", PARROT_LIB_PATH_LIBRARY);
+
+    locate(interp, "missing", "no_such_library.pbc");
+    locate(interp, "missing again", "no_such_library.pbc");
+    locate(interp, "present", "Data/Dumper.pir");
+    locate(interp, "present again", "Data/Dumper.pir");
+
+    Parrot_lib_add_path_from_cstring(interp, "t/src/", PARROT_LIB_PATH_LIBRARY);
+    locate(interp, "missing after add_path", "no_such_library.pbc");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+/\Amissing: missing, [1-9]\d* stats, 0 readdirs
+missing again: missing, [1-9]\d* stats, 0 readdirs
+present: found, [1-9]\d* stats, 0 readdirs
+present again: found, 1 stats, 0 readdirs
+missing after add_path: missing, [1-9]\d* stats, 0 readdirs
+\z/
+OUTPUT
+
+c_output_like( $locate . <<'CODE', <<'OUTPUT', "search directories are listed instead of probed" );
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+
+    interp->lib_lookups->index_dirs = 1;
+    Parrot_lib_add_path_from_cstring(interp, "t/src/no_such_dir/", PARROT_LIB_PATH_LIBRARY);
+    Parrot_lib_add_path_from_cstring(interp, "runtime/parrot/library/", PARROT_LIB_PATH_LIBRARY);
+
+    locate(interp, "missing", "no_such_library.pbc");
+    locate(interp, "also missing", "no_such_library_either.pbc");
+    locate(interp, "missing again", "no_such_library.pbc");
+    locate(interp, "present", "Data/Dumper.pir");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+/\Amissing: missing, \d+ stats, [1-9]\d* readdirs
+also missing: missing, \d+ stats, 0 readdirs
+missing again: missing, \d+ stats, 0 readdirs
+present: found, [1-9]\d* stats, 0 readdirs
+\z/
+OUTPUT
+
+my $dir = tempdir( CLEANUP => 1 );
+
+c_output_like( $locate . <<"CODE", <<'OUTPUT', "files created after a miss are found" );
+
+static void
+create(const char *name)
+{
+    FILE * const fh = fopen(name, "w");
+    fclose(fh);
+}
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+
+    Parrot_lib_add_path_from_cstring(interp, "$dir/", PARROT_LIB_PATH_LIBRARY);
+
+    interp->lib_lookups->index_dirs = 0;
+    locate(interp, "probed", "gen_mod.pir");
+    create("$dir/gen_mod.pir");
+    locate(interp, "probed after creating it", "gen_mod.pir");
+
+    interp->lib_lookups->index_dirs = 1;
+    locate(interp, "listed", "gen_listed.pir");
+    locate(interp, "listed again", "gen_listed.pir");
+    create("$dir/gen_listed.pir");
+    locate(interp, "listed after creating it", "gen_listed.pir");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+/\Aprobed: missing, \d+ stats, 0 readdirs
+probed after creating it: found, \d+ stats, 0 readdirs
+listed: missing, \d+ stats, [1-9]\d* readdirs
+listed again: missing, \d+ stats, \d+ readdirs
+listed after creating it: found, \d+ stats, [1-9]\d* readdirs
+\z/
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
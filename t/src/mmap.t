@@ -0,0 +1,188 @@
+#!perl
+# Copyright (C) 2015, Parrot Foundation.
+
+use strict;
+use warnings;
+
+use lib qw(. lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test;
+use Parrot::Config;
+use File::Spec::Functions;
+use File::Temp;
+use Parrot::Test::Util 'create_tempfile';
+
+my $parrot_config = "parrot_config" . $PConfig{o};
+
+plan skip_all => 'src/parrot_config.o does not exist' unless -e catfile("src", $parrot_config);
+plan skip_all => 'no mmap' unless $PConfig{i_sysmman};
+
+=head1 NAME
+
+t/src/mmap.t - STRINGs pointing into file mappings
+
+=head1 SYNOPSIS
+
+    % prove t/src/mmap.t
+
+=head1 DESCRIPTION
+
+Checks that a file mapping STRINGs were read from stays mapped while any of
+them, or of their copies, is alive, and is unmapped after the last is freed.
+Mapped bytecode files are unmapped with their C<PackFile>, while its string
+constants live on.
+
+=cut
+
+plan tests => 2;
+
+my $tmp = File::Temp->new(TEMPLATE => 'mmap_XXXX', SUFFIX => '.tmp');
+$tmp->print("first line\nsecond line\n");
+$tmp->close;
+my $file = $tmp->filename;
+
+c_output_is( <<"CODE", <<'OUTPUT', "mapping released with its last STRING" );
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+static int
+count_mappings(Interp *interp)
+{
+    Parrot_File_Mapping *map;
+    int                  n = 0;
+
+    for (map = interp->mapped_files; map; map = map->next)
+        ++n;
+
+    return n;
+}
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+    PMC    *fh;
+    STRING *line, *sub;
+    char   *cstr;
+
+    fh = Parrot_io_open(interp, PMCNULL, Parrot_str_new(interp, "$file", 0),
+            Parrot_str_new(interp, "rm", 0));
+    printf("opened: %d\\n", count_mappings(interp));
+
+    line = Parrot_io_readline_s(interp, fh, Parrot_str_new(interp, "\\n", 1));
+    sub  = Parrot_str_substr(interp, line, 0, 5);
+    Parrot_io_close(interp, fh, 0);
+    printf("closed: %d\\n", count_mappings(interp));
+
+    Parrot_gc_free_string_header(interp, line);
+    printf("line freed: %d\\n", count_mappings(interp));
+
+    cstr = Parrot_str_to_cstring(interp, sub);
+    printf("%s\\n", cstr);
+    Parrot_str_free_cstring(cstr);
+    Parrot_gc_free_string_header(interp, sub);
+    printf("substring freed: %d\\n", count_mappings(interp));
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+opened: 1
+closed: 1
+line freed: 1
+first
+substring freed: 0
+OUTPUT
+
+my ($pir_fh, $pir_filename) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+(undef, my $pbc_filename) = create_tempfile( SUFFIX => '.pbc', UNLINK => 1 );
+print $pir_fh <<'PIR';
+.sub 'main'
+    say 'a string constant'
+.end
+PIR
+close $pir_fh;
+system(qw[./parrot -o], $pbc_filename, $pir_filename)
+    and die "couldn't compile PIR";
+
+c_output_is( <<"CODE", <<'OUTPUT', "packfile unmapped with the PackFile" );
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+static int
+count_mappings(Interp *interp)
+{
+    Parrot_File_Mapping *map;
+    int                  n = 0;
+
+    for (map = interp->mapped_files; map; map = map->next)
+        ++n;
+
+    return n;
+}
+
+int main(int argc, char* argv[])
+{
+    Interp   *interp = Parrot_interp_new(NULL);
+    PackFile *pf;
+    STRING   *constant = NULL, *view, *copy;
+    char     *cstr;
+    size_t    i;
+    opcode_t  j;
+
+    pf = Parrot_pf_read_pbc_file(interp, Parrot_str_new(interp, "$pbc_filename", 0));
+    printf("read: %d\\n", count_mappings(interp));
+
+    for (i = 0; i < pf->directory.num_segments; ++i) {
+        PackFile_Segment * const seg = pf->directory.segments[i];
+
+        if (seg->type == PF_CONST_SEG) {
+            PackFile_ConstTable * const ct = (PackFile_ConstTable *)seg;
+
+            for (j = 0; j < ct->str.const_count; ++j)
+                if (Parrot_str_equal(interp, ct->str.constants[j],
+                        Parrot_str_new(interp, "a string constant", 0)))
+                    constant = ct->str.constants[j];
+        }
+    }
+    printf("constant mapped: %d\\n", constant && PObj_mapped_TEST(constant) ? 1 : 0);
+
+    /* a non-constant STRING pointing into the mapping, and a copy of it */
+    view = Parrot_str_new_init(interp, constant->strstart, constant->bufused,
+            constant->encoding, PObj_external_FLAG);
+    PObj_get_FLAGS(view) |= PObj_mapped_FLAG;
+    ++interp->mapped_files->refs;
+    copy = Parrot_str_copy(interp, view);
+    Parrot_gc_free_string_header(interp, view);
+    printf("copy mapped: %d\\n", PObj_mapped_TEST(copy) ? 1 : 0);
+
+    Parrot_pf_destroy(interp, pf);
+    printf("destroyed: %d\\n", count_mappings(interp));
+
+    cstr = Parrot_str_to_cstring(interp, constant);
+    printf("%s, mapped: %d\\n", cstr, PObj_mapped_TEST(constant) ? 1 : 0);
+    Parrot_str_free_cstring(cstr);
+
+    Parrot_gc_free_string_header(interp, copy);
+    printf("copy freed: %d\\n", count_mappings(interp));
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+read: 1
+constant mapped: 1
+copy mapped: 1
+destroyed: 1
+a string constant, mapped: 0
+copy freed: 0
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,146 @@
+#! perl
+# Copyright (C) 2015, Parrot Foundation.
+# auto/cgoto-01.t
+
+use strict;
+use warnings;
+use Test::More tests => 30;
+use Carp;
+use lib qw( lib t/configure/testlib );
+use_ok('config::auto::cgoto');
+use Parrot::Configure::Options qw( process_options );
+use Parrot::Configure::Step::Test;
+use Parrot::Configure::Test qw(
+    test_step_constructor_and_description
+);
+use Parrot::Configure::Utils qw| capture |;
+
+########## regular ##########
+
+my ($args, $step_list_ref) = process_options(
+    {
+        argv => [ ],
+        mode => q{configure},
+    }
+);
+
+my $conf = Parrot::Configure::Step::Test->new;
+$conf->include_config_results( $args );
+
+my $pkg = q{auto::cgoto};
+$conf->add_steps($pkg);
+
+my $serialized = $conf->pcfreeze();
+
+$conf->options->set( %{$args} );
+my $step = test_step_constructor_and_description($conf);
+ok( $step->runstep($conf), "runstep() returned true value" );
+like( $step->result(), qr/^(yes|no)$/, "Got expected result" );
+is( $conf->data->get('HAS_CGOTO'), ( $step->result() eq 'yes' ? 1 : 0 ),
+    "'HAS_CGOTO' matches the probe result" );
+
+$conf->replenish($serialized);
+
+########## --without-cgoto ##########
+
+($args, $step_list_ref) = process_options(
+    {
+        argv => [ q{--without-cgoto} ],
+        mode => q{configure},
+    }
+);
+$conf->add_steps($pkg);
+$conf->options->set( %{$args} );
+$step = test_step_constructor_and_description($conf);
+ok( $step->runstep($conf), "runstep() returned true value" );
+is( $step->result(), 'skipped', "Got expected result" );
+is( $conf->data->get('HAS_CGOTO'), 0,
+    "'HAS_CGOTO' unset, so -R cgoto falls back to the fast core" );
+
+$conf->replenish($serialized);
+
+########## _evaluate_cgoto() ##########
+
+($args, $step_list_ref) = process_options(
+    {
+        argv => [ ],
+        mode => q{configure},
+    }
+);
+$conf->add_steps($pkg);
+$conf->options->set( %{$args} );
+$step = test_step_constructor_and_description($conf);
+
+# Mock both outcomes of the probe
+ok( $step->_evaluate_cgoto($conf, 1),
+    "_evaluate_cgoto() returned true value as expected" );
+is( $conf->data->get('HAS_CGOTO'), 1, "'HAS_CGOTO' set as expected" );
+is( $step->result(), 'yes', "Got expected result" );
+
+ok( ! $step->_evaluate_cgoto($conf, 0),
+    "_evaluate_cgoto() returned false value as expected" );
+is( $conf->data->get('HAS_CGOTO'), 0,
+    "'HAS_CGOTO' unset, so -R cgoto falls back to the fast core" );
+is( $step->result(), 'no', "Got expected result" );
+
+$conf->replenish($serialized);
+
+########## --verbose; _evaluate_cgoto() ##########
+
+($args, $step_list_ref) = process_options(
+    {
+        argv => [ q{--verbose} ],
+        mode => q{configure},
+    }
+);
+$conf->add_steps($pkg);
+$conf->options->set( %{$args} );
+$step = test_step_constructor_and_description($conf);
+{
+    my ($stdout, $has_cgoto);
+    capture(
+        sub { $has_cgoto = $step->_evaluate_cgoto($conf, 1) },
+        \$stdout,
+    );
+    ok( $has_cgoto, "_evaluate_cgoto() returned true value as expected" );
+    like( $stdout, qr/computed goto detected/, "Got expected verbose output" );
+
+    capture(
+        sub { $has_cgoto = $step->_evaluate_cgoto($conf, 0) },
+        \$stdout,
+    );
+    ok( ! $has_cgoto, "_evaluate_cgoto() returned false value as expected" );
+    like( $stdout, qr/computed goto not detected/, "Got expected verbose output" );
+}
+
+pass("Completed all tests in $0");
+
+################### DOCUMENTATION ###################
+
+=head1 NAME
+
+auto/cgoto-01.t - test auto::cgoto
+
+=head1 SYNOPSIS
+
+    % prove t/steps/auto/cgoto-01.t
+    % perl Configure.pl --test
+
+=head1 DESCRIPTION
+
+The files in this directory test functionality used by F<Configure.pl>.
+
+The tests in this file test auto::cgoto.
+
+=head1 SEE ALSO
+
+config::auto::cgoto, F<Configure.pl>.
+
+=cut
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,93 @@
+#! perl
+# Copyright (C) 2015, Parrot Foundation.
+# auto/hash-01.t
+
+use strict;
+use warnings;
+use Test::More tests =>  9;
+use lib qw( lib t/configure/testlib );
+use_ok('config::auto::hash');
+use Parrot::Configure::Options qw( process_options );
+use Parrot::Configure::Step::Test;
+use Parrot::Configure::Test qw(
+    test_step_constructor_and_description
+);
+use Parrot::Configure::Utils qw| capture |;
+
+########### --verbose ###########
+
+my ($args, $step_list_ref) = process_options(
+    {
+        argv => [ '--verbose', '--hash-function=bernstein' ],
+        mode => q{configure},
+    }
+);
+
+my $conf = Parrot::Configure::Step::Test->new;
+$conf->include_config_results( $args );
+
+my $pkg = q{auto::hash};
+
+$conf->add_steps($pkg);
+
+my $serialized = $conf->pcfreeze();
+
+$conf->options->set( %{$args} );
+my $step = test_step_constructor_and_description($conf);
+{
+    my ($ret, $stdout);
+    capture(
+        sub { $ret = $step->runstep($conf); },
+        \$stdout,
+    );
+    ok($ret, "runstep() returned true value");
+    like($stdout, qr/\(bernstein\)/, "Got expected verbose output");
+    is($conf->data->get('hash_type'), 'BERNSTEIN',
+          "Got expected value for 'hash_type'");
+}
+
+$conf->options->set( 'hash-function' => 'crc32' );
+{
+    my ($err, $stdout);
+    capture(
+        sub { eval { $step->runstep($conf); }; $err = $@; },
+        \$stdout,
+    );
+    like($err, qr/unknown hash function 'crc32'/,
+        "Got expected error for unknown hash function");
+}
+
+pass("Completed all tests in $0");
+
+################### DOCUMENTATION ###################
+
+=head1 NAME
+
+auto_hash-01.t - test auto::hash
+
+=head1 SYNOPSIS
+
+    % prove t/steps/auto/hash-01.t
+
+=head1 DESCRIPTION
+
+The files in this directory test functionality used by F<Configure.pl>.
+
+The tests in this file test auto::hash.
+
+=head1 AUTHOR
+
+James E Keenan
+
+=head1 SEE ALSO
+
+config::auto::hash, F<Configure.pl>.
+
+=cut
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4: